@@ -158,6 +158,22 @@ IF (ESCARGOT_TCO)
     ENDIF()
 ENDIF()
 
+IF (NOT DEFINED ESCARGOT_SUPER_INSTRUCTION)
+    SET (ESCARGOT_SUPER_INSTRUCTION ON)
+ENDIF()
+
+IF (ESCARGOT_SUPER_INSTRUCTION)
+    SET (ESCARGOT_DEFINITIONS ${ESCARGOT_DEFINITIONS} -DENABLE_SUPER_INSTRUCTION)
+ENDIF()
+
+IF (ESCARGOT_OPCODE_STATS)
+    SET (ESCARGOT_DEFINITIONS ${ESCARGOT_DEFINITIONS} -DENABLE_OPCODE_STATS)
+ENDIF()
+
+IF (ESCARGOT_SAMPLING_PROFILER)
+    SET (ESCARGOT_DEFINITIONS ${ESCARGOT_DEFINITIONS} -DENABLE_SAMPLING_PROFILER)
+ENDIF()
+
 IF (ESCARGOT_TEMPORAL)
     SET (ESCARGOT_DEFINITIONS ${ESCARGOT_DEFINITIONS} -DENABLE_TEMPORAL)
 ENDIF()
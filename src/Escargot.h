@@ -488,7 +488,8 @@ void customEscargotErrorLogger(const char* format, ...);
 #define MAY_THREAD_LOCAL
 #endif
 
-#if defined(COMPILER_GCC) || defined(COMPILER_CLANG)
+// opcode stats counts every dispatch in the switch-based interpreter loop
+#if (defined(COMPILER_GCC) || defined(COMPILER_CLANG)) && !defined(ENABLE_OPCODE_STATS)
 #define ESCARGOT_COMPUTED_GOTO_INTERPRETER
 // some devices cannot support getting label address from outside well
 #if (defined(CPU_ARM64) || (defined(CPU_ARM32) && defined(COMPILER_CLANG))) || defined(OS_DARWIN) || defined(OS_ANDROID) || defined(OS_WINDOWS)
@@ -555,14 +556,38 @@ typedef uint16_t LexicalBlockIndex;
 #define STRING_SUB_STRING_MIN_VIEW_LENGTH 32
 #endif
 
+// substring of a string longer than this is copied instead of sharing the buffer
+// until substrings taken from the string cover 1/STRING_VIEW_RETENTION_RATIO of it
+#ifndef STRING_VIEW_RETENTION_MIN_PARENT_LENGTH
+#define STRING_VIEW_RETENTION_MIN_PARENT_LENGTH 1024 * 64
+#endif
+
+#ifndef STRING_VIEW_RETENTION_RATIO
+#define STRING_VIEW_RETENTION_RATIO 8
+#endif
+
+// RopeString is rebalanced when its depth exceeds this value
+#ifndef ROPE_STRING_MAX_DEPTH
+#define ROPE_STRING_MAX_DEPTH 48
+#endif
+
 #ifndef STRING_BUILDER_INLINE_STORAGE_DEFAULT
 #define STRING_BUILDER_INLINE_STORAGE_DEFAULT 24
 #endif
 
+// number of characters in each segment of ChunkedStringBuilder
+#ifndef STRING_BUILDER_SEGMENT_SIZE
+#define STRING_BUILDER_SEGMENT_SIZE 1024 * 64
+#endif
+
 #ifndef SCRIPT_FUNCTION_OBJECT_BYTECODE_SIZE_MAX
 #define SCRIPT_FUNCTION_OBJECT_BYTECODE_SIZE_MAX 1024 * 256
 #endif
 
+#ifndef SCRIPT_FUNCTION_OBJECT_BYTECODE_EVICTION_TARGET_SIZE
+#define SCRIPT_FUNCTION_OBJECT_BYTECODE_EVICTION_TARGET_SIZE 1024 * 128
+#endif
+
 #ifndef REGEXP_CACHE_SIZE_MAX
 #define REGEXP_CACHE_SIZE_MAX 64
 #endif
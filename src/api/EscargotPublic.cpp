@@ -67,8 +67,12 @@
 #include "runtime/BigIntObject.h"
 #include "runtime/SharedArrayBufferObject.h"
 #include "runtime/serialization/Serializer.h"
+#include "runtime/JSON.h"
+#include "runtime/SamplingProfiler.h"
 #include "interpreter/ByteCode.h"
+#include "interpreter/OpcodeStats.h"
 #include "api/internal/ValueAdapter.h"
+#include "heap/HeapSnapshot.h"
 #if defined(ENABLE_CODE_CACHE)
 #include "codecache/CodeCache.h"
 #endif
@@ -316,6 +320,40 @@ bool Globals::supportsThreading()
 #endif
 }
 
+bool Globals::supportsOpcodeStats()
+{
+#if defined(ENABLE_OPCODE_STATS)
+    return true;
+#else
+    return false;
+#endif
+}
+
+std::string Globals::dumpOpcodeStats()
+{
+#if defined(ENABLE_OPCODE_STATS)
+    return OpcodeStats::toJSON();
+#else
+    return std::string();
+#endif
+}
+
+void Globals::resetOpcodeStats()
+{
+#if defined(ENABLE_OPCODE_STATS)
+    OpcodeStats::reset();
+#endif
+}
+
+bool Globals::supportsSamplingProfiler()
+{
+#if defined(ENABLE_SAMPLING_PROFILER)
+    return true;
+#else
+    return false;
+#endif
+}
+
 const char* Globals::version()
 {
     return ESCARGOT_VERSION;
@@ -389,6 +427,76 @@ void Memory::setGCFrequency(size_t value)
     GC_set_free_space_divisor(value);
 }
 
+bool Memory::setGCCollectionMode(GCCollectionMode mode, size_t pauseTimeTargetInMilliseconds)
+{
+    return Heap::setCollectionMode(mode == INCREMENTAL ? Heap::Incremental : Heap::StopTheWorld, pauseTimeTargetInMilliseconds);
+}
+
+Memory::GCCollectionMode Memory::gcCollectionMode()
+{
+    return Heap::collectionMode() == Heap::Incremental ? INCREMENTAL : STOP_THE_WORLD;
+}
+
+Memory::GCPauseHistogram Memory::gcPauseHistogram()
+{
+    COMPILE_ASSERT((size_t)GCPauseHistogramBucketCount == (size_t)Heap::PauseHistogramBucketCount, "");
+    const Heap::PauseHistogram& histogram = Heap::pauseHistogram();
+    GCPauseHistogram result;
+    result.count = histogram.m_count;
+    result.totalMicroseconds = histogram.m_totalMicroseconds;
+    result.maxMicroseconds = histogram.m_maxMicroseconds;
+    result.lastMicroseconds = histogram.m_lastMicroseconds;
+    for (size_t i = 0; i < GCPauseHistogramBucketCount; i++) {
+        result.buckets[i] = histogram.m_buckets[i];
+    }
+    return result;
+}
+
+void Memory::resetGCPauseHistogram()
+{
+    Heap::resetPauseHistogram();
+}
+
+Memory::HeapStats Memory::heapStats(bool includeLiveObjectStats)
+{
+    HeapStats result;
+    memset(&result, 0, sizeof(HeapStats));
+    result.heapSize = GC_get_heap_size();
+    result.freeBytes = GC_get_free_bytes();
+    result.unmappedBytes = GC_get_unmapped_bytes();
+    result.bytesSinceGC = GC_get_bytes_since_gc();
+    result.gcCount = GC_get_gc_no();
+    result.totalGCPauseMicroseconds = Heap::pauseHistogram().m_totalMicroseconds;
+
+    if (includeLiveObjectStats) {
+        HeapObjectKindStats stats[HeapObjectKind::NumberOfKind];
+        collectHeapObjectKindStats(stats);
+
+        auto add = [](HeapObjectStats& to, const HeapObjectKindStats& from) {
+            to.count += from.m_count;
+            to.bytes += from.m_bytes;
+        };
+        add(result.valueVectors, stats[HeapObjectKind::ValueVectorKind]);
+#if defined(ESCARGOT_64) && defined(ESCARGOT_USE_32BIT_IN_64BIT)
+        add(result.valueVectors, stats[HeapObjectKind::EncodedSmallValueVectorKind]);
+#endif
+        add(result.getObjectInlineCaches, stats[HeapObjectKind::GetObjectInlineCacheDataVectorKind]);
+        add(result.setObjectInlineCaches, stats[HeapObjectKind::SetObjectInlineCacheDataVectorKind]);
+        add(result.arrayObjects, stats[HeapObjectKind::ArrayObjectKind]);
+#if !defined(NDEBUG)
+        add(result.interpretedCodeBlocks, stats[HeapObjectKind::InterpretedCodeBlockKind]);
+        add(result.interpretedCodeBlocks, stats[HeapObjectKind::InterpretedCodeBlockWithRareDataKind]);
+#endif
+    }
+
+    return result;
+}
+
+bool Memory::writeHeapSnapshot(int fd)
+{
+    return HeapSnapshot::write(fd);
+}
+
 size_t Memory::heapSize()
 {
     return GC_get_heap_size();
@@ -399,6 +507,17 @@ size_t Memory::totalSize()
     return GC_get_total_bytes();
 }
 
+Memory::StringViewStats Memory::stringViewStats()
+{
+    StringViewRetentionTracker* tracker = ThreadLocal::stringViewRetentionTracker();
+    StringViewStats stats;
+    stats.createdCount = tracker->createdCount();
+    stats.sharedBytes = tracker->sharedBytes();
+    stats.copiedCount = tracker->copiedCount();
+    stats.copiedBytes = tracker->copiedBytes();
+    return stats;
+}
+
 void Memory::addGCEventListener(GCEventType type, OnGCEventListener l, void* data)
 {
     GCEventListenerSet& list = ThreadLocal::gcEventListenerSet();
@@ -1257,6 +1376,105 @@ void VMInstanceRef::setMaxCompiledByteCodeSize(size_t s)
     toImpl(this)->setMaxCompiledByteCodeSize(s);
 }
 
+COMPILE_ASSERT((int)VMInstanceRef::EvictAll == (int)VMInstance::EvictAll, "");
+COMPILE_ASSERT((int)VMInstanceRef::EvictLeastRecentlyUsed == (int)VMInstance::EvictLeastRecentlyUsed, "");
+COMPILE_ASSERT((int)VMInstanceRef::EvictLeastFrequentlyUsed == (int)VMInstance::EvictLeastFrequentlyUsed, "");
+
+VMInstanceRef::ByteCodeEvictionPolicy VMInstanceRef::byteCodeEvictionPolicy()
+{
+    return (ByteCodeEvictionPolicy)toImpl(this)->byteCodeEvictionPolicy();
+}
+
+void VMInstanceRef::setByteCodeEvictionPolicy(ByteCodeEvictionPolicy policy)
+{
+    toImpl(this)->setByteCodeEvictionPolicy((VMInstance::ByteCodeEvictionPolicy)policy);
+}
+
+size_t VMInstanceRef::byteCodeEvictionTargetSize()
+{
+    return toImpl(this)->byteCodeEvictionTargetSize();
+}
+
+void VMInstanceRef::setByteCodeEvictionTargetSize(size_t s)
+{
+    toImpl(this)->setByteCodeEvictionTargetSize(s);
+}
+
+size_t VMInstanceRef::evictedByteCodeBlockCount()
+{
+    return toImpl(this)->evictedByteCodeBlockCount();
+}
+
+size_t VMInstanceRef::regeneratedByteCodeBlockCount()
+{
+    return toImpl(this)->regeneratedByteCodeBlockCount();
+}
+
+size_t VMInstanceRef::megamorphicCacheHitCount()
+{
+    return toImpl(this)->getObjectMegamorphicCacheHitCount();
+}
+
+size_t VMInstanceRef::megamorphicCacheMissCount()
+{
+    return toImpl(this)->getObjectMegamorphicCacheMissCount();
+}
+
+VMInstanceRef::Stats VMInstanceRef::stats()
+{
+    VMInstance* instance = toImpl(this);
+    Stats result;
+    memset(&result, 0, sizeof(Stats));
+    result.compiledByteCodeSize = instance->compiledByteCodeSize();
+    result.compiledByteCodeBlockCount = instance->compiledByteCodeBlocks().size();
+    result.regexpCacheSize = instance->regexpCacheSize();
+
+#if defined(ENABLE_COMPRESSIBLE_STRING)
+    auto& compressibleStrings = instance->compressibleStrings();
+    result.compressibleStringCount = compressibleStrings.size();
+    for (size_t i = 0; i < compressibleStrings.size(); i++) {
+        if (compressibleStrings[i]->isCompressed()) {
+            result.compressedStringCount++;
+        }
+    }
+    result.compressibleStringsUncompressedBytes = instance->compressibleStringsUncomressedBufferSize();
+#endif
+
+#if defined(ENABLE_RELOADABLE_STRING)
+    auto& reloadableStrings = instance->reloadableStrings();
+    result.reloadableStringCount = reloadableStrings.size();
+    for (size_t i = 0; i < reloadableStrings.size(); i++) {
+        if (reloadableStrings[i]->isUnloaded()) {
+            result.unloadedStringCount++;
+        }
+    }
+#endif
+
+    return result;
+}
+
+COMPILE_ASSERT((int)VMInstanceRef::ChromeCPUProfile == (int)SamplingProfiler::ChromeCPUProfile, "");
+COMPILE_ASSERT((int)VMInstanceRef::FoldedStacks == (int)SamplingProfiler::FoldedStacks, "");
+
+void VMInstanceRef::startProfiling(unsigned samplingIntervalInMicroseconds)
+{
+    toImpl(this)->startProfiling(samplingIntervalInMicroseconds);
+}
+
+bool VMInstanceRef::isProfiling()
+{
+    return toImpl(this)->isProfiling();
+}
+
+std::string VMInstanceRef::stopProfiling(ProfileFormat format)
+{
+    SamplingProfiler* profiler = toImpl(this)->stopProfiling();
+    if (!profiler) {
+        return std::string();
+    }
+    return profiler->output((SamplingProfiler::OutputFormat)format);
+}
+
 #if defined(ENABLE_CODE_CACHE)
 bool VMInstanceRef::isCodeCacheEnabled()
 {
@@ -1292,6 +1510,11 @@ void VMInstanceRef::setCodeCacheShouldLoadFunctionOnScriptLoading(bool s)
 {
     toImpl(this)->codeCache()->setShouldLoadFunctionOnScriptLoading(s);
 }
+
+void VMInstanceRef::flushCodeCache()
+{
+    toImpl(this)->codeCache()->flush();
+}
 #else // ENABLE_CODE_CACHE
 bool VMInstanceRef::isCodeCacheEnabled()
 {
@@ -1333,6 +1556,11 @@ void VMInstanceRef::setCodeCacheShouldLoadFunctionOnScriptLoading(bool s)
     ESCARGOT_LOG_ERROR("If you want to use this function, you should enable code cache");
     RELEASE_ASSERT_NOT_REACHED();
 }
+
+void VMInstanceRef::flushCodeCache()
+{
+    // nothing to write
+}
 #endif // ENABLE_CODE_CACHE
 
 #ifdef ESCARGOT_DEBUGGER
@@ -4631,6 +4859,7 @@ ScriptParserRef::InitializeScriptResult::InitializeScriptResult()
     : script()
     , parseErrorMessage(StringRef::emptyString())
     , parseErrorCode(ErrorObjectRef::Code::None)
+    , loadedFromCodeCache(false)
 {
 }
 
@@ -4657,6 +4886,7 @@ ScriptParserRef::InitializeScriptResult ScriptParserRef::initializeScript(String
     ScriptParserRef::InitializeScriptResult result;
     if (internalResult.script) {
         result.script = toRef(internalResult.script.value());
+        result.loadedFromCodeCache = internalResult.loadedFromCodeCache;
     } else {
         result.parseErrorMessage = toRef(internalResult.parseErrorMessage);
         result.parseErrorCode = (Escargot::ErrorObjectRef::Code)internalResult.parseErrorCode;
@@ -4665,6 +4895,38 @@ ScriptParserRef::InitializeScriptResult ScriptParserRef::initializeScript(String
     return result;
 }
 
+ScriptParserRef::InitializeScriptResult ScriptParserRef::initializeScript(StringRef* source, StringRef* srcName, const char* codeCacheData, size_t codeCacheDataSize)
+{
+#if defined(ENABLE_CODE_CACHE)
+    auto internalResult = toImpl(this)->initializeScriptWithCodeCacheData(toImpl(source), toImpl(srcName), codeCacheData, codeCacheDataSize);
+    ScriptParserRef::InitializeScriptResult result;
+    if (internalResult.script) {
+        result.script = toRef(internalResult.script.value());
+        result.loadedFromCodeCache = internalResult.loadedFromCodeCache;
+    } else {
+        result.parseErrorMessage = toRef(internalResult.parseErrorMessage);
+        result.parseErrorCode = (Escargot::ErrorObjectRef::Code)internalResult.parseErrorCode;
+    }
+
+    return result;
+#else
+    UNUSED_PARAMETER(codeCacheData);
+    UNUSED_PARAMETER(codeCacheDataSize);
+    return initializeScript(source, srcName, false);
+#endif
+}
+
+std::string ScriptParserRef::createCodeCacheData(ScriptRef* script)
+{
+    std::string data;
+#if defined(ENABLE_CODE_CACHE)
+    toImpl(this)->createCodeCacheData(toImpl(script), data);
+#else
+    UNUSED_PARAMETER(script);
+#endif
+    return data;
+}
+
 ScriptParserRef::InitializeFunctionScriptResult ScriptParserRef::initializeFunctionScript(StringRef* sourceName, AtomicStringRef* functionName, size_t argumentCount, ValueRef** argumentNameArray, ValueRef* functionBody)
 {
     // temporal ExecutionState
@@ -4837,6 +5099,41 @@ ValueRef* SerializerRef::deserializeFrom(ContextRef* context, std::istringstream
     return toRef(result.result);
 }
 
+ValueRef* JSONRef::stringify(ExecutionStateRef* state, ValueRef* value, ValueRef* replacer, ValueRef* space)
+{
+    return toRef(JSON::stringify(*toImpl(state), toImpl(value), toImpl(replacer), toImpl(space)));
+}
+
+bool JSONRef::stringify(ExecutionStateRef* state, ValueRef* value, ValueRef* replacer, ValueRef* space, StringifyChunkCallback callback, void* data)
+{
+    struct SinkData {
+        ExecutionStateRef* state;
+        StringifyChunkCallback callback;
+        void* data;
+    } sinkData = { state, callback, data };
+
+    return JSON::stringify(*toImpl(state), toImpl(value), toImpl(replacer), toImpl(space), [](String* segment, void* data) {
+        SinkData* sinkData = (SinkData*)data;
+        sinkData->callback(sinkData->state, toRef(segment), sinkData->data);
+    },
+                           &sinkData);
+}
+
+PersistentRefHolder<JSONParserRef> JSONParserRef::create()
+{
+    return PersistentRefHolder<JSONParserRef>(toRef(new JSONParser()));
+}
+
+void JSONParserRef::parseChunk(ExecutionStateRef* state, const char* utf8, size_t length)
+{
+    toImpl(this)->parseChunk(*toImpl(state), utf8, length);
+}
+
+ValueRef* JSONParserRef::finish(ExecutionStateRef* state)
+{
+    return toRef(toImpl(this)->finish(*toImpl(state)));
+}
+
 bool WASMOperationsRef::isWASMOperationsEnabled()
 {
 #if defined(ENABLE_WASM)
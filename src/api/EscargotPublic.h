@@ -104,6 +104,7 @@
     F(Context)                              \
     F(ExecutionState)                       \
     F(FunctionTemplate)                     \
+    F(JSONParser)                           \
     F(ObjectTemplate)                       \
     F(PointerValue)                         \
     F(RopeString)                           \
@@ -141,6 +142,17 @@ public:
 
     static bool supportsThreading();
 
+    // opcode dispatch, slow path and inline cache counters of ESCARGOT_OPCODE_STATS build
+    // dumpOpcodeStats returns a JSON string (empty string if not supported)
+    // counters are process-wide
+    static bool supportsOpcodeStats();
+    static std::string dumpOpcodeStats();
+    static void resetOpcodeStats();
+
+    // VMInstanceRef::startProfiling works only in ESCARGOT_SAMPLING_PROFILER build
+    // because other builds have no safepoint in the interpreter
+    static bool supportsSamplingProfiler();
+
     static const char* version();
     static const char* buildDate();
 };
@@ -172,6 +184,15 @@ public:
     static size_t heapSize(); // Return the number of bytes in the heap.  Excludes bdwgc private data structures. Excludes the unmapped memory
     static size_t totalSize(); // Return the total number of bytes allocated in this process
 
+    // substrings sharing the buffer of their parent string on the current thread
+    struct StringViewStats {
+        size_t createdCount;
+        size_t sharedBytes; // bytes not copied by sharing
+        size_t copiedCount; // substrings copied at creation instead of retaining a much longer parent
+        size_t copiedBytes;
+    };
+    static StringViewStats stringViewStats();
+
     enum GCEventType {
         MARK_START,
         MARK_END,
@@ -187,6 +208,65 @@ public:
     // (Allocated memory by GC x 2) / (Frequency parameter value)
     // Increasing this value may use less space but there is more collection event
     static void setGCFrequency(size_t value = 1);
+
+    enum GCCollectionMode {
+        // each collection marks with an unlimited time slice
+        STOP_THE_WORLD,
+        // mark in short steps between allocations. each step tries to finish within the pause time target
+        // objects modified during marking are found by dirty bits of OS pages (soft-dirty bits on Linux,
+        // GetWriteWatch on Windows, page protection elsewhere) instead of write barriers
+        // with page protection, a system call must not write into GC heap memory that may hold pointers
+        INCREMENTAL,
+    };
+    // process-wide and one-way: the gc library cannot leave incremental mode once it is entered
+    // pauseTimeTarget of 0 means an unlimited time slice
+    // returns false if the gc library is built without dirty bit support needed by incremental mode
+    // STOP_THE_WORLD after INCREMENTAL sets an unlimited time slice so each collection finishes at once,
+    // but dirty bits are still tracked and gcCollectionMode keeps returning INCREMENTAL
+    static bool setGCCollectionMode(GCCollectionMode mode, size_t pauseTimeTargetInMilliseconds = 0);
+    // returns INCREMENTAL once incremental mode is entered
+    static GCCollectionMode gcCollectionMode();
+
+    // pauses of the gc on the current thread. every time the world is stopped and every reclaim phase is a sample
+    // mark steps done inside allocations while the world runs are not reported by the gc library, so they are not counted
+    // a sample is recorded when its pause ends, so RECLAIM_END listeners can read the reclaim phase just finished
+    enum { GCPauseHistogramBucketCount = 10 };
+    struct GCPauseHistogram {
+        size_t count;
+        uint64_t totalMicroseconds;
+        uint64_t maxMicroseconds;
+        uint64_t lastMicroseconds;
+        // buckets[i] counts pauses shorter than 2^i ms. the last bucket counts the others
+        size_t buckets[GCPauseHistogramBucketCount];
+    };
+    static GCPauseHistogram gcPauseHistogram();
+    static void resetGCPauseHistogram();
+
+    struct HeapObjectStats {
+        size_t count;
+        size_t bytes;
+    };
+    struct HeapStats {
+        size_t heapSize;
+        size_t freeBytes;
+        size_t unmappedBytes;
+        size_t bytesSinceGC;
+        size_t gcCount;
+        uint64_t totalGCPauseMicroseconds; // since the last resetGCPauseHistogram
+        // live objects of each kind as marked by the last GC. filled only if includeLiveObjectStats is true
+        HeapObjectStats valueVectors;
+        HeapObjectStats getObjectInlineCaches;
+        HeapObjectStats setObjectInlineCaches;
+        HeapObjectStats arrayObjects;
+        HeapObjectStats interpretedCodeBlocks; // counted only in debug build
+    };
+    // snapshot of the heap of the current thread. it does not collect
+    // includeLiveObjectStats walks the heap, which takes time proportional to heap size
+    static HeapStats heapStats(bool includeLiveObjectStats = false);
+
+    // runs a full GC and writes the heap of the current thread to fd in Chrome DevTools .heapsnapshot format
+    // the snapshot is written in pieces, not built as a whole in memory. returns false if writing failed
+    static bool writeHeapSnapshot(int fd);
 };
 
 // NOTE only {stack, kinds of PersistentHolders} are root set. if you store the data you need on other space, you may lost your data
@@ -727,6 +807,53 @@ public:
     size_t maxCompiledByteCodeSize();
     void setMaxCompiledByteCodeSize(size_t s);
 
+    // when compiled bytecode exceeds maxCompiledByteCodeSize,
+    // bytecode of functions is released at GC and regenerated on the next call
+    // hotness for LRU and LFU is sampled on every GC once compiled bytecode exceeds byteCodeEvictionTargetSize
+    enum ByteCodeEvictionPolicy {
+        EvictAll, // release bytecode of every function (default)
+        EvictLeastRecentlyUsed, // release bytecode of functions not called for the most GCs first
+        EvictLeastFrequentlyUsed, // release bytecode of functions called in the fewest of recent 32 GCs first
+    };
+    ByteCodeEvictionPolicy byteCodeEvictionPolicy();
+    void setByteCodeEvictionPolicy(ByteCodeEvictionPolicy policy);
+    // LRU and LFU policies release bytecode until compiled bytecode goes down to this size
+    size_t byteCodeEvictionTargetSize();
+    void setByteCodeEvictionTargetSize(size_t s);
+    size_t evictedByteCodeBlockCount();
+    size_t regeneratedByteCodeBlockCount();
+
+    // statistics of VM-wide cache used by megamorphic property load sites
+    size_t megamorphicCacheHitCount();
+    size_t megamorphicCacheMissCount();
+
+    struct Stats {
+        size_t compiledByteCodeSize;
+        size_t compiledByteCodeBlockCount;
+        size_t regexpCacheSize;
+        // zero if compressible or reloadable string is disabled in this build
+        size_t compressibleStringCount;
+        size_t compressedStringCount;
+        size_t compressibleStringsUncompressedBytes;
+        size_t reloadableStringCount;
+        size_t unloadedStringCount;
+    };
+    Stats stats();
+
+    // sampling cpu profiler
+    // samples are taken at function entries and jumps of JavaScript code,
+    // so time spent in a long native call is credited to the next sample
+    enum ProfileFormat {
+        ChromeCPUProfile, // JSON of Chrome DevTools .cpuprofile
+        FoldedStacks, // one `frame;frame;...;frame count` line per stack
+    };
+    // samples of previous profiling are discarded
+    // does nothing if Globals::supportsSamplingProfiler() is false
+    void startProfiling(unsigned samplingIntervalInMicroseconds = 1000);
+    bool isProfiling();
+    // returns empty string if profiling is not running
+    std::string stopProfiling(ProfileFormat format = ChromeCPUProfile);
+
     bool isCodeCacheEnabled();
     size_t codeCacheMinSourceLength();
     void setCodeCacheMinSourceLength(size_t s);
@@ -734,6 +861,9 @@ public:
     void setCodeCacheMaxCacheCount(size_t s);
     bool codeCacheShouldLoadFunctionOnScriptLoading();
     void setCodeCacheShouldLoadFunctionOnScriptLoading(bool s);
+    // cache files are written on a background thread
+    // wait until every pending cache file is written (e.g. before shutdown)
+    void flushCodeCache();
 };
 
 class ESCARGOT_EXPORT DebuggerOperationsRef {
@@ -2090,6 +2220,34 @@ public:
     static ValueRef* deserializeFrom(ContextRef* context, std::istringstream& input);
 };
 
+class ESCARGOT_EXPORT JSONRef {
+public:
+    // same as JSON.stringify(value, replacer, space)
+    static ValueRef* stringify(ExecutionStateRef* state, ValueRef* value, ValueRef* replacer, ValueRef* space);
+
+    // serializes value without creating the whole result string
+    // each chunk of the result is passed to the callback in order as it is produced
+    // a chunk never ends in the middle of a surrogate pair
+    // if serialization throws (e.g. toJSON throws or a cycle is found), chunks passed to the callback before stay delivered,
+    // so the callback owner should discard the partial output
+    // returns false if value is not serializable (JSON.stringify returns undefined)
+    typedef void (*StringifyChunkCallback)(ExecutionStateRef* state, StringRef* chunk, void* data);
+    static bool stringify(ExecutionStateRef* state, ValueRef* value, ValueRef* replacer, ValueRef* space, StringifyChunkCallback callback, void* data);
+};
+
+// JSONParserRef parses JSON text that arrives in chunks of UTF-8 bytes
+// each chunk is parsed when it is given and values are built as soon as their tokens are complete,
+// so a chunk may end anywhere, even in the middle of a token or a UTF-8 sequence
+// parseChunk and finish throw SyntaxError on malformed input. the parser must not be used after that
+class ESCARGOT_EXPORT JSONParserRef {
+public:
+    static PersistentRefHolder<JSONParserRef> create();
+
+    void parseChunk(ExecutionStateRef* state, const char* utf8, size_t length);
+    // returns the parsed value. the parser can be used for the next text after this
+    ValueRef* finish(ExecutionStateRef* state);
+};
+
 class ESCARGOT_EXPORT ScriptParserRef {
 public:
     struct ESCARGOT_EXPORT InitializeScriptResult {
@@ -2101,6 +2259,8 @@ public:
         OptionalRef<ScriptRef> script;
         StringRef* parseErrorMessage;
         ErrorObjectRef::Code parseErrorCode;
+        // script is loaded from code cache instead of parsing the source code
+        bool loadedFromCodeCache;
 
         InitializeScriptResult();
         ScriptRef* fetchScriptThrowsExceptionIfParseError(ExecutionStateRef* state);
@@ -2123,6 +2283,13 @@ public:
 
     // parse the input source code and return the result (Script)
     InitializeScriptResult initializeScript(StringRef* sourceCode, StringRef* srcName, bool isModule = false);
+    // parse the input source code with code cache data made by createCodeCacheData
+    // code cache data is checked with Escargot version and the source code, and the source code is parsed instead on mismatch
+    // code cache data is not referenced after this call
+    InitializeScriptResult initializeScript(StringRef* sourceCode, StringRef* srcName, const char* codeCacheData, size_t codeCacheDataSize);
+    // serialize bytecode of global code and every function of script into code cache data without using cache directory
+    // returns empty string for module script or if code cache is not supported (ENABLE_CODE_CACHE)
+    std::string createCodeCacheData(ScriptRef* script);
     // convert the input body source into a function and parse it
     // generate Script and FunctionObject
     InitializeFunctionScriptResult initializeFunctionScript(StringRef* sourceName, AtomicStringRef* functionName, size_t argumentCount, ValueRef** argumentNameArray, ValueRef* functionBody);
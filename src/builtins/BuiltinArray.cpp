@@ -371,7 +371,8 @@ static Value builtinArrayJoin(ExecutionState& state, Value thisValue, size_t arg
     }
     ToStringRecursionPreventerItemAutoHolder holder(state, thisBinded);
 
-    StringBuilder builder;
+    // elements are copied into segments as they are joined instead of keeping every element until finalize
+    ChunkedStringBuilder builder;
     int64_t prevIndex = 0;
     int64_t curIndex = 0;
     while (curIndex < len) {
@@ -389,6 +390,9 @@ static Value builtinArrayJoin(ExecutionState& state, Value thisValue, size_t arg
 
         if (!elem.isUndefinedOrNull()) {
             builder.appendString(elem.toString(state));
+            if (UNLIKELY(builder.contentLength() > STRING_MAXIMUM_LENGTH)) {
+                ErrorObject::throwBuiltinError(state, ErrorCode::RangeError, ErrorObject::Messages::String_InvalidStringLength);
+            }
         }
         prevIndex = curIndex;
         if (elem.isUndefined()) {
@@ -2068,19 +2072,11 @@ static Value builtinArrayFindLastIndex(ExecutionState& state, Value thisValue, s
 
 void GlobalObject::initializeArray(ExecutionState& state)
 {
-    ObjectPropertyNativeGetterSetterData* nativeData = new ObjectPropertyNativeGetterSetterData(true, false, true,
-                                                                                                [](ExecutionState& state, Object* self, const Value& receiver, const EncodedValue& privateDataFromObjectPrivateArea) -> Value {
-                                                                                                    ASSERT(self->isGlobalObject());
-                                                                                                    return self->asGlobalObject()->array();
-                                                                                                },
-                                                                                                nullptr);
-
-    defineNativeDataAccessorProperty(state, ObjectPropertyName(state.context()->staticStrings().Array), nativeData, Value(Value::EmptyValue));
+    defineBuiltinPlaceholder<FunctionObject, &GlobalObject::array>(state, ObjectPropertyName(state.context()->staticStrings().Array));
 }
 
 void GlobalObject::installArray(ExecutionState& state)
 {
-    ASSERT(!!m_iteratorPrototype);
     ASSERT(!!m_arrayToString);
 
     m_array = new NativeFunctionObject(state, NativeFunctionInfo(state.context()->staticStrings().Array, builtinArrayConstructor, 1), NativeFunctionObject::__ForBuiltinConstructor__);
@@ -2219,7 +2215,7 @@ void GlobalObject::installArray(ExecutionState& state)
 
     m_array->setFunctionPrototype(state, m_arrayPrototype);
 
-    m_arrayIteratorPrototype = new PrototypeObject(state, m_iteratorPrototype);
+    m_arrayIteratorPrototype = new PrototypeObject(state, iteratorPrototype());
     m_arrayIteratorPrototype->setGlobalIntrinsicObject(state, true);
 
     m_arrayIteratorPrototype->directDefineOwnProperty(state, ObjectPropertyName(state.context()->staticStrings().next),
@@ -2227,7 +2223,7 @@ void GlobalObject::installArray(ExecutionState& state)
     m_arrayIteratorPrototype->directDefineOwnProperty(state, ObjectPropertyName(state.context()->vmInstance()->globalSymbols().toStringTag),
                                                       ObjectPropertyDescriptor(Value(String::fromASCII("Array Iterator")), (ObjectPropertyDescriptor::PresentAttribute)(ObjectPropertyDescriptor::ConfigurablePresent)));
 
-    redefineOwnProperty(state, ObjectPropertyName(state.context()->staticStrings().Array),
+    replaceBuiltinValue(state, ObjectPropertyName(state.context()->staticStrings().Array),
                         ObjectPropertyDescriptor(m_array, (ObjectPropertyDescriptor::PresentAttribute)(ObjectPropertyDescriptor::WritablePresent | ObjectPropertyDescriptor::ConfigurablePresent)));
 }
 } // namespace Escargot
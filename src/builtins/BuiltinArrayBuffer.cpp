@@ -223,14 +223,7 @@ static Value builtinArrayBufferSlice(ExecutionState& state, Value thisValue, siz
 
 void GlobalObject::initializeArrayBuffer(ExecutionState& state)
 {
-    ObjectPropertyNativeGetterSetterData* nativeData = new ObjectPropertyNativeGetterSetterData(true, false, true,
-                                                                                                [](ExecutionState& state, Object* self, const Value& receiver, const EncodedValue& privateDataFromObjectPrivateArea) -> Value {
-                                                                                                    ASSERT(self->isGlobalObject());
-                                                                                                    return self->asGlobalObject()->arrayBuffer();
-                                                                                                },
-                                                                                                nullptr);
-
-    defineNativeDataAccessorProperty(state, ObjectPropertyName(state.context()->staticStrings().ArrayBuffer), nativeData, Value(Value::EmptyValue));
+    defineBuiltinPlaceholder<FunctionObject, &GlobalObject::arrayBuffer>(state, ObjectPropertyName(state.context()->staticStrings().ArrayBuffer));
 }
 
 void GlobalObject::installArrayBuffer(ExecutionState& state)
@@ -296,7 +289,7 @@ void GlobalObject::installArrayBuffer(ExecutionState& state)
 
     m_arrayBuffer->setFunctionPrototype(state, m_arrayBufferPrototype);
 
-    redefineOwnProperty(state, ObjectPropertyName(strings->ArrayBuffer),
+    replaceBuiltinValue(state, ObjectPropertyName(strings->ArrayBuffer),
                         ObjectPropertyDescriptor(m_arrayBuffer, (ObjectPropertyDescriptor::PresentAttribute)(ObjectPropertyDescriptor::WritablePresent | ObjectPropertyDescriptor::ConfigurablePresent)));
 }
 } // namespace Escargot
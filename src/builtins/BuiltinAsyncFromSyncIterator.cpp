@@ -275,10 +275,8 @@ void GlobalObject::initializeAsyncFromSyncIterator(ExecutionState& state)
 
 void GlobalObject::installAsyncFromSyncIterator(ExecutionState& state)
 {
-    ASSERT(!!m_asyncIteratorPrototype);
-
     // https://www.ecma-international.org/ecma-262/10.0/#sec-%asyncfromsynciteratorprototype%-object
-    m_asyncFromSyncIteratorPrototype = new PrototypeObject(state, m_asyncIteratorPrototype);
+    m_asyncFromSyncIteratorPrototype = new PrototypeObject(state, asyncIteratorPrototype());
     m_asyncFromSyncIteratorPrototype->setGlobalIntrinsicObject(state, true);
 
     m_asyncFromSyncIteratorPrototype->directDefineOwnProperty(state, ObjectPropertyName(state.context()->vmInstance()->globalSymbols().toStringTag),
@@ -66,8 +66,6 @@ void GlobalObject::initializeAsyncGenerator(ExecutionState& state)
 
 void GlobalObject::installAsyncGenerator(ExecutionState& state)
 {
-    ASSERT(!!m_asyncIteratorPrototype);
-
     // https://www.ecma-international.org/ecma-262/10.0/index.html#sec-asyncgeneratorfunction
     m_asyncGeneratorFunction = new NativeFunctionObject(state, NativeFunctionInfo(state.context()->staticStrings().AsyncGeneratorFunction, builtinAsyncGeneratorFunction, 1), NativeFunctionObject::__ForBuiltinConstructor__);
     m_asyncGeneratorFunction->setGlobalIntrinsicObject(state);
@@ -86,7 +84,7 @@ void GlobalObject::installAsyncGenerator(ExecutionState& state)
                                               ObjectPropertyDescriptor(state.context()->staticStrings().AsyncGeneratorFunction.string(), ObjectPropertyDescriptor::ConfigurablePresent));
 
     // https://www.ecma-international.org/ecma-262/10.0/index.html#sec-properties-of-asyncgenerator-prototype
-    m_asyncGeneratorPrototype = new PrototypeObject(state, m_asyncIteratorPrototype);
+    m_asyncGeneratorPrototype = new PrototypeObject(state, asyncIteratorPrototype());
     m_asyncGeneratorPrototype->setGlobalIntrinsicObject(state, true);
 
     m_asyncGenerator->directDefineOwnProperty(state, ObjectPropertyName(state.context()->staticStrings().prototype), ObjectPropertyDescriptor(m_asyncGeneratorPrototype, ObjectPropertyDescriptor::ConfigurablePresent));
@@ -579,14 +579,7 @@ static Value builtinAtomicsIsLockFree(ExecutionState& state, Value thisValue, si
 
 void GlobalObject::initializeAtomics(ExecutionState& state)
 {
-    ObjectPropertyNativeGetterSetterData* nativeData = new ObjectPropertyNativeGetterSetterData(true, false, true,
-                                                                                                [](ExecutionState& state, Object* self, const Value& receiver, const EncodedValue& privateDataFromObjectPrivateArea) -> Value {
-                                                                                                    ASSERT(self->isGlobalObject());
-                                                                                                    return self->asGlobalObject()->atomics();
-                                                                                                },
-                                                                                                nullptr);
-
-    defineNativeDataAccessorProperty(state, ObjectPropertyName(state.context()->staticStrings().Atomics), nativeData, Value(Value::EmptyValue));
+    defineBuiltinPlaceholder<Object, &GlobalObject::atomics>(state, ObjectPropertyName(state.context()->staticStrings().Atomics));
 }
 
 void GlobalObject::installAtomics(ExecutionState& state)
@@ -636,7 +629,7 @@ void GlobalObject::installAtomics(ExecutionState& state)
     m_atomics->directDefineOwnProperty(state, ObjectPropertyName(state.context()->staticStrings().notify),
                                        ObjectPropertyDescriptor(new NativeFunctionObject(state, NativeFunctionInfo(state.context()->staticStrings().notify, builtinAtomicsNotify, 3, NativeFunctionInfo::Strict)), (ObjectPropertyDescriptor::PresentAttribute)(ObjectPropertyDescriptor::WritablePresent | ObjectPropertyDescriptor::ConfigurablePresent)));
 
-    redefineOwnProperty(state, ObjectPropertyName(state.context()->staticStrings().Atomics),
+    replaceBuiltinValue(state, ObjectPropertyName(state.context()->staticStrings().Atomics),
                         ObjectPropertyDescriptor(m_atomics, (ObjectPropertyDescriptor::PresentAttribute)(ObjectPropertyDescriptor::WritablePresent | ObjectPropertyDescriptor::ConfigurablePresent)));
 }
 #else
@@ -188,14 +188,7 @@ static Value builtinBigIntToLocaleString(ExecutionState& state, Value thisValue,
 
 void GlobalObject::initializeBigInt(ExecutionState& state)
 {
-    ObjectPropertyNativeGetterSetterData* nativeData = new ObjectPropertyNativeGetterSetterData(true, false, true,
-                                                                                                [](ExecutionState& state, Object* self, const Value& receiver, const EncodedValue& privateDataFromObjectPrivateArea) -> Value {
-                                                                                                    ASSERT(self->isGlobalObject());
-                                                                                                    return self->asGlobalObject()->bigInt();
-                                                                                                },
-                                                                                                nullptr);
-
-    defineNativeDataAccessorProperty(state, ObjectPropertyName(state.context()->staticStrings().BigInt), nativeData, Value(Value::EmptyValue));
+    defineBuiltinPlaceholder<FunctionObject, &GlobalObject::bigInt>(state, ObjectPropertyName(state.context()->staticStrings().BigInt));
 }
 
 void GlobalObject::installBigInt(ExecutionState& state)
@@ -236,7 +229,7 @@ void GlobalObject::installBigInt(ExecutionState& state)
 
     m_bigIntProxyObject = new BigIntObject(state, new BigInt(UINT64_C(0)));
 
-    redefineOwnProperty(state, ObjectPropertyName(state.context()->staticStrings().BigInt),
+    replaceBuiltinValue(state, ObjectPropertyName(state.context()->staticStrings().BigInt),
                         ObjectPropertyDescriptor(m_bigInt, (ObjectPropertyDescriptor::PresentAttribute)(ObjectPropertyDescriptor::WritablePresent | ObjectPropertyDescriptor::ConfigurablePresent)));
 }
 } // namespace Escargot
@@ -63,14 +63,7 @@ static Value builtinBooleanToString(ExecutionState& state, Value thisValue, size
 
 void GlobalObject::initializeBoolean(ExecutionState& state)
 {
-    ObjectPropertyNativeGetterSetterData* nativeData = new ObjectPropertyNativeGetterSetterData(true, false, true,
-                                                                                                [](ExecutionState& state, Object* self, const Value& receiver, const EncodedValue& privateDataFromObjectPrivateArea) -> Value {
-                                                                                                    ASSERT(self->isGlobalObject());
-                                                                                                    return self->asGlobalObject()->boolean();
-                                                                                                },
-                                                                                                nullptr);
-
-    defineNativeDataAccessorProperty(state, ObjectPropertyName(state.context()->staticStrings().Boolean), nativeData, Value(Value::EmptyValue));
+    defineBuiltinPlaceholder<FunctionObject, &GlobalObject::boolean>(state, ObjectPropertyName(state.context()->staticStrings().Boolean));
 }
 
 void GlobalObject::installBoolean(ExecutionState& state)
@@ -96,7 +89,7 @@ void GlobalObject::installBoolean(ExecutionState& state)
 
     m_booleanProxyObject = new BooleanObject(state);
 
-    redefineOwnProperty(state, ObjectPropertyName(strings->Boolean),
+    replaceBuiltinValue(state, ObjectPropertyName(strings->Boolean),
                         ObjectPropertyDescriptor(m_boolean, (ObjectPropertyDescriptor::PresentAttribute)(ObjectPropertyDescriptor::WritablePresent | ObjectPropertyDescriptor::ConfigurablePresent)));
 }
 } // namespace Escargot
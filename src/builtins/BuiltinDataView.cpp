@@ -160,14 +160,7 @@ static Value builtinDataViewByteOffsetGetter(ExecutionState& state, Value thisVa
 
 void GlobalObject::initializeDataView(ExecutionState& state)
 {
-    ObjectPropertyNativeGetterSetterData* nativeData = new ObjectPropertyNativeGetterSetterData(true, false, true,
-                                                                                                [](ExecutionState& state, Object* self, const Value& receiver, const EncodedValue& privateDataFromObjectPrivateArea) -> Value {
-                                                                                                    ASSERT(self->isGlobalObject());
-                                                                                                    return self->asGlobalObject()->dataView();
-                                                                                                },
-                                                                                                nullptr);
-
-    defineNativeDataAccessorProperty(state, ObjectPropertyName(state.context()->staticStrings().DataView), nativeData, Value(Value::EmptyValue));
+    defineBuiltinPlaceholder<FunctionObject, &GlobalObject::dataView>(state, ObjectPropertyName(state.context()->staticStrings().DataView));
 }
 
 void GlobalObject::installDataView(ExecutionState& state)
@@ -221,7 +214,7 @@ void GlobalObject::installDataView(ExecutionState& state)
         m_dataViewPrototype->directDefineOwnProperty(state, ObjectPropertyName(strings->byteOffset), byteOffsetDesc);
     }
 
-    redefineOwnProperty(state, ObjectPropertyName(state.context()->staticStrings().DataView),
+    replaceBuiltinValue(state, ObjectPropertyName(state.context()->staticStrings().DataView),
                         ObjectPropertyDescriptor(m_dataView, (ObjectPropertyDescriptor::PresentAttribute)(ObjectPropertyDescriptor::WritablePresent | ObjectPropertyDescriptor::ConfigurablePresent)));
 }
 } // namespace Escargot
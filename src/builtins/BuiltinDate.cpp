@@ -506,14 +506,7 @@ static Value builtinDateToPrimitive(ExecutionState& state, Value thisValue, size
 
 void GlobalObject::initializeDate(ExecutionState& state)
 {
-    ObjectPropertyNativeGetterSetterData* nativeData = new ObjectPropertyNativeGetterSetterData(true, false, true,
-                                                                                                [](ExecutionState& state, Object* self, const Value& receiver, const EncodedValue& privateDataFromObjectPrivateArea) -> Value {
-                                                                                                    ASSERT(self->isGlobalObject());
-                                                                                                    return self->asGlobalObject()->date();
-                                                                                                },
-                                                                                                nullptr);
-
-    defineNativeDataAccessorProperty(state, ObjectPropertyName(state.context()->staticStrings().Date), nativeData, Value(Value::EmptyValue));
+    defineBuiltinPlaceholder<FunctionObject, &GlobalObject::date>(state, ObjectPropertyName(state.context()->staticStrings().Date));
 }
 
 void GlobalObject::installDate(ExecutionState& state)
@@ -604,7 +597,7 @@ void GlobalObject::installDate(ExecutionState& state)
 
     m_date->setFunctionPrototype(state, m_datePrototype);
 
-    redefineOwnProperty(state, ObjectPropertyName(state.context()->staticStrings().Date),
+    replaceBuiltinValue(state, ObjectPropertyName(state.context()->staticStrings().Date),
                         ObjectPropertyDescriptor(m_date, (ObjectPropertyDescriptor::PresentAttribute)(ObjectPropertyDescriptor::WritablePresent | ObjectPropertyDescriptor::ConfigurablePresent)));
 }
 } // namespace Escargot
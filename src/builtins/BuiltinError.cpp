@@ -211,16 +211,8 @@ static Value builtinErrorToString(ExecutionState& state, Value thisValue, size_t
 
 void GlobalObject::initializeError(ExecutionState& state)
 {
-#define DEFINE_ERROR_INIT(errorname, bname)                                                                                                                                                                                         \
-    {                                                                                                                                                                                                                               \
-        ObjectPropertyNativeGetterSetterData* nativeData = new ObjectPropertyNativeGetterSetterData(true, false, true,                                                                                                              \
-                                                                                                    [](ExecutionState& state, Object* self, const Value& receiver, const EncodedValue& privateDataFromObjectPrivateArea) -> Value { \
-                                                                                                        ASSERT(self->isGlobalObject());                                                                                             \
-                                                                                                        return self->asGlobalObject()->errorname##Error();                                                                          \
-                                                                                                    },                                                                                                                              \
-                                                                                                    nullptr);                                                                                                                       \
-        defineNativeDataAccessorProperty(state, ObjectPropertyName(state.context()->staticStrings().bname##Error), nativeData, Value(Value::EmptyValue));                                                                           \
-    }
+#define DEFINE_ERROR_INIT(errorname, bname) \
+    defineBuiltinPlaceholder<FunctionObject, &GlobalObject::errorname##Error>(state, ObjectPropertyName(state.context()->staticStrings().bname##Error));
 
     DEFINE_ERROR_INIT(reference, Reference);
     DEFINE_ERROR_INIT(type, Type);
@@ -230,15 +222,7 @@ void GlobalObject::initializeError(ExecutionState& state)
     DEFINE_ERROR_INIT(eval, Eval);
     DEFINE_ERROR_INIT(aggregate, Aggregate);
 
-    {
-        ObjectPropertyNativeGetterSetterData* nativeData = new ObjectPropertyNativeGetterSetterData(true, false, true,
-                                                                                                    [](ExecutionState& state, Object* self, const Value& receiver, const EncodedValue& privateDataFromObjectPrivateArea) -> Value {
-                                                                                                        ASSERT(self->isGlobalObject());
-                                                                                                        return self->asGlobalObject()->error();
-                                                                                                    },
-                                                                                                    nullptr);
-        defineNativeDataAccessorProperty(state, ObjectPropertyName(state.context()->staticStrings().Error), nativeData, Value(Value::EmptyValue));
-    }
+    defineBuiltinPlaceholder<FunctionObject, &GlobalObject::error>(state, ObjectPropertyName(state.context()->staticStrings().Error));
 }
 
 void GlobalObject::installError(ExecutionState& state)
@@ -280,7 +264,7 @@ void GlobalObject::installError(ExecutionState& state)
     m_##errorname##ErrorPrototype->directDefineOwnProperty(state, state.context()->staticStrings().message, ObjectPropertyDescriptor(String::emptyString, (ObjectPropertyDescriptor::PresentAttribute)(ObjectPropertyDescriptor::WritablePresent | ObjectStructurePropertyDescriptor::ConfigurablePresent)));                                 \
     m_##errorname##ErrorPrototype->directDefineOwnProperty(state, state.context()->staticStrings().name, ObjectPropertyDescriptor(state.context()->staticStrings().bname##Error.string(), (ObjectPropertyDescriptor::PresentAttribute)(ObjectPropertyDescriptor::WritablePresent | ObjectStructurePropertyDescriptor::ConfigurablePresent))); \
     m_##errorname##Error->setFunctionPrototype(state, m_##errorname##ErrorPrototype);                                                                                                                                                                                                                                                         \
-    redefineOwnProperty(state, ObjectPropertyName(state.context()->staticStrings().bname##Error),                                                                                                                                                                                                                                             \
+    replaceBuiltinValue(state, ObjectPropertyName(state.context()->staticStrings().bname##Error),                                                                                                                                                                                                                                             \
                         ObjectPropertyDescriptor(m_##errorname##Error, (ObjectPropertyDescriptor::PresentAttribute)(ObjectPropertyDescriptor::WritablePresent | ObjectStructurePropertyDescriptor::ConfigurablePresent)));
 
     DEFINE_ERROR(reference, Reference, 1);
@@ -291,7 +275,7 @@ void GlobalObject::installError(ExecutionState& state)
     DEFINE_ERROR(eval, Eval, 1);
     DEFINE_ERROR(aggregate, Aggregate, 2);
 
-    redefineOwnProperty(state, ObjectPropertyName(state.context()->staticStrings().Error),
+    replaceBuiltinValue(state, ObjectPropertyName(state.context()->staticStrings().Error),
                         ObjectPropertyDescriptor(m_error, (ObjectPropertyDescriptor::PresentAttribute)(ObjectPropertyDescriptor::WritablePresent | ObjectPropertyDescriptor::ConfigurablePresent)));
 }
 } // namespace Escargot
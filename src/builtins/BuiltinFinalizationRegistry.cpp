@@ -102,14 +102,7 @@ static Value builtinfinalizationRegistryCleanupSome(ExecutionState& state, Value
 
 void GlobalObject::initializeFinalizationRegistry(ExecutionState& state)
 {
-    ObjectPropertyNativeGetterSetterData* nativeData = new ObjectPropertyNativeGetterSetterData(true, false, true,
-                                                                                                [](ExecutionState& state, Object* self, const Value& receiver, const EncodedValue& privateDataFromObjectPrivateArea) -> Value {
-                                                                                                    ASSERT(self->isGlobalObject());
-                                                                                                    return self->asGlobalObject()->finalizationRegistry();
-                                                                                                },
-                                                                                                nullptr);
-
-    defineNativeDataAccessorProperty(state, ObjectPropertyName(state.context()->staticStrings().FinalizationRegistry), nativeData, Value(Value::EmptyValue));
+    defineBuiltinPlaceholder<FunctionObject, &GlobalObject::finalizationRegistry>(state, ObjectPropertyName(state.context()->staticStrings().FinalizationRegistry));
 }
 
 void GlobalObject::installFinalizationRegistry(ExecutionState& state)
@@ -138,7 +131,7 @@ void GlobalObject::installFinalizationRegistry(ExecutionState& state)
                                                              ObjectPropertyDescriptor(new NativeFunctionObject(state, NativeFunctionInfo(state.context()->staticStrings().cleanupSome, builtinfinalizationRegistryCleanupSome, 0, NativeFunctionInfo::Strict)), (ObjectPropertyDescriptor::PresentAttribute)(ObjectPropertyDescriptor::WritablePresent | ObjectPropertyDescriptor::ConfigurablePresent)));
 
     m_finalizationRegistry->setFunctionPrototype(state, m_finalizationRegistryPrototype);
-    redefineOwnProperty(state, ObjectPropertyName(state.context()->staticStrings().FinalizationRegistry),
+    replaceBuiltinValue(state, ObjectPropertyName(state.context()->staticStrings().FinalizationRegistry),
                         ObjectPropertyDescriptor(m_finalizationRegistry, (ObjectPropertyDescriptor::PresentAttribute)(ObjectPropertyDescriptor::WritablePresent | ObjectPropertyDescriptor::ConfigurablePresent | ObjectPropertyDescriptor::NonEnumerablePresent)));
 }
 } // namespace Escargot
@@ -66,8 +66,6 @@ void GlobalObject::initializeGenerator(ExecutionState& state)
 
 void GlobalObject::installGenerator(ExecutionState& state)
 {
-    ASSERT(!!m_iteratorPrototype);
-
     // %GeneratorFunction% : The constructor of generator objects
     m_generatorFunction = new NativeFunctionObject(state, NativeFunctionInfo(state.context()->staticStrings().GeneratorFunction, builtinGeneratorFunction, 1), NativeFunctionObject::__ForBuiltinConstructor__);
     m_generatorFunction->setGlobalIntrinsicObject(state);
@@ -91,7 +89,7 @@ void GlobalObject::installGenerator(ExecutionState& state)
     }
 
     // %GeneratorPrototype% : The initial value of the prototype property of %Generator%
-    m_generatorPrototype = new PrototypeObject(state, m_iteratorPrototype);
+    m_generatorPrototype = new PrototypeObject(state, iteratorPrototype());
     m_generatorPrototype->setGlobalIntrinsicObject(state, true);
 
     m_generator->directDefineOwnProperty(state, ObjectPropertyName(state.context()->staticStrings().prototype), ObjectPropertyDescriptor(m_generatorPrototype, ObjectPropertyDescriptor::ConfigurablePresent));
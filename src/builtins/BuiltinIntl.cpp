@@ -1125,14 +1125,7 @@ static Value builtinIntlGetCanonicalLocales(ExecutionState& state, Value thisVal
 
 void GlobalObject::initializeIntl(ExecutionState& state)
 {
-    ObjectPropertyNativeGetterSetterData* nativeData = new ObjectPropertyNativeGetterSetterData(true, false, true,
-                                                                                                [](ExecutionState& state, Object* self, const Value& receiver, const EncodedValue& privateDataFromObjectPrivateArea) -> Value {
-                                                                                                    ASSERT(self->isGlobalObject());
-                                                                                                    return self->asGlobalObject()->intl();
-                                                                                                },
-                                                                                                nullptr);
-
-    defineNativeDataAccessorProperty(state, ObjectPropertyName(state.context()->staticStrings().Intl), nativeData, Value(Value::EmptyValue));
+    defineBuiltinPlaceholder<Object, &GlobalObject::intl>(state, ObjectPropertyName(state.context()->staticStrings().Intl));
 }
 
 void GlobalObject::installIntl(ExecutionState& state)
@@ -1141,7 +1134,7 @@ void GlobalObject::installIntl(ExecutionState& state)
     m_intl->setGlobalIntrinsicObject(state);
 
     StaticStrings* strings = &state.context()->staticStrings();
-    redefineOwnProperty(state, ObjectPropertyName(strings->Intl),
+    replaceBuiltinValue(state, ObjectPropertyName(strings->Intl),
                         ObjectPropertyDescriptor(m_intl, (ObjectPropertyDescriptor::PresentAttribute)(ObjectPropertyDescriptor::WritablePresent | ObjectPropertyDescriptor::ConfigurablePresent)));
 
     m_intlCollator = new NativeFunctionObject(state, NativeFunctionInfo(strings->Collator, builtinIntlCollatorConstructor, 0), NativeFunctionObject::__ForBuiltinConstructor__);
@@ -211,7 +211,7 @@ static Value builtinGenericIteratorNext(ExecutionState& state, Value thisValue,
 
 void GlobalObject::initializeIterator(ExecutionState& state)
 {
-    installIterator(state);
+    defineBuiltinPlaceholder<FunctionObject, &GlobalObject::iterator>(state, ObjectPropertyName(state.context()->staticStrings().Iterator));
 }
 
 void GlobalObject::installIterator(ExecutionState& state)
@@ -273,7 +273,7 @@ void GlobalObject::installIterator(ExecutionState& state)
     m_iteratorPrototype->directDefineOwnProperty(state, ObjectPropertyName(strings->map),
                                                  ObjectPropertyDescriptor(new NativeFunctionObject(state, NativeFunctionInfo(strings->map, builtinIteratorMap, 1, NativeFunctionInfo::Strict)), (ObjectPropertyDescriptor::PresentAttribute)(ObjectPropertyDescriptor::WritablePresent | ObjectPropertyDescriptor::ConfigurablePresent)));
 
-    directDefineOwnProperty(state, ObjectPropertyName(strings->Iterator),
-                            ObjectPropertyDescriptor(m_iterator, (ObjectPropertyDescriptor::PresentAttribute)(ObjectPropertyDescriptor::WritablePresent | ObjectPropertyDescriptor::ConfigurablePresent)));
+    replaceBuiltinValue(state, ObjectPropertyName(strings->Iterator),
+                        ObjectPropertyDescriptor(m_iterator, (ObjectPropertyDescriptor::PresentAttribute)(ObjectPropertyDescriptor::WritablePresent | ObjectPropertyDescriptor::ConfigurablePresent)));
 }
 } // namespace Escargot
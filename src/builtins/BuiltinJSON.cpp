@@ -39,14 +39,7 @@ static Value builtinJSONStringify(ExecutionState& state, Value thisValue, size_t
 
 void GlobalObject::initializeJSON(ExecutionState& state)
 {
-    ObjectPropertyNativeGetterSetterData* nativeData = new ObjectPropertyNativeGetterSetterData(true, false, true,
-                                                                                                [](ExecutionState& state, Object* self, const Value& receiver, const EncodedValue& privateDataFromObjectPrivateArea) -> Value {
-                                                                                                    ASSERT(self->isGlobalObject());
-                                                                                                    return self->asGlobalObject()->json();
-                                                                                                },
-                                                                                                nullptr);
-
-    defineNativeDataAccessorProperty(state, ObjectPropertyName(state.context()->staticStrings().JSON), nativeData, Value(Value::EmptyValue));
+    defineBuiltinPlaceholder<Object, &GlobalObject::json>(state, ObjectPropertyName(state.context()->staticStrings().JSON));
 }
 
 void GlobalObject::installJSON(ExecutionState& state)
@@ -57,7 +50,7 @@ void GlobalObject::installJSON(ExecutionState& state)
                                     ObjectPropertyDescriptor(Value(state.context()->staticStrings().JSON.string()), (ObjectPropertyDescriptor::PresentAttribute)(ObjectPropertyDescriptor::ConfigurablePresent)));
 
 
-    redefineOwnProperty(state, ObjectPropertyName(state.context()->staticStrings().JSON),
+    replaceBuiltinValue(state, ObjectPropertyName(state.context()->staticStrings().JSON),
                         ObjectPropertyDescriptor(m_json, (ObjectPropertyDescriptor::PresentAttribute)(ObjectPropertyDescriptor::WritablePresent | ObjectPropertyDescriptor::ConfigurablePresent)));
 
     m_jsonParse = new NativeFunctionObject(state, NativeFunctionInfo(state.context()->staticStrings().parse, builtinJSONParse, 2, NativeFunctionInfo::Strict));
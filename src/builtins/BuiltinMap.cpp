@@ -148,13 +148,15 @@ static Value builtinMapForEach(ExecutionState& state, Value thisValue, size_t ar
         T = argv[1];
     }
     // Let entries be the List that is the value of M's [[MapData]] internal slot.
-    const MapObject::MapObjectData& entries = M->storage();
+    MapObject::MapObjectData& entries = M->storage();
     // Repeat for each Record {[[Key]], [[Value]]} e that is an element of entries, in original key insertion order
-    for (size_t i = 0; i < entries.size(); i++) {
+    // (callbackfn can add or delete entries. cursor follows entries moved by compaction)
+    for (OrderedHashTableCursor cursor = entries.cursor(); entries.synchronizeCursor(cursor); cursor.m_index++) {
+        auto e = entries[cursor.m_index];
         // If e.[[Key]] is not empty, then
-        if (!entries[i].first.isEmpty()) {
+        if (!e.first.isEmpty()) {
             // Perform ? Call(callbackfn, T, « e.[[Value]], e.[[Key]], M »).
-            Value argv[3] = { Value(entries[i].second), Value(entries[i].first), Value(M) };
+            Value argv[3] = { Value(e.second), Value(e.first), Value(M) };
             Object::call(state, callbackfn, T, 3, argv);
         }
     }
@@ -215,20 +217,11 @@ static Value builtinMapGroupBy(ExecutionState& state, Value thisValue, size_t ar
 
 void GlobalObject::initializeMap(ExecutionState& state)
 {
-    ObjectPropertyNativeGetterSetterData* nativeData = new ObjectPropertyNativeGetterSetterData(true, false, true,
-                                                                                                [](ExecutionState& state, Object* self, const Value& receiver, const EncodedValue& privateDataFromObjectPrivateArea) -> Value {
-                                                                                                    ASSERT(self->isGlobalObject());
-                                                                                                    return self->asGlobalObject()->map();
-                                                                                                },
-                                                                                                nullptr);
-
-    defineNativeDataAccessorProperty(state, ObjectPropertyName(state.context()->staticStrings().Map), nativeData, Value(Value::EmptyValue));
+    defineBuiltinPlaceholder<FunctionObject, &GlobalObject::map>(state, ObjectPropertyName(state.context()->staticStrings().Map));
 }
 
 void GlobalObject::installMap(ExecutionState& state)
 {
-    ASSERT(!!m_iteratorPrototype);
-
     m_map = new NativeFunctionObject(state, NativeFunctionInfo(state.context()->staticStrings().Map, builtinMapConstructor, 0), NativeFunctionObject::__ForBuiltinConstructor__);
     m_map->setGlobalIntrinsicObject(state);
 
@@ -287,7 +280,7 @@ void GlobalObject::installMap(ExecutionState& state)
     ObjectPropertyDescriptor desc(gs, ObjectPropertyDescriptor::ConfigurablePresent);
     m_mapPrototype->directDefineOwnProperty(state, ObjectPropertyName(state.context()->staticStrings().size), desc);
 
-    m_mapIteratorPrototype = new PrototypeObject(state, m_iteratorPrototype);
+    m_mapIteratorPrototype = new PrototypeObject(state, iteratorPrototype());
     m_mapIteratorPrototype->setGlobalIntrinsicObject(state, true);
 
     m_mapIteratorPrototype->directDefineOwnProperty(state, ObjectPropertyName(state.context()->staticStrings().next),
@@ -298,7 +291,7 @@ void GlobalObject::installMap(ExecutionState& state)
 
 
     m_map->setFunctionPrototype(state, m_mapPrototype);
-    redefineOwnProperty(state, ObjectPropertyName(state.context()->staticStrings().Map),
+    replaceBuiltinValue(state, ObjectPropertyName(state.context()->staticStrings().Map),
                         ObjectPropertyDescriptor(m_map, (ObjectPropertyDescriptor::PresentAttribute)(ObjectPropertyDescriptor::WritablePresent | ObjectPropertyDescriptor::ConfigurablePresent)));
 }
 } // namespace Escargot
@@ -411,14 +411,7 @@ static Value builtinMathExpm1(ExecutionState& state, Value thisValue, size_t arg
 
 void GlobalObject::initializeMath(ExecutionState& state)
 {
-    ObjectPropertyNativeGetterSetterData* nativeData = new ObjectPropertyNativeGetterSetterData(true, false, true,
-                                                                                                [](ExecutionState& state, Object* self, const Value& receiver, const EncodedValue& privateDataFromObjectPrivateArea) -> Value {
-                                                                                                    ASSERT(self->isGlobalObject());
-                                                                                                    return self->asGlobalObject()->math();
-                                                                                                },
-                                                                                                nullptr);
-
-    defineNativeDataAccessorProperty(state, ObjectPropertyName(state.context()->staticStrings().Math), nativeData, Value(Value::EmptyValue));
+    defineBuiltinPlaceholder<Object, &GlobalObject::math>(state, ObjectPropertyName(state.context()->staticStrings().Math));
 }
 
 void GlobalObject::installMath(ExecutionState& state)
@@ -553,7 +546,7 @@ void GlobalObject::installMath(ExecutionState& state)
     m_math->directDefineOwnProperty(state, ObjectPropertyName(state.context()->staticStrings().trunc),
                                     ObjectPropertyDescriptor(new NativeFunctionObject(state, NativeFunctionInfo(state.context()->staticStrings().trunc, builtinMathTrunc, 1, NativeFunctionInfo::Strict)), (ObjectPropertyDescriptor::PresentAttribute)(ObjectPropertyDescriptor::WritablePresent | ObjectPropertyDescriptor::ConfigurablePresent)));
 
-    redefineOwnProperty(state, ObjectPropertyName(state.context()->staticStrings().Math),
+    replaceBuiltinValue(state, ObjectPropertyName(state.context()->staticStrings().Math),
                         ObjectPropertyDescriptor(m_math, (ObjectPropertyDescriptor::PresentAttribute)(ObjectPropertyDescriptor::WritablePresent | ObjectPropertyDescriptor::ConfigurablePresent)));
 }
 } // namespace Escargot
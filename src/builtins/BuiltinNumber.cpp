@@ -384,14 +384,7 @@ static Value builtinNumberIsSafeInteger(ExecutionState& state, Value thisValue,
 
 void GlobalObject::initializeNumber(ExecutionState& state)
 {
-    ObjectPropertyNativeGetterSetterData* nativeData = new ObjectPropertyNativeGetterSetterData(true, false, true,
-                                                                                                [](ExecutionState& state, Object* self, const Value& receiver, const EncodedValue& privateDataFromObjectPrivateArea) -> Value {
-                                                                                                    ASSERT(self->isGlobalObject());
-                                                                                                    return self->asGlobalObject()->number();
-                                                                                                },
-                                                                                                nullptr);
-
-    defineNativeDataAccessorProperty(state, ObjectPropertyName(state.context()->staticStrings().Number), nativeData, Value(Value::EmptyValue));
+    defineBuiltinPlaceholder<FunctionObject, &GlobalObject::number>(state, ObjectPropertyName(state.context()->staticStrings().Number));
 }
 
 void GlobalObject::installNumber(ExecutionState& state)
@@ -475,7 +468,7 @@ void GlobalObject::installNumber(ExecutionState& state)
 
     m_numberProxyObject = new NumberObject(state);
 
-    redefineOwnProperty(state, ObjectPropertyName(state.context()->staticStrings().Number),
+    replaceBuiltinValue(state, ObjectPropertyName(state.context()->staticStrings().Number),
                         ObjectPropertyDescriptor(m_number, (ObjectPropertyDescriptor::PresentAttribute)(ObjectPropertyDescriptor::WritablePresent | ObjectPropertyDescriptor::ConfigurablePresent)));
 }
 } // namespace Escargot
@@ -771,14 +771,7 @@ static Value builtinPromiseWithResolvers(ExecutionState& state, Value thisValue,
 
 void GlobalObject::initializePromise(ExecutionState& state)
 {
-    ObjectPropertyNativeGetterSetterData* nativeData = new ObjectPropertyNativeGetterSetterData(true, false, true,
-                                                                                                [](ExecutionState& state, Object* self, const Value& receiver, const EncodedValue& privateDataFromObjectPrivateArea) -> Value {
-                                                                                                    ASSERT(self->isGlobalObject());
-                                                                                                    return self->asGlobalObject()->promise();
-                                                                                                },
-                                                                                                nullptr);
-
-    defineNativeDataAccessorProperty(state, ObjectPropertyName(state.context()->staticStrings().Promise), nativeData, Value(Value::EmptyValue));
+    defineBuiltinPlaceholder<FunctionObject, &GlobalObject::promise>(state, ObjectPropertyName(state.context()->staticStrings().Promise));
 }
 
 void GlobalObject::installPromise(ExecutionState& state)
@@ -853,7 +846,7 @@ void GlobalObject::installPromise(ExecutionState& state)
                                                                 (ObjectPropertyDescriptor::PresentAttribute)(ObjectPropertyDescriptor::WritablePresent | ObjectPropertyDescriptor::ConfigurablePresent)));
 
 
-    redefineOwnProperty(state, ObjectPropertyName(strings->Promise),
+    replaceBuiltinValue(state, ObjectPropertyName(strings->Promise),
                         ObjectPropertyDescriptor(m_promise, (ObjectPropertyDescriptor::PresentAttribute)(ObjectPropertyDescriptor::WritablePresent | ObjectPropertyDescriptor::ConfigurablePresent)));
 }
 } // namespace Escargot
@@ -285,14 +285,7 @@ static Value builtinReflectSetPrototypeOf(ExecutionState& state, Value thisValue
 
 void GlobalObject::initializeReflect(ExecutionState& state)
 {
-    ObjectPropertyNativeGetterSetterData* nativeData = new ObjectPropertyNativeGetterSetterData(true, false, true,
-                                                                                                [](ExecutionState& state, Object* self, const Value& receiver, const EncodedValue& privateDataFromObjectPrivateArea) -> Value {
-                                                                                                    ASSERT(self->isGlobalObject());
-                                                                                                    return self->asGlobalObject()->reflect();
-                                                                                                },
-                                                                                                nullptr);
-
-    defineNativeDataAccessorProperty(state, ObjectPropertyName(state.context()->staticStrings().Reflect), nativeData, Value(Value::EmptyValue));
+    defineBuiltinPlaceholder<Object, &GlobalObject::reflect>(state, ObjectPropertyName(state.context()->staticStrings().Reflect));
 }
 
 void GlobalObject::installReflect(ExecutionState& state)
@@ -343,7 +336,7 @@ void GlobalObject::installReflect(ExecutionState& state)
     m_reflect->directDefineOwnProperty(state, ObjectPropertyName(state, Value(state.context()->vmInstance()->globalSymbols().toStringTag)),
                                        ObjectPropertyDescriptor(state.context()->staticStrings().Reflect.string(), (ObjectPropertyDescriptor::PresentAttribute)(ObjectPropertyDescriptor::ConfigurablePresent)));
 
-    redefineOwnProperty(state, ObjectPropertyName(strings->Reflect),
+    replaceBuiltinValue(state, ObjectPropertyName(strings->Reflect),
                         ObjectPropertyDescriptor(m_reflect, (ObjectPropertyDescriptor::PresentAttribute)(ObjectPropertyDescriptor::WritablePresent | ObjectPropertyDescriptor::ConfigurablePresent)));
 }
 } // namespace Escargot
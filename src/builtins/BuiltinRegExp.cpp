@@ -794,20 +794,11 @@ std::pair<Value, bool> RegExpStringIteratorObject::advance(ExecutionState& state
 
 void GlobalObject::initializeRegExp(ExecutionState& state)
 {
-    ObjectPropertyNativeGetterSetterData* nativeData = new ObjectPropertyNativeGetterSetterData(true, false, true,
-                                                                                                [](ExecutionState& state, Object* self, const Value& receiver, const EncodedValue& privateDataFromObjectPrivateArea) -> Value {
-                                                                                                    ASSERT(self->isGlobalObject());
-                                                                                                    return self->asGlobalObject()->regexp();
-                                                                                                },
-                                                                                                nullptr);
-
-    defineNativeDataAccessorProperty(state, ObjectPropertyName(state.context()->staticStrings().RegExp), nativeData, Value(Value::EmptyValue));
+    defineBuiltinPlaceholder<FunctionObject, &GlobalObject::regexp>(state, ObjectPropertyName(state.context()->staticStrings().RegExp));
 }
 
 void GlobalObject::installRegExp(ExecutionState& state)
 {
-    ASSERT(!!m_iteratorPrototype);
-
     const StaticStrings* strings = &state.context()->staticStrings();
 
     m_regexp = new NativeFunctionObject(state, NativeFunctionInfo(strings->RegExp, builtinRegExpConstructor, 2), NativeFunctionObject::__ForBuiltinConstructor__);
@@ -979,7 +970,7 @@ void GlobalObject::installRegExp(ExecutionState& state)
     m_regexpPrototype->directDefineOwnProperty(state, ObjectPropertyName(state.context()->vmInstance()->globalSymbols().matchAll),
                                                ObjectPropertyDescriptor(new NativeFunctionObject(state, NativeFunctionInfo(strings->symbolMatchAll, builtinRegExpMatchAll, 1, NativeFunctionInfo::Strict)), (ObjectPropertyDescriptor::PresentAttribute)(ObjectPropertyDescriptor::WritablePresent | ObjectPropertyDescriptor::ConfigurablePresent)));
 
-    m_regexpStringIteratorPrototype = new PrototypeObject(state, m_iteratorPrototype);
+    m_regexpStringIteratorPrototype = new PrototypeObject(state, iteratorPrototype());
     m_regexpStringIteratorPrototype->setGlobalIntrinsicObject(state, true);
 
     m_regexpStringIteratorPrototype->directDefineOwnProperty(state, ObjectPropertyName(state.context()->staticStrings().next),
@@ -988,7 +979,7 @@ void GlobalObject::installRegExp(ExecutionState& state)
     m_regexpStringIteratorPrototype->directDefineOwnProperty(state, ObjectPropertyName(state.context()->vmInstance()->globalSymbols().toStringTag),
                                                              ObjectPropertyDescriptor(Value(String::fromASCII("RegExp String Iterator")), (ObjectPropertyDescriptor::PresentAttribute)(ObjectPropertyDescriptor::ConfigurablePresent)));
 
-    redefineOwnProperty(state, ObjectPropertyName(strings->RegExp),
+    replaceBuiltinValue(state, ObjectPropertyName(strings->RegExp),
                         ObjectPropertyDescriptor(m_regexp, (ObjectPropertyDescriptor::PresentAttribute)(ObjectPropertyDescriptor::WritablePresent | ObjectPropertyDescriptor::ConfigurablePresent)));
 }
 } // namespace Escargot
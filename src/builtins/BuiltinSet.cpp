@@ -138,10 +138,11 @@ static Value builtinSetForEach(ExecutionState& state, Value thisValue, size_t ar
         T = argv[1];
     }
     // Let entries be the List that is the value of S's [[SetData]] internal slot.
-    const SetObject::SetObjectData& entries = S->storage();
+    SetObject::SetObjectData& entries = S->storage();
     // Repeat for each e that is an element of entries, in original insertion order
-    for (size_t i = 0; i < entries.size(); i++) {
-        Value e = entries[i];
+    // (callbackfn can add or delete entries. cursor follows entries moved by compaction)
+    for (OrderedHashTableCursor cursor = entries.cursor(); entries.synchronizeCursor(cursor); cursor.m_index++) {
+        Value e = entries[cursor.m_index];
         // If e is not empty, then
         if (!e.isEmpty()) {
             // If e.[[Key]] is not empty, then
@@ -183,20 +184,11 @@ static Value builtinSetIteratorNext(ExecutionState& state, Value thisValue, size
 
 void GlobalObject::initializeSet(ExecutionState& state)
 {
-    ObjectPropertyNativeGetterSetterData* nativeData = new ObjectPropertyNativeGetterSetterData(true, false, true,
-                                                                                                [](ExecutionState& state, Object* self, const Value& receiver, const EncodedValue& privateDataFromObjectPrivateArea) -> Value {
-                                                                                                    ASSERT(self->isGlobalObject());
-                                                                                                    return self->asGlobalObject()->set();
-                                                                                                },
-                                                                                                nullptr);
-
-    defineNativeDataAccessorProperty(state, ObjectPropertyName(state.context()->staticStrings().Set), nativeData, Value(Value::EmptyValue));
+    defineBuiltinPlaceholder<FunctionObject, &GlobalObject::set>(state, ObjectPropertyName(state.context()->staticStrings().Set));
 }
 
 void GlobalObject::installSet(ExecutionState& state)
 {
-    ASSERT(!!m_iteratorPrototype);
-
     m_set = new NativeFunctionObject(state, NativeFunctionInfo(state.context()->staticStrings().Set, builtinSetConstructor, 0), NativeFunctionObject::__ForBuiltinConstructor__);
     m_set->setGlobalIntrinsicObject(state);
 
@@ -245,7 +237,7 @@ void GlobalObject::installSet(ExecutionState& state)
     ObjectPropertyDescriptor desc(gs, ObjectPropertyDescriptor::ConfigurablePresent);
     m_setPrototypeObject->directDefineOwnProperty(state, ObjectPropertyName(state.context()->staticStrings().size), desc);
 
-    m_setIteratorPrototype = new PrototypeObject(state, m_iteratorPrototype);
+    m_setIteratorPrototype = new PrototypeObject(state, iteratorPrototype());
     m_setIteratorPrototype->setGlobalIntrinsicObject(state, true);
 
     m_setIteratorPrototype->directDefineOwnProperty(state, ObjectPropertyName(state.context()->staticStrings().next),
@@ -255,7 +247,7 @@ void GlobalObject::installSet(ExecutionState& state)
                                                     ObjectPropertyDescriptor(Value(String::fromASCII("Set Iterator")), (ObjectPropertyDescriptor::PresentAttribute)(ObjectPropertyDescriptor::ConfigurablePresent)));
 
     m_set->setFunctionPrototype(state, m_setPrototypeObject);
-    redefineOwnProperty(state, ObjectPropertyName(state.context()->staticStrings().Set),
+    replaceBuiltinValue(state, ObjectPropertyName(state.context()->staticStrings().Set),
                         ObjectPropertyDescriptor(m_set, (ObjectPropertyDescriptor::PresentAttribute)(ObjectPropertyDescriptor::WritablePresent | ObjectPropertyDescriptor::ConfigurablePresent)));
 }
 } // namespace Escargot
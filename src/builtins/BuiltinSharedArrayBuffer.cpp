@@ -136,14 +136,7 @@ static Value builtinSharedArrayBufferSlice(ExecutionState& state, Value thisValu
 
 void GlobalObject::initializeSharedArrayBuffer(ExecutionState& state)
 {
-    ObjectPropertyNativeGetterSetterData* nativeData = new ObjectPropertyNativeGetterSetterData(true, false, true,
-                                                                                                [](ExecutionState& state, Object* self, const Value& receiver, const EncodedValue& privateDataFromObjectPrivateArea) -> Value {
-                                                                                                    ASSERT(self->isGlobalObject());
-                                                                                                    return self->asGlobalObject()->sharedArrayBuffer();
-                                                                                                },
-                                                                                                nullptr);
-
-    defineNativeDataAccessorProperty(state, ObjectPropertyName(state.context()->staticStrings().SharedArrayBuffer), nativeData, Value(Value::EmptyValue));
+    defineBuiltinPlaceholder<FunctionObject, &GlobalObject::sharedArrayBuffer>(state, ObjectPropertyName(state.context()->staticStrings().SharedArrayBuffer));
 }
 
 void GlobalObject::installSharedArrayBuffer(ExecutionState& state)
@@ -193,7 +186,7 @@ void GlobalObject::installSharedArrayBuffer(ExecutionState& state)
 
     m_sharedArrayBuffer->setFunctionPrototype(state, m_sharedArrayBufferPrototype);
 
-    redefineOwnProperty(state, ObjectPropertyName(strings->SharedArrayBuffer),
+    replaceBuiltinValue(state, ObjectPropertyName(strings->SharedArrayBuffer),
                         ObjectPropertyDescriptor(m_sharedArrayBuffer, (ObjectPropertyDescriptor::PresentAttribute)(ObjectPropertyDescriptor::WritablePresent | ObjectPropertyDescriptor::ConfigurablePresent)));
 }
 
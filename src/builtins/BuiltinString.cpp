@@ -772,24 +772,27 @@ static Value builtinStringSplit(ExecutionState& state, Value thisValue, size_t a
         }
     } else {
         String* R = P->asString();
+        size_t r = R->length();
         while (q != s) {
-            Value e = splitMatchUsingStr(S, q, R);
-            if (e == Value(false))
+            // skip positions which do not match with R at once
+            q = S->find(R, q);
+            if (q == SIZE_MAX) {
+                break;
+            }
+
+            size_t e = q + r;
+            if (e == p)
                 q++;
             else {
-                if ((size_t)e.asInt32() == p)
-                    q++;
-                else {
-                    if (q >= S->length())
-                        break;
-
-                    String* T = S->substring(p, q);
-                    A->defineOwnProperty(state, ObjectPropertyName(state, Value(lengthA++)), ObjectPropertyDescriptor(T, ObjectPropertyDescriptor::AllPresent));
-                    if (lengthA == lim)
-                        return A;
-                    p = e.asInt32();
-                    q = p;
-                }
+                if (q >= S->length())
+                    break;
+
+                String* T = S->substring(p, q);
+                A->defineOwnProperty(state, ObjectPropertyName(state, Value(lengthA++)), ObjectPropertyDescriptor(T, ObjectPropertyDescriptor::AllPresent));
+                if (lengthA == lim)
+                    return A;
+                p = e;
+                q = p;
             }
         }
     }
@@ -1197,16 +1200,7 @@ static Value builtinStringStartsWith(ExecutionState& state, Value thisValue, siz
     }
     // If the sequence of elements of S starting at start of length searchLength is the same as the full element sequence of searchStr, return true.
     // Otherwise, return false.
-    const auto& srcData = S->bufferAccessData();
-    const auto& src2Data = searchStr->bufferAccessData();
-
-    for (size_t i = 0; i < src2Data.length; i++) {
-        if (srcData.charAt(i + start) != src2Data.charAt(i)) {
-            return Value(false);
-        }
-    }
-
-    return Value(true);
+    return Value(S->hasSubstringAt(searchStr, start));
 }
 
 static Value builtinStringEndsWith(ExecutionState& state, Value thisValue, size_t argc, Value* argv, Optional<Object*> newTarget)
@@ -1244,15 +1238,7 @@ static Value builtinStringEndsWith(ExecutionState& state, Value thisValue, size_
         return Value(false);
     }
     // If the sequence of elements of S starting at start of length searchLength is the same as the full element sequence of searchStr, return true.
-    const auto& srcData = S->bufferAccessData();
-    const auto& src2Data = searchStr->bufferAccessData();
-    for (size_t i = 0; i < searchLength; i++) {
-        if (srcData.charAt(i + start) != src2Data.charAt(i)) {
-            return Value(false);
-        }
-    }
-
-    return Value(true);
+    return Value(S->hasSubstringAt(searchStr, start));
 }
 
 // ( template, ...substitutions )
@@ -1625,20 +1611,11 @@ static Value builtinStringIterator(ExecutionState& state, Value thisValue, size_
 
 void GlobalObject::initializeString(ExecutionState& state)
 {
-    ObjectPropertyNativeGetterSetterData* nativeData = new ObjectPropertyNativeGetterSetterData(true, false, true,
-                                                                                                [](ExecutionState& state, Object* self, const Value& receiver, const EncodedValue& privateDataFromObjectPrivateArea) -> Value {
-                                                                                                    ASSERT(self->isGlobalObject());
-                                                                                                    return self->asGlobalObject()->string();
-                                                                                                },
-                                                                                                nullptr);
-
-    defineNativeDataAccessorProperty(state, ObjectPropertyName(state.context()->staticStrings().String), nativeData, Value(Value::EmptyValue));
+    defineBuiltinPlaceholder<FunctionObject, &GlobalObject::string>(state, ObjectPropertyName(state.context()->staticStrings().String));
 }
 
 void GlobalObject::installString(ExecutionState& state)
 {
-    ASSERT(!!m_iteratorPrototype);
-
     const StaticStrings* strings = &state.context()->staticStrings();
     m_string = new NativeFunctionObject(state, NativeFunctionInfo(strings->String, builtinStringConstructor, 1), NativeFunctionObject::__ForBuiltinConstructor__);
     m_string->setGlobalIntrinsicObject(state);
@@ -1828,7 +1805,7 @@ void GlobalObject::installString(ExecutionState& state)
 
     m_string->setFunctionPrototype(state, m_stringPrototype);
 
-    m_stringIteratorPrototype = new PrototypeObject(state, m_iteratorPrototype);
+    m_stringIteratorPrototype = new PrototypeObject(state, iteratorPrototype());
     m_stringIteratorPrototype->setGlobalIntrinsicObject(state, true);
 
     m_stringIteratorPrototype->directDefineOwnProperty(state, ObjectPropertyName(state.context()->staticStrings().next),
@@ -1839,7 +1816,7 @@ void GlobalObject::installString(ExecutionState& state)
 
     m_stringProxyObject = new StringObject(state);
 
-    redefineOwnProperty(state, ObjectPropertyName(strings->String),
+    replaceBuiltinValue(state, ObjectPropertyName(strings->String),
                         ObjectPropertyDescriptor(m_string, (ObjectPropertyDescriptor::PresentAttribute)(ObjectPropertyDescriptor::WritablePresent | ObjectPropertyDescriptor::ConfigurablePresent)));
 }
 } // namespace Escargot
@@ -107,14 +107,7 @@ static Value builtinSymbolDescriptionGetter(ExecutionState& state, Value thisVal
 
 void GlobalObject::initializeSymbol(ExecutionState& state)
 {
-    ObjectPropertyNativeGetterSetterData* nativeData = new ObjectPropertyNativeGetterSetterData(true, false, true,
-                                                                                                [](ExecutionState& state, Object* self, const Value& receiver, const EncodedValue& privateDataFromObjectPrivateArea) -> Value {
-                                                                                                    ASSERT(self->isGlobalObject());
-                                                                                                    return self->asGlobalObject()->symbol();
-                                                                                                },
-                                                                                                nullptr);
-
-    defineNativeDataAccessorProperty(state, ObjectPropertyName(state.context()->staticStrings().Symbol), nativeData, Value(Value::EmptyValue));
+    defineBuiltinPlaceholder<FunctionObject, &GlobalObject::symbol>(state, ObjectPropertyName(state.context()->staticStrings().Symbol));
 }
 
 void GlobalObject::installSymbol(ExecutionState& state)
@@ -165,7 +158,7 @@ void GlobalObject::installSymbol(ExecutionState& state)
 
     m_symbolProxyObject = new SymbolObject(state, state.context()->vmInstance()->globalSymbols().iterator);
 
-    redefineOwnProperty(state, ObjectPropertyName(state.context()->staticStrings().Symbol),
+    replaceBuiltinValue(state, ObjectPropertyName(state.context()->staticStrings().Symbol),
                         ObjectPropertyDescriptor(m_symbol, (ObjectPropertyDescriptor::PresentAttribute)(ObjectPropertyDescriptor::WritablePresent | ObjectPropertyDescriptor::ConfigurablePresent)));
 }
 } // namespace Escargot
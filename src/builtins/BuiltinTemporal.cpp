@@ -158,15 +158,7 @@ FOR_EACH_PLAINDATE_PROTOTYPE_CALENDARDATE_GETTER(DEFINE_PLAINDATE_PROTOTYPE_CALE
 
 void GlobalObject::initializeTemporal(ExecutionState& state)
 {
-    ObjectPropertyNativeGetterSetterData* nativeData = new ObjectPropertyNativeGetterSetterData(
-        true, false, true,
-        [](ExecutionState& state, Object* self, const Value& receiver, const EncodedValue& privateDataFromObjectPrivateArea) -> Value {
-            ASSERT(self->isGlobalObject());
-            return self->asGlobalObject()->temporal();
-        },
-        nullptr);
-
-    defineNativeDataAccessorProperty(state, ObjectPropertyName(state.context()->staticStrings().lazyTemporal()), nativeData, Value(Value::EmptyValue));
+    defineBuiltinPlaceholder<Object, &GlobalObject::temporal>(state, ObjectPropertyName(state.context()->staticStrings().lazyTemporal()));
 }
 
 void GlobalObject::installTemporal(ExecutionState& state)
@@ -222,7 +214,7 @@ void GlobalObject::installTemporal(ExecutionState& state)
     m_temporal->directDefineOwnProperty(state, ObjectPropertyName(strings->lazyPlainDate()),
                                         ObjectPropertyDescriptor(m_temporalPlainDate, (ObjectPropertyDescriptor::PresentAttribute)(ObjectPropertyDescriptor::WritablePresent | ObjectPropertyDescriptor::ConfigurablePresent)));
 
-    redefineOwnProperty(state, ObjectPropertyName(strings->lazyTemporal()),
+    replaceBuiltinValue(state, ObjectPropertyName(strings->lazyTemporal()),
                         ObjectPropertyDescriptor(m_temporal, (ObjectPropertyDescriptor::PresentAttribute)(ObjectPropertyDescriptor::WritablePresent | ObjectPropertyDescriptor::ConfigurablePresent)));
 }
 
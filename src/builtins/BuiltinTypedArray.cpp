@@ -1818,7 +1818,7 @@ FunctionObject* GlobalObject::installTypedArray(ExecutionState& state, AtomicStr
     // 22.2.6.2 /TypedArray/.prototype.constructor
     taPrototype->directDefineOwnProperty(state, ObjectPropertyName(strings->constructor), ObjectPropertyDescriptor(taConstructor, (ObjectPropertyDescriptor::PresentAttribute)(ObjectPropertyDescriptor::WritablePresent | ObjectPropertyDescriptor::ConfigurablePresent)));
 
-    redefineOwnProperty(state, ObjectPropertyName(taName),
+    replaceBuiltinValue(state, ObjectPropertyName(taName),
                         ObjectPropertyDescriptor(taConstructor, (ObjectPropertyDescriptor::PresentAttribute)(ObjectPropertyDescriptor::WritablePresent | ObjectPropertyDescriptor::ConfigurablePresent)));
 
     return taConstructor;
@@ -1828,16 +1828,8 @@ void GlobalObject::initializeTypedArray(ExecutionState& state)
 {
     const StaticStrings* strings = &state.context()->staticStrings();
 
-#define INITIALIZE_TYPEDARRAY(TYPE, type, siz, nativeType)                                                                                                                                                                          \
-    {                                                                                                                                                                                                                               \
-        ObjectPropertyNativeGetterSetterData* nativeData = new ObjectPropertyNativeGetterSetterData(true, false, true,                                                                                                              \
-                                                                                                    [](ExecutionState& state, Object* self, const Value& receiver, const EncodedValue& privateDataFromObjectPrivateArea) -> Value { \
-                                                                                                        ASSERT(self->isGlobalObject());                                                                                             \
-                                                                                                        return self->asGlobalObject()->type##Array();                                                                               \
-                                                                                                    },                                                                                                                              \
-                                                                                                    nullptr);                                                                                                                       \
-        defineNativeDataAccessorProperty(state, ObjectPropertyName(strings->TYPE##Array), nativeData, Value(Value::EmptyValue));                                                                                                    \
-    }
+#define INITIALIZE_TYPEDARRAY(TYPE, type, siz, nativeType) \
+    defineBuiltinPlaceholder<FunctionObject, &GlobalObject::type##Array>(state, ObjectPropertyName(strings->TYPE##Array));
 
     FOR_EACH_TYPEDARRAY_TYPES(INITIALIZE_TYPEDARRAY)
 #undef INITIALIZE_TYPEDARRAY
@@ -125,14 +125,7 @@ static Value builtinWeakMapSet(ExecutionState& state, Value thisValue, size_t ar
 
 void GlobalObject::initializeWeakMap(ExecutionState& state)
 {
-    ObjectPropertyNativeGetterSetterData* nativeData = new ObjectPropertyNativeGetterSetterData(true, false, true,
-                                                                                                [](ExecutionState& state, Object* self, const Value& receiver, const EncodedValue& privateDataFromObjectPrivateArea) -> Value {
-                                                                                                    ASSERT(self->isGlobalObject());
-                                                                                                    return self->asGlobalObject()->weakMap();
-                                                                                                },
-                                                                                                nullptr);
-
-    defineNativeDataAccessorProperty(state, ObjectPropertyName(state.context()->staticStrings().WeakMap), nativeData, Value(Value::EmptyValue));
+    defineBuiltinPlaceholder<FunctionObject, &GlobalObject::weakMap>(state, ObjectPropertyName(state.context()->staticStrings().WeakMap));
 }
 
 void GlobalObject::installWeakMap(ExecutionState& state)
@@ -160,7 +153,7 @@ void GlobalObject::installWeakMap(ExecutionState& state)
                                                 ObjectPropertyDescriptor(Value(state.context()->staticStrings().WeakMap.string()), (ObjectPropertyDescriptor::PresentAttribute)(ObjectPropertyDescriptor::ConfigurablePresent)));
 
     m_weakMap->setFunctionPrototype(state, m_weakMapPrototype);
-    redefineOwnProperty(state, ObjectPropertyName(state.context()->staticStrings().WeakMap),
+    replaceBuiltinValue(state, ObjectPropertyName(state.context()->staticStrings().WeakMap),
                         ObjectPropertyDescriptor(m_weakMap, (ObjectPropertyDescriptor::PresentAttribute)(ObjectPropertyDescriptor::WritablePresent | ObjectPropertyDescriptor::ConfigurablePresent)));
 }
 } // namespace Escargot
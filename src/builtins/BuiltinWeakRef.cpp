@@ -58,14 +58,7 @@ static Value builtinWeakRefDeRef(ExecutionState& state, Value thisValue, size_t
 
 void GlobalObject::initializeWeakRef(ExecutionState& state)
 {
-    ObjectPropertyNativeGetterSetterData* nativeData = new ObjectPropertyNativeGetterSetterData(true, false, true,
-                                                                                                [](ExecutionState& state, Object* self, const Value& receiver, const EncodedValue& privateDataFromObjectPrivateArea) -> Value {
-                                                                                                    ASSERT(self->isGlobalObject());
-                                                                                                    return self->asGlobalObject()->weakRef();
-                                                                                                },
-                                                                                                nullptr);
-
-    defineNativeDataAccessorProperty(state, ObjectPropertyName(state.context()->staticStrings().WeakRef), nativeData, Value(Value::EmptyValue));
+    defineBuiltinPlaceholder<FunctionObject, &GlobalObject::weakRef>(state, ObjectPropertyName(state.context()->staticStrings().WeakRef));
 }
 
 void GlobalObject::installWeakRef(ExecutionState& state)
@@ -85,7 +78,7 @@ void GlobalObject::installWeakRef(ExecutionState& state)
                                                 ObjectPropertyDescriptor(Value(state.context()->staticStrings().WeakRef.string()), (ObjectPropertyDescriptor::PresentAttribute)(ObjectPropertyDescriptor::ConfigurablePresent)));
 
     m_weakRef->setFunctionPrototype(state, m_weakRefPrototype);
-    redefineOwnProperty(state, ObjectPropertyName(state.context()->staticStrings().WeakRef),
+    replaceBuiltinValue(state, ObjectPropertyName(state.context()->staticStrings().WeakRef),
                         ObjectPropertyDescriptor(m_weakRef, (ObjectPropertyDescriptor::PresentAttribute)(ObjectPropertyDescriptor::WritablePresent | ObjectPropertyDescriptor::ConfigurablePresent)));
 }
 } // namespace Escargot
@@ -114,14 +114,7 @@ static Value builtinWeakSetHas(ExecutionState& state, Value thisValue, size_t ar
 
 void GlobalObject::initializeWeakSet(ExecutionState& state)
 {
-    ObjectPropertyNativeGetterSetterData* nativeData = new ObjectPropertyNativeGetterSetterData(true, false, true,
-                                                                                                [](ExecutionState& state, Object* self, const Value& receiver, const EncodedValue& privateDataFromObjectPrivateArea) -> Value {
-                                                                                                    ASSERT(self->isGlobalObject());
-                                                                                                    return self->asGlobalObject()->weakSet();
-                                                                                                },
-                                                                                                nullptr);
-
-    defineNativeDataAccessorProperty(state, ObjectPropertyName(state.context()->staticStrings().WeakSet), nativeData, Value(Value::EmptyValue));
+    defineBuiltinPlaceholder<FunctionObject, &GlobalObject::weakSet>(state, ObjectPropertyName(state.context()->staticStrings().WeakSet));
 }
 
 void GlobalObject::installWeakSet(ExecutionState& state)
@@ -147,7 +140,7 @@ void GlobalObject::installWeakSet(ExecutionState& state)
                                                 ObjectPropertyDescriptor(Value(state.context()->staticStrings().WeakSet.string()), (ObjectPropertyDescriptor::PresentAttribute)(ObjectPropertyDescriptor::ConfigurablePresent)));
 
     m_weakSet->setFunctionPrototype(state, m_weakSetPrototype);
-    redefineOwnProperty(state, ObjectPropertyName(state.context()->staticStrings().WeakSet),
+    replaceBuiltinValue(state, ObjectPropertyName(state.context()->staticStrings().WeakSet),
                         ObjectPropertyDescriptor(m_weakSet, (ObjectPropertyDescriptor::PresentAttribute)(ObjectPropertyDescriptor::WritablePresent | ObjectPropertyDescriptor::ConfigurablePresent)));
 }
 } // namespace Escargot
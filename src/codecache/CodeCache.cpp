@@ -27,6 +27,7 @@
 #include "interpreter/ByteCode.h"
 #include "codecache/CodeCache.h"
 #include "codecache/CodeCacheReaderWriter.h"
+#include "codecache/CodeCacheFileWriter.h"
 #include "parser/Script.h"
 #include "parser/CodeBlock.h"
 
@@ -34,6 +35,7 @@
 #include <dirent.h>
 #include <sys/stat.h>
 #include <sys/file.h>
+#include <sys/mman.h>
 #include <unistd.h>
 
 #define CODE_CACHE_FILE_DIR "/Escargot-cache/"
@@ -41,6 +43,91 @@
 
 namespace Escargot {
 
+// cache files and in-memory cache data are valid only for the same version and the same bytecode layout
+// FNV-1a is used instead of std::hash because the hash is stored and must not depend on the standard library
+struct CodeCacheFingerprint {
+    enum FeatureFlag : uint16_t {
+        TCO = 1 << 0,
+        Debugger = 1 << 1,
+        SuperInstruction = 1 << 2,
+        QuickenedOpcode = 1 << 3,
+        ComputedGoto = 1 << 4,
+    };
+
+    uint64_t m_versionHash; // hash of ESCARGOT_VERSION
+    uint64_t m_layoutHash; // hash of the name and size of each bytecode in opcode order
+    uint32_t m_opcodeCount; // OpcodeKindEnd
+    uint16_t m_pointerSize; // sizeof(size_t)
+    uint16_t m_featureFlags; // build options which change the set of bytecodes or their layout
+
+    bool operator==(const CodeCacheFingerprint& other) const
+    {
+        return m_versionHash == other.m_versionHash && m_layoutHash == other.m_layoutHash && m_opcodeCount == other.m_opcodeCount
+            && m_pointerSize == other.m_pointerSize && m_featureFlags == other.m_featureFlags;
+    }
+
+    bool operator!=(const CodeCacheFingerprint& other) const
+    {
+        return !operator==(other);
+    }
+};
+
+static uint64_t fnv1aHash(uint64_t hash, const void* data, size_t length)
+{
+    const uint8_t* bytes = static_cast<const uint8_t*>(data);
+    for (size_t i = 0; i < length; i++) {
+        hash ^= bytes[i];
+        hash *= 0x100000001b3ULL;
+    }
+    return hash;
+}
+
+static const uint64_t fnv1aOffsetBasis = 0xcbf29ce484222325ULL;
+
+static CodeCacheFingerprint computeCodeCacheFingerprint()
+{
+    CodeCacheFingerprint fingerprint;
+    memset(&fingerprint, 0, sizeof(CodeCacheFingerprint));
+
+    const char* version = ESCARGOT_VERSION;
+    ASSERT(strlen(version) > 0);
+    fingerprint.m_versionHash = fnv1aHash(fnv1aOffsetBasis, version, strlen(version));
+    uint64_t layoutHash = fnv1aOffsetBasis;
+#define HASH_BYTECODE_LAYOUT(name)                                   \
+    {                                                                \
+        uint32_t size = sizeof(name);                                \
+        layoutHash = fnv1aHash(layoutHash, #name, sizeof(#name));    \
+        layoutHash = fnv1aHash(layoutHash, &size, sizeof(uint32_t)); \
+    }
+    FOR_EACH_BYTECODE(HASH_BYTECODE_LAYOUT)
+#undef HASH_BYTECODE_LAYOUT
+    fingerprint.m_layoutHash = layoutHash;
+    fingerprint.m_opcodeCount = OpcodeKindEnd;
+    fingerprint.m_pointerSize = sizeof(size_t);
+#if defined(ENABLE_TCO)
+    fingerprint.m_featureFlags |= CodeCacheFingerprint::TCO;
+#endif
+#if defined(ESCARGOT_DEBUGGER)
+    fingerprint.m_featureFlags |= CodeCacheFingerprint::Debugger;
+#endif
+#if defined(ENABLE_SUPER_INSTRUCTION)
+    fingerprint.m_featureFlags |= CodeCacheFingerprint::SuperInstruction;
+#endif
+#if !defined(ESCARGOT_SMALL_CONFIG)
+    fingerprint.m_featureFlags |= CodeCacheFingerprint::QuickenedOpcode;
+#endif
+#if defined(ESCARGOT_COMPUTED_GOTO_INTERPRETER)
+    fingerprint.m_featureFlags |= CodeCacheFingerprint::ComputedGoto;
+#endif
+    return fingerprint;
+}
+
+static const CodeCacheFingerprint& codeCacheFingerprint()
+{
+    static const CodeCacheFingerprint fingerprint = computeCodeCacheFingerprint();
+    return fingerprint;
+}
+
 static std::string createCacheFilePath(const std::string& cacheDirPath, const CodeCacheIndex& cacheIndex)
 {
     std::stringstream ss;
@@ -54,6 +141,15 @@ void CodeCache::CodeCacheContext::reset()
     m_cacheFilePath.clear();
     m_cacheEntry.reset();
 
+    if (m_cacheFileMap) {
+        // in-memory cache data is owned by embedder
+        if (!m_isMemoryCache) {
+            munmap(const_cast<char*>(m_cacheFileMap), m_cacheFileMapSize);
+        }
+        m_cacheFileMap = nullptr;
+        m_cacheFileMapSize = 0;
+    }
+
     if (m_cacheFile) {
         fclose(m_cacheFile);
         m_cacheFile = nullptr;
@@ -64,11 +160,16 @@ void CodeCache::CodeCacheContext::reset()
         m_cacheStringTable = nullptr;
     }
     m_cacheDataOffset = 0;
+    m_isMemoryCache = false;
+    std::string().swap(m_cacheData);
+    m_cacheDataFileSize = 0;
+    m_memoryCacheList = nullptr;
 }
 
 CodeCache::CodeCache(const char* baseCacheDir)
     : m_cacheWriter(nullptr)
     , m_cacheReader(nullptr)
+    , m_fileWriter(nullptr)
     , m_cacheDirFD(-1)
     , m_enabled(false)
     , m_shouldLoadFunctionOnScriptLoading(CODE_CACHE_SHOULD_LOAD_FUNCTIONS_ON_SCRIPT_LOADING)
@@ -108,6 +209,7 @@ void CodeCache::initialize(const char* baseCacheDir)
 
     m_cacheWriter = new CodeCacheWriter();
     m_cacheReader = new CodeCacheReader();
+    m_fileWriter = new CodeCacheFileWriter();
     m_enabled = true;
     m_status = Status::READY;
 
@@ -182,18 +284,15 @@ bool CodeCache::tryInitCacheList()
         return false;
     }
 
-    // check Escargot version
-    size_t cacheVerHash;
-    if (UNLIKELY(fread(&cacheVerHash, sizeof(size_t), 1, listFile) != 1)) {
+    // check Escargot version and bytecode layout
+    CodeCacheFingerprint cacheFingerprint;
+    if (UNLIKELY(fread(&cacheFingerprint, sizeof(CodeCacheFingerprint), 1, listFile) != 1)) {
         ESCARGOT_LOG_ERROR("[CodeCache] fread of %s failed\n", listFilePath.data());
         fclose(listFile);
         return false;
     }
-    std::string currentVer = ESCARGOT_VERSION;
-    ASSERT(currentVer.length() > 0);
-    size_t currentVerHash = std::hash<std::string>{}(currentVer);
-    if (UNLIKELY(currentVerHash != cacheVerHash)) {
-        ESCARGOT_LOG_ERROR("[CodeCache] Different Escargot version (current: %zu / cache: %zu), clear cache\n", currentVerHash, cacheVerHash);
+    if (UNLIKELY(cacheFingerprint != codeCacheFingerprint())) {
+        ESCARGOT_LOG_ERROR("[CodeCache] Different Escargot version or build configuration, clear cache\n");
         fclose(listFile);
         return false;
     }
@@ -278,6 +377,12 @@ void CodeCache::clearCacheDir()
 
 void CodeCache::clear()
 {
+    // finish writing of cache files before unlocking cache directory
+    if (m_fileWriter) {
+        delete m_fileWriter;
+        m_fileWriter = nullptr;
+    }
+
     m_currentContext.reset();
 
     unLockAndCloseCacheDir();
@@ -304,6 +409,9 @@ void CodeCache::clearAll()
 {
     // clear CodeCache and all cache files
     ASSERT(m_status == Status::FAILED || m_status == Status::NONE);
+    if (m_fileWriter) {
+        m_fileWriter->flush();
+    }
     clearCacheDir();
     clear();
 }
@@ -392,15 +500,9 @@ bool CodeCache::removeCacheFile(const CodeCacheIndex::ScriptID& scriptID)
     ASSERT(m_cacheDirPath.length());
     ASSERT(scriptID.m_srcHash && scriptID.m_srcLength);
 
+    // the file is removed by background writer after pending writing of the file is done
     std::string filePath = createCacheFilePath(m_cacheDirPath, CodeCacheIndex(scriptID.m_srcHash, scriptID.m_srcLength, 0));
-    if (remove(filePath.data()) != 0) {
-        ESCARGOT_LOG_ERROR("[CodeCache] can`t remove a cache file %s\n", filePath.data());
-        return false;
-    }
-
-#ifndef NDEBUG
-    ESCARGOT_LOG_INFO("[CodeCache] remove a cache file %s\n", filePath.data());
-#endif
+    m_fileWriter->removeCacheFile(filePath);
     return true;
 }
 
@@ -517,6 +619,166 @@ bool CodeCache::storeFunctionCache(Context* context, const CodeCacheIndex& cache
     return result;
 }
 
+// in-memory cache data is laid out as
+// [CodeCacheDataHeader][CodeCacheEntryChunk x entryCount][cache data]
+// where the data offset of each CodeCacheMetaInfo is relative to the start of cache data
+struct CodeCacheDataHeader {
+    CodeCacheFingerprint m_fingerprint;
+    size_t m_srcHash;
+    size_t m_srcLength;
+    size_t m_entryCount;
+};
+
+bool CodeCache::prepareMemoryCache()
+{
+    // status of cache directory is kept and restored after in-memory caching
+    // but in-memory caching can't start while another caching is in progress
+    if (UNLIKELY(m_status == Status::IN_PROGRESS || m_status == Status::FINISH)) {
+        ESCARGOT_LOG_ERROR("[CodeCache] in-memory caching is requested during another caching\n");
+        return false;
+    }
+    ASSERT(!m_currentContext.m_cacheFilePath.length() && !m_currentContext.m_cacheFile);
+    ASSERT(!m_currentContext.m_cacheStringTable);
+
+    // reader and writer are not created when cache directory is not available
+    if (!m_cacheWriter) {
+        m_cacheWriter = new CodeCacheWriter();
+    }
+    if (!m_cacheReader) {
+        m_cacheReader = new CodeCacheReader();
+    }
+
+    m_status = Status::IN_PROGRESS;
+    m_currentContext.m_isMemoryCache = true;
+    return true;
+}
+
+bool CodeCache::storeCacheData(Context* context, const CodeCacheIndex& cacheIndex, InterpretedCodeBlock* codeBlock, CodeBlockCacheInfo* codeBlockCacheInfo, Node* node, std::vector<CodeCacheEntryChunk>& entries, std::string& data)
+{
+    ASSERT(cacheIndex.isValid());
+
+    // store global CodeBlock tree (only for global code) and ByteCodeBlock of codeBlock
+    Status previousStatus = m_status;
+    if (UNLIKELY(!prepareMemoryCache())) {
+        return false;
+    }
+    m_currentContext.m_cacheData.swap(data);
+    m_currentContext.m_cacheStringTable = new CacheStringTable();
+
+    if (codeBlockCacheInfo) {
+        // CodeBlock tree is always placed at the start of cache data
+        ASSERT(m_currentContext.m_cacheData.empty() && codeBlock->isGlobalCodeBlock());
+        storeCodeBlockTree(codeBlock, codeBlockCacheInfo);
+    }
+
+    try {
+        codeBlock->m_byteCodeBlock = ByteCodeGenerator::generateByteCode(context, codeBlock, node, false, true);
+    } catch (const char* message) {
+        m_status = Status::FAILED;
+    }
+
+    bool result = m_status == Status::FINISH;
+    if (LIKELY(result)) {
+        entries.push_back(CodeCacheEntryChunk(cacheIndex, m_currentContext.m_cacheEntry));
+    }
+
+    data.swap(m_currentContext.m_cacheData);
+    m_currentContext.reset();
+    m_status = previousStatus;
+    return result;
+}
+
+std::string CodeCache::createCacheData(const CodeCacheIndex::ScriptID& scriptID, const std::vector<CodeCacheEntryChunk>& entries, const std::string& data)
+{
+    CodeCacheDataHeader header;
+    header.m_fingerprint = codeCacheFingerprint();
+    header.m_srcHash = scriptID.m_srcHash;
+    header.m_srcLength = scriptID.m_srcLength;
+    header.m_entryCount = entries.size();
+
+    std::string result;
+    result.reserve(sizeof(CodeCacheDataHeader) + sizeof(CodeCacheEntryChunk) * entries.size() + data.size());
+    result.append(reinterpret_cast<const char*>(&header), sizeof(CodeCacheDataHeader));
+    result.append(reinterpret_cast<const char*>(entries.data()), sizeof(CodeCacheEntryChunk) * entries.size());
+    result.append(data);
+    return result;
+}
+
+bool CodeCache::loadCacheData(Context* context, Script* script, const char* data, size_t size)
+{
+    ASSERT(GC_is_disabled());
+    ASSERT(!!data);
+
+    // check version and source code of cache data
+    CodeCacheDataHeader header;
+    if (UNLIKELY(size < sizeof(CodeCacheDataHeader))) {
+        ESCARGOT_LOG_ERROR("[CodeCache] invalid in-memory cache data\n");
+        return false;
+    }
+    memcpy(&header, data, sizeof(CodeCacheDataHeader));
+
+    if (UNLIKELY(header.m_fingerprint != codeCacheFingerprint())) {
+        ESCARGOT_LOG_ERROR("[CodeCache] Different Escargot version or build configuration of in-memory cache data\n");
+        return false;
+    }
+
+    if (UNLIKELY(header.m_srcHash != script->sourceCodeHashValue() || header.m_srcLength != script->sourceCode()->length())) {
+        ESCARGOT_LOG_ERROR("[CodeCache] in-memory cache data does not match the source code\n");
+        return false;
+    }
+
+    size_t remainSize = size - sizeof(CodeCacheDataHeader);
+    if (UNLIKELY(!header.m_entryCount || header.m_entryCount > remainSize / sizeof(CodeCacheEntryChunk))) {
+        ESCARGOT_LOG_ERROR("[CodeCache] invalid in-memory cache data\n");
+        return false;
+    }
+
+    // load entries (global code is stored first)
+    CodeCacheListMap cacheList;
+    const char* entryData = data + sizeof(CodeCacheDataHeader);
+    for (size_t i = 0; i < header.m_entryCount; i++) {
+        CodeCacheEntryChunk entryChunk;
+        memcpy(&entryChunk, entryData + i * sizeof(CodeCacheEntryChunk), sizeof(CodeCacheEntryChunk));
+        cacheList.insert(std::make_pair(entryChunk.m_index, entryChunk.m_entry));
+    }
+
+    auto iter = cacheList.find(CodeCacheIndex(header.m_srcHash, header.m_srcLength, SIZE_MAX));
+    if (UNLIKELY(iter == cacheList.end())) {
+        ESCARGOT_LOG_ERROR("[CodeCache] in-memory cache data has no global code\n");
+        return false;
+    }
+
+    Status previousStatus = m_status;
+    if (UNLIKELY(!prepareMemoryCache())) {
+        return false;
+    }
+    m_currentContext.m_cacheFileMap = entryData + header.m_entryCount * sizeof(CodeCacheEntryChunk);
+    m_currentContext.m_cacheFileMapSize = remainSize - header.m_entryCount * sizeof(CodeCacheEntryChunk);
+    m_currentContext.m_memoryCacheList = &cacheList;
+    m_currentContext.m_cacheEntry = iter->second;
+    m_currentContext.m_cacheStringTable = loadCacheStringTable(context);
+
+    // bytecode of every function is loaded here too because cache data is not kept after loading
+    InterpretedCodeBlock* topCodeBlock = loadCodeBlockTree(context, script);
+    ByteCodeBlock* topByteCodeBlock = loadByteCodeBlock(context, topCodeBlock);
+
+    bool result = m_status == Status::FINISH;
+    m_currentContext.reset();
+    m_status = previousStatus;
+
+    if (UNLIKELY(!result)) {
+        return false;
+    }
+
+    ASSERT(!!topCodeBlock && !!topByteCodeBlock);
+    script->m_topCodeBlock = topCodeBlock;
+    topCodeBlock->m_byteCodeBlock = topByteCodeBlock;
+
+    ESCARGOT_LOG_INFO("[CodeCache] Load in-memory CodeCache Done (%s)\n", script->srcName()->toUTF8StringData().data());
+
+    return true;
+}
+
 void CodeCache::prepareCacheLoading(Context* context, const CodeCacheIndex& cacheIndex, const CodeCacheEntry& entry)
 {
     ASSERT(m_enabled && m_status == Status::READY);
@@ -529,6 +791,15 @@ void CodeCache::prepareCacheLoading(Context* context, const CodeCacheIndex& cach
 
     m_currentContext.m_cacheFilePath = createCacheFilePath(m_cacheDirPath, cacheIndex);
     m_currentContext.m_cacheEntry = entry;
+
+    // cache data could be still in the queue of background writer
+    // wait only for the tasks on this file, writing of other cache files goes on
+    if (UNLIKELY(!m_fileWriter->waitForFile(m_currentContext.m_cacheFilePath))) {
+        ESCARGOT_LOG_ERROR("[CodeCache] writing of cache files failed\n");
+        m_status = Status::FAILED;
+        return;
+    }
+
     FILE* dataFile = fopen(m_currentContext.m_cacheFilePath.data(), "rb");
     if (UNLIKELY(!dataFile)) {
         ESCARGOT_LOG_ERROR("[CodeCache] can't open the cache data file %s\n", m_currentContext.m_cacheFilePath.data());
@@ -536,6 +807,20 @@ void CodeCache::prepareCacheLoading(Context* context, const CodeCacheIndex& cach
         return;
     }
     m_currentContext.m_cacheFile = dataFile;
+
+    // map the cache data file read-only so that cache data is read in place from page cache instead of copied by fread
+    // NOTE pages are not shared between processes. the cache directory is locked exclusively by one VMInstance,
+    // the mapping lives only while one cache is loaded and loaded bytecode is copied out of it
+    // fall back to fread if mapping fails
+    struct stat st;
+    if (LIKELY(fstat(fileno(dataFile), &st) == 0 && st.st_size > 0)) {
+        void* map = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fileno(dataFile), 0);
+        if (LIKELY(map != MAP_FAILED)) {
+            m_currentContext.m_cacheFileMap = static_cast<const char*>(map);
+            m_currentContext.m_cacheFileMapSize = st.st_size;
+        }
+    }
+
     m_currentContext.m_cacheStringTable = loadCacheStringTable(context);
 }
 
@@ -550,13 +835,28 @@ void CodeCache::prepareCacheWriting(const CodeCacheIndex& cacheIndex)
 
     m_currentContext.m_cacheFilePath = createCacheFilePath(m_cacheDirPath, cacheIndex);
     m_currentContext.m_cacheStringTable = new CacheStringTable();
-    FILE* dataFile = fopen(m_currentContext.m_cacheFilePath.data(), "ab");
-    if (UNLIKELY(!dataFile)) {
-        ESCARGOT_LOG_ERROR("[CodeCache] can't open the cache data file %s\n", m_currentContext.m_cacheFilePath.data());
+
+    if (UNLIKELY(m_fileWriter->hasFailed())) {
+        ESCARGOT_LOG_ERROR("[CodeCache] writing of cache files failed\n");
         m_status = Status::FAILED;
         return;
     }
-    m_currentContext.m_cacheFile = dataFile;
+
+    if (cacheIndex.m_functionIndex == SIZE_MAX) {
+        // global code writes a new cache data file starting with CodeBlock tree
+        // so discard entries of functions which were stored before
+        CodeCacheIndex::ScriptID scriptID = cacheIndex.scriptID();
+        for (auto iter = m_cacheList.begin(); iter != m_cacheList.end();) {
+            if (iter->first.scriptID() == scriptID) {
+                iter = m_cacheList.erase(iter);
+            } else {
+                iter++;
+            }
+        }
+    }
+
+    // cache data is written after the existing cache data of the same script
+    m_currentContext.m_cacheDataFileSize = cacheDataFileSize(cacheIndex);
 }
 
 bool CodeCache::postCacheLoading()
@@ -585,6 +885,8 @@ bool CodeCache::postCacheWriting(const CodeCacheIndex& cacheIndex)
         m_cacheLRUList[cacheIndex.scriptID()] = fastTickCount();
 
         if (addCacheEntry(cacheIndex, m_currentContext.m_cacheEntry)) {
+            // file I/O is done by background writer
+            m_fileWriter->writeCacheData(m_currentContext.m_cacheFilePath, m_currentContext.m_cacheDataFileSize, std::move(m_currentContext.m_cacheData));
             if (writeCacheList()) {
                 reset();
                 m_status = Status::READY;
@@ -688,7 +990,7 @@ CacheStringTable* CodeCache::loadCacheStringTable(Context* context)
     CodeCacheMetaInfo& metaInfo = m_currentContext.m_cacheEntry.m_metaInfos[(size_t)CodeCacheType::CACHE_STRING];
 
     ASSERT(metaInfo.cacheType == CodeCacheType::CACHE_STRING);
-    ASSERT(m_currentContext.m_cacheFilePath.length());
+    ASSERT(m_currentContext.m_isMemoryCache || m_currentContext.m_cacheFilePath.length());
 
     if (UNLIKELY(!readCacheData(metaInfo))) {
         m_status = Status::FAILED;
@@ -761,7 +1063,7 @@ InterpretedCodeBlock* CodeCache::loadCodeBlockTree(Context* context, Script* scr
     }
 
     // load bytecode of functions
-    if (m_shouldLoadFunctionOnScriptLoading) {
+    if (m_shouldLoadFunctionOnScriptLoading || m_currentContext.m_isMemoryCache) {
         loadAllByteCodeBlockOfFunctions(context, tempCodeBlockVector, script);
     }
 
@@ -808,8 +1110,8 @@ ByteCodeBlock* CodeCache::loadByteCodeBlock(Context* context, InterpretedCodeBlo
 void CodeCache::loadAllByteCodeBlockOfFunctions(Context* context, std::vector<InterpretedCodeBlock*>& codeBlockVector, Script* script)
 {
     // load CodeBlock of functions during loading of global code
-    ASSERT(m_enabled && m_status == Status::IN_PROGRESS);
-    ASSERT(m_currentContext.m_cacheFilePath.length() && m_currentContext.m_cacheFile);
+    ASSERT(m_status == Status::IN_PROGRESS);
+    ASSERT(m_currentContext.m_isMemoryCache || (m_enabled && m_currentContext.m_cacheFilePath.length() && m_currentContext.m_cacheFile));
 
     size_t srcHash = script->sourceCodeHashValue();
     size_t srcLength = script->sourceCode()->length();
@@ -821,7 +1123,17 @@ void CodeCache::loadAllByteCodeBlockOfFunctions(Context* context, std::vector<In
     for (size_t i = 0; i < codeBlockVector.size(); i++) {
         InterpretedCodeBlock* codeBlock = codeBlockVector[i];
         ASSERT(script == codeBlock->script());
-        auto result = searchCache(CodeCacheIndex(srcHash, srcLength, codeBlock->functionStart().index));
+        CodeCacheIndex cacheIndex(srcHash, srcLength, codeBlock->functionStart().index);
+        std::pair<bool, CodeCacheEntry> result;
+        if (m_currentContext.m_isMemoryCache) {
+            auto iter = m_currentContext.m_memoryCacheList->find(cacheIndex);
+            result.first = iter != m_currentContext.m_memoryCacheList->end();
+            if (result.first) {
+                result.second = iter->second;
+            }
+        } else {
+            result = searchCache(cacheIndex);
+        }
         if (result.first) {
             CodeCacheEntry& cacheEntry = result.second;
 
@@ -862,70 +1174,61 @@ void CodeCache::loadAllByteCodeBlockOfFunctions(Context* context, std::vector<In
     m_currentContext = previousContext;
 }
 
+size_t CodeCache::cacheDataFileSize(const CodeCacheIndex& cacheIndex)
+{
+    // size of cache data file is the end of the last cache data of the script
+    CodeCacheIndex::ScriptID scriptID = cacheIndex.scriptID();
+    size_t fileSize = 0;
+    for (auto iter = m_cacheList.begin(); iter != m_cacheList.end(); iter++) {
+        if (iter->first.scriptID() != scriptID) {
+            continue;
+        }
+
+        for (size_t i = 0; i < (size_t)CodeCacheType::CACHE_TYPE_NUM; i++) {
+            const CodeCacheMetaInfo& metaInfo = iter->second.m_metaInfos[i];
+            if (metaInfo.cacheType == CodeCacheType::CACHE_INVALID) {
+                continue;
+            }
+            size_t dataOffset = metaInfo.cacheType == CodeCacheType::CACHE_CODEBLOCK ? 0 : metaInfo.dataOffset;
+            fileSize = std::max(fileSize, dataOffset + metaInfo.dataSize);
+        }
+    }
+    return fileSize;
+}
+
 bool CodeCache::writeCacheList()
 {
     ASSERT(m_enabled);
     ASSERT(m_cacheDirPath.length());
 
     std::string cacheListFilePath = m_cacheDirPath + CODE_CACHE_LIST_FILE_NAME;
-    FILE* listFile = fopen(cacheListFilePath.data(), "wb");
-    if (UNLIKELY(!listFile)) {
-        ESCARGOT_LOG_ERROR("[CodeCache] can't open the cache list file %s\n", cacheListFilePath.data());
-        return false;
-    }
+    size_t listSize = m_cacheList.size();
 
-    // first write Escargot version
-    std::string version = ESCARGOT_VERSION;
-    ASSERT(version.length() > 0);
-    size_t versionHash = std::hash<std::string>{}(version);
-    if (UNLIKELY(fwrite(&versionHash, sizeof(size_t), 1, listFile) != 1)) {
-        ESCARGOT_LOG_ERROR("[CodeCache] fwrite of %s failed\n", cacheListFilePath.data());
-        fclose(listFile);
-        return false;
-    }
+    std::string listData;
+    listData.reserve(sizeof(CodeCacheFingerprint) + sizeof(size_t) + sizeof(CodeCacheEntryChunk) * listSize);
 
-    size_t listSize = m_cacheList.size();
-    // write the number of cache entries
-    if (UNLIKELY(fwrite(&listSize, sizeof(size_t), 1, listFile) != 1)) {
-        ESCARGOT_LOG_ERROR("[CodeCache] fwrite of %s failed\n", cacheListFilePath.data());
-        fclose(listFile);
-        return false;
-    }
+    // first write Escargot version and bytecode layout
+    CodeCacheFingerprint fingerprint = codeCacheFingerprint();
+    listData.append(reinterpret_cast<const char*>(&fingerprint), sizeof(CodeCacheFingerprint));
 
-    size_t entryCount = 0;
-    auto iter = m_cacheList.begin();
-    while (entryCount < listSize) {
-        ASSERT(iter != m_cacheList.end());
+    // write the number of cache entries
+    listData.append(reinterpret_cast<const char*>(&listSize), sizeof(size_t));
 
+    for (auto iter = m_cacheList.begin(); iter != m_cacheList.end(); iter++) {
         CodeCacheEntryChunk entryChunk(iter->first, iter->second);
-        if (UNLIKELY(fwrite(&entryChunk, sizeof(CodeCacheEntryChunk), 1, listFile) != 1)) {
-            ESCARGOT_LOG_ERROR("[CodeCache] fwrite of %s failed\n", cacheListFilePath.data());
-            fclose(listFile);
-            return false;
-        }
-
-        entryCount++;
-        iter++;
+        listData.append(reinterpret_cast<const char*>(&entryChunk), sizeof(CodeCacheEntryChunk));
     }
-    ASSERT(iter == m_cacheList.end());
 
-    fflush(listFile);
-    // FIXME frequent fsync calls can slow down the overall performance
-    /* for performance issue, fsync is skipped for now
-    fsync(fileno(listFile));
-    */
-    fclose(listFile);
+    // the list file is replaced by background writer after the cache data written before
+    m_fileWriter->writeCacheList(cacheListFilePath, std::move(listData));
     return true;
 }
 
 bool CodeCache::writeCacheData(CodeCacheType type, size_t extraCount)
 {
-    ASSERT(m_enabled);
+    ASSERT(m_enabled || m_currentContext.m_isMemoryCache);
     ASSERT(type == CodeCacheType::CACHE_CODEBLOCK || type == CodeCacheType::CACHE_BYTECODE || type == CodeCacheType::CACHE_STRING);
-    ASSERT(!!m_currentContext.m_cacheFilePath.length());
-    ASSERT(!!m_currentContext.m_cacheFile);
-
-    FILE* dataFile = m_currentContext.m_cacheFile;
+    ASSERT(m_currentContext.m_isMemoryCache || m_currentContext.m_cacheFilePath.length());
 
     // meta info
     CodeCacheMetaInfo meta(type, m_currentContext.m_cacheDataOffset, m_cacheWriter->bufferSize());
@@ -937,24 +1240,13 @@ bool CodeCache::writeCacheData(CodeCacheType type, size_t extraCount)
 
     // record correct position for function
     if (type != CodeCacheType::CACHE_CODEBLOCK && m_currentContext.m_cacheDataOffset == 0) {
-        meta.dataOffset = m_currentContext.m_cacheDataOffset = ftell(dataFile);
+        meta.dataOffset = m_currentContext.m_cacheDataOffset = m_currentContext.m_cacheDataFileSize + m_currentContext.m_cacheData.size();
     }
 
     m_currentContext.m_cacheEntry.m_metaInfos[(size_t)type] = meta;
 
-    // write cache data
-    if (UNLIKELY(fwrite(m_cacheWriter->bufferData(), sizeof(char), m_cacheWriter->bufferSize(), dataFile) != m_cacheWriter->bufferSize())) {
-        ESCARGOT_LOG_ERROR("[CodeCache] fwrite of %s failed\n", m_currentContext.m_cacheFilePath.data());
-        m_cacheWriter->clearBuffer();
-        return false;
-    }
-
-    fflush(dataFile);
-    // FIXME frequent fsync calls can slow down the overall performance
-    /* for performance issue, fsync is skipped for now
-    fsync(fileno(dataFile));
-    */
-
+    // cache data is collected in memory and written to the file at once
+    m_currentContext.m_cacheData.append(m_cacheWriter->bufferData(), m_cacheWriter->bufferSize());
     m_currentContext.m_cacheDataOffset += m_cacheWriter->bufferSize();
     m_cacheWriter->clearBuffer();
     return true;
@@ -962,12 +1254,22 @@ bool CodeCache::writeCacheData(CodeCacheType type, size_t extraCount)
 
 bool CodeCache::readCacheData(CodeCacheMetaInfo& metaInfo)
 {
-    ASSERT(m_enabled);
+    ASSERT(m_enabled || m_currentContext.m_isMemoryCache);
     ASSERT(metaInfo.cacheType == CodeCacheType::CACHE_CODEBLOCK || metaInfo.cacheType == CodeCacheType::CACHE_BYTECODE || metaInfo.cacheType == CodeCacheType::CACHE_STRING);
-    ASSERT(!!m_currentContext.m_cacheFilePath.length());
-    ASSERT(!!m_currentContext.m_cacheFile);
+    ASSERT(m_currentContext.m_isMemoryCache ? !!m_currentContext.m_cacheFileMap : (m_currentContext.m_cacheFilePath.length() && m_currentContext.m_cacheFile));
 
     size_t dataOffset = metaInfo.cacheType == CodeCacheType::CACHE_CODEBLOCK ? 0 : metaInfo.dataOffset;
+
+    if (LIKELY(m_currentContext.m_cacheFileMap && dataOffset <= m_currentContext.m_cacheFileMapSize && metaInfo.dataSize <= m_currentContext.m_cacheFileMapSize - dataOffset)) {
+        m_cacheReader->setData(m_currentContext.m_cacheFileMap + dataOffset, metaInfo.dataSize);
+        return true;
+    }
+
+    if (UNLIKELY(m_currentContext.m_isMemoryCache)) {
+        ESCARGOT_LOG_ERROR("[CodeCache] invalid in-memory cache data\n");
+        return false;
+    }
+
     FILE* dataFile = m_currentContext.m_cacheFile;
 
     if (UNLIKELY(fseek(dataFile, dataOffset, SEEK_SET) != 0)) {
@@ -983,6 +1285,21 @@ bool CodeCache::readCacheData(CodeCacheMetaInfo& metaInfo)
     return true;
 }
 
+void CodeCache::flush()
+{
+    if (!m_enabled) {
+        return;
+    }
+
+    ASSERT(m_status == Status::READY);
+    if (UNLIKELY(!m_fileWriter->flush())) {
+        // cache list in memory does not match cache files anymore
+        ESCARGOT_LOG_ERROR("[CodeCache] writing of cache files failed\n");
+        m_status = Status::FAILED;
+        clearAll();
+    }
+}
+
 size_t CodeCache::minSourceLength()
 {
     return m_minSourceLength;
@@ -1012,5 +1329,6 @@ void CodeCache::setShouldLoadFunctionOnScriptLoading(bool s)
 {
     m_shouldLoadFunctionOnScriptLoading = s;
 }
+
 } // namespace Escargot
 #endif // ENABLE_CODE_CACHE
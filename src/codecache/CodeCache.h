@@ -44,6 +44,7 @@ class Script;
 class Context;
 class CodeCacheWriter;
 class CodeCacheReader;
+class CodeCacheFileWriter;
 class CacheStringTable;
 class ByteCodeBlock;
 class InterpretedCodeBlock;
@@ -222,11 +223,18 @@ public:
         FAILED,
     };
 
+    typedef std::unordered_map<CodeCacheIndex, CodeCacheEntry, std::hash<CodeCacheIndex>, std::equal_to<CodeCacheIndex>, std::allocator<std::pair<CodeCacheIndex const, CodeCacheEntry>>> CodeCacheListMap;
+
     struct CodeCacheContext {
         CodeCacheContext()
             : m_cacheFile(nullptr)
+            , m_cacheFileMap(nullptr)
+            , m_cacheFileMapSize(0)
             , m_cacheStringTable(nullptr)
             , m_cacheDataOffset(0)
+            , m_isMemoryCache(false)
+            , m_cacheDataFileSize(0)
+            , m_memoryCacheList(nullptr)
         {
         }
 
@@ -235,8 +243,14 @@ public:
         std::string m_cacheFilePath; // current cache data file path
         CodeCacheEntry m_cacheEntry; // current cache entry
         FILE* m_cacheFile; // current cache data file
+        const char* m_cacheFileMap; // read-only mapping of current cache data file while loading
+        size_t m_cacheFileMapSize; // size of m_cacheFileMap
         CacheStringTable* m_cacheStringTable; // current CacheStringTable
         size_t m_cacheDataOffset; // current offset in cache data file
+        bool m_isMemoryCache; // cache data is held in memory by embedder instead of cache data file
+        std::string m_cacheData; // cache data being written (file I/O is done later by CodeCacheFileWriter)
+        size_t m_cacheDataFileSize; // size of cache data which m_cacheData is written after
+        CodeCacheListMap* m_memoryCacheList; // entries of in-memory cache data being loaded
     };
 
     struct CodeCacheEntryChunk {
@@ -265,7 +279,15 @@ public:
     bool storeGlobalCache(Context* context, const CodeCacheIndex& cacheIndex, InterpretedCodeBlock* topCodeBlock, CodeBlockCacheInfo* codeBlockCacheInfo, Node* programNode, bool inWith);
     bool storeFunctionCache(Context* context, const CodeCacheIndex& cacheIndex, InterpretedCodeBlock* codeBlock, Node* functionNode);
 
+    // in-memory cache data of a single script which embedder takes and gives back (no cache directory is used)
+    // these work even if CodeCache is not enabled
+    bool storeCacheData(Context* context, const CodeCacheIndex& cacheIndex, InterpretedCodeBlock* codeBlock, CodeBlockCacheInfo* codeBlockCacheInfo, Node* node, std::vector<CodeCacheEntryChunk>& entries, std::string& data);
+    static std::string createCacheData(const CodeCacheIndex::ScriptID& scriptID, const std::vector<CodeCacheEntryChunk>& entries, const std::string& data);
+    bool loadCacheData(Context* context, Script* script, const char* data, size_t size);
+
     void clear();
+    // wait until every cache file is written by background writer
+    void flush();
 
     size_t minSourceLength();
     void setMinSourceLength(size_t s);
@@ -279,13 +301,13 @@ private:
 
     CodeCacheContext m_currentContext; // current CodeCache infos
 
-    typedef std::unordered_map<CodeCacheIndex, CodeCacheEntry, std::hash<CodeCacheIndex>, std::equal_to<CodeCacheIndex>, std::allocator<std::pair<CodeCacheIndex const, CodeCacheEntry>>> CodeCacheListMap;
     CodeCacheListMap m_cacheList;
     typedef std::unordered_map<CodeCacheIndex::ScriptID, uint64_t, std::hash<CodeCacheIndex::ScriptID>, std::equal_to<CodeCacheIndex::ScriptID>, std::allocator<std::pair<CodeCacheIndex::ScriptID const, uint64_t>>> CodeCacheLRUList; /* <Hash, TimeStamp> */
     CodeCacheLRUList m_cacheLRUList;
 
     CodeCacheWriter* m_cacheWriter;
     CodeCacheReader* m_cacheReader;
+    CodeCacheFileWriter* m_fileWriter; // background writer of cache files
 
     int m_cacheDirFD; // CodeCache directory file descriptor
     bool m_enabled; // CodeCache enabled
@@ -309,6 +331,8 @@ private:
     bool removeLRUCacheEntry();
     bool removeCacheFile(const CodeCacheIndex::ScriptID& scriptID);
 
+    bool prepareMemoryCache();
+
     void prepareCacheLoading(Context* context, const CodeCacheIndex& cacheIndex, const CodeCacheEntry& entry);
     bool postCacheLoading();
     CacheStringTable* loadCacheStringTable(Context* context);
@@ -325,6 +349,7 @@ private:
     void storeCodeBlockTreeNode(InterpretedCodeBlock* codeBlock, size_t& nodeCount);
     InterpretedCodeBlock* loadCodeBlockTreeNode(Script* script);
 
+    size_t cacheDataFileSize(const CodeCacheIndex& cacheIndex);
     bool writeCacheList();
     bool writeCacheData(CodeCacheType type, size_t extraCount = 0);
     bool readCacheData(CodeCacheMetaInfo& metaInfo);
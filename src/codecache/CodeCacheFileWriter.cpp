@@ -0,0 +1,240 @@
+/*
+ * Copyright (c) 2024-present Samsung Electronics Co., Ltd
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+ *  USA
+ */
+
+#if defined(ENABLE_CODE_CACHE)
+
+#include "Escargot.h"
+#include "codecache/CodeCacheFileWriter.h"
+
+// file libraries
+#include <fcntl.h>
+#include <unistd.h>
+
+#define CODE_CACHE_TEMP_FILE_SUFFIX ".tmp"
+
+namespace Escargot {
+
+static bool writeNewFile(const std::string& filePath, const std::string& data)
+{
+    // write a temporal file and rename it so that the file is replaced atomically
+    std::string tempFilePath = filePath + CODE_CACHE_TEMP_FILE_SUFFIX;
+    FILE* file = fopen(tempFilePath.data(), "wb");
+    if (UNLIKELY(!file)) {
+        ESCARGOT_LOG_ERROR("[CodeCache] can't open the cache file %s\n", tempFilePath.data());
+        return false;
+    }
+
+    if (UNLIKELY(fwrite(data.data(), sizeof(char), data.size(), file) != data.size())) {
+        ESCARGOT_LOG_ERROR("[CodeCache] fwrite of %s failed\n", tempFilePath.data());
+        fclose(file);
+        remove(tempFilePath.data());
+        return false;
+    }
+
+    // FIXME frequent fsync calls can slow down the overall performance
+    /* for performance issue, fsync is skipped for now
+    fflush(file);
+    fsync(fileno(file));
+    */
+    fclose(file);
+
+    if (UNLIKELY(rename(tempFilePath.data(), filePath.data()) != 0)) {
+        ESCARGOT_LOG_ERROR("[CodeCache] can't rename the cache file %s\n", tempFilePath.data());
+        remove(tempFilePath.data());
+        return false;
+    }
+
+    return true;
+}
+
+static bool writeFileAt(const std::string& filePath, size_t offset, const std::string& data)
+{
+    // data is written at the given offset, not appended
+    // so that any garbage left by an interrupted write is overwritten
+    int fd = open(filePath.data(), O_WRONLY);
+    if (UNLIKELY(fd == -1)) {
+        ESCARGOT_LOG_ERROR("[CodeCache] can't open the cache data file %s\n", filePath.data());
+        return false;
+    }
+
+    size_t written = 0;
+    while (written < data.size()) {
+        ssize_t result = pwrite(fd, data.data() + written, data.size() - written, offset + written);
+        if (UNLIKELY(result <= 0)) {
+            ESCARGOT_LOG_ERROR("[CodeCache] write of %s failed\n", filePath.data());
+            close(fd);
+            return false;
+        }
+        written += result;
+    }
+
+    close(fd);
+    return true;
+}
+
+CodeCacheFileWriter::CodeCacheFileWriter()
+    : m_running(false)
+    , m_failed(false)
+    , m_terminating(false)
+{
+}
+
+CodeCacheFileWriter::~CodeCacheFileWriter()
+{
+    flush();
+
+    if (m_thread.joinable()) {
+        {
+            std::lock_guard<std::mutex> guard(m_mutex);
+            m_terminating = true;
+        }
+        m_taskCondition.notify_one();
+        m_thread.join();
+    }
+}
+
+void CodeCacheFileWriter::writeCacheData(const std::string& filePath, size_t offset, std::string&& data)
+{
+    addTask(TaskType::WriteData, filePath, offset, std::move(data));
+}
+
+void CodeCacheFileWriter::writeCacheList(const std::string& filePath, std::string&& data)
+{
+    addTask(TaskType::WriteList, filePath, 0, std::move(data));
+}
+
+void CodeCacheFileWriter::removeCacheFile(const std::string& filePath)
+{
+    addTask(TaskType::Remove, filePath, 0, std::string());
+}
+
+bool CodeCacheFileWriter::flush()
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_idleCondition.wait(lock, [this]() {
+        return m_tasks.empty() && !m_running;
+    });
+    return !m_failed;
+}
+
+bool CodeCacheFileWriter::waitForFile(const std::string& filePath)
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_idleCondition.wait(lock, [this, &filePath]() {
+        return m_pendingFiles.find(filePath) == m_pendingFiles.end();
+    });
+    return !m_failed;
+}
+
+bool CodeCacheFileWriter::hasFailed()
+{
+    std::lock_guard<std::mutex> guard(m_mutex);
+    return m_failed;
+}
+
+void CodeCacheFileWriter::addTask(TaskType type, const std::string& filePath, size_t offset, std::string&& data)
+{
+    {
+        std::lock_guard<std::mutex> guard(m_mutex);
+        if (UNLIKELY(m_failed)) {
+            return;
+        }
+
+        m_tasks.push_back(Task{ type, filePath, offset, std::move(data) });
+        m_pendingFiles[filePath]++;
+
+        // start writer thread lazily
+        if (!m_thread.joinable()) {
+            m_thread = std::thread(&CodeCacheFileWriter::run, this);
+        }
+    }
+    m_taskCondition.notify_one();
+}
+
+void CodeCacheFileWriter::run()
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while (true) {
+        m_taskCondition.wait(lock, [this]() {
+            return !m_tasks.empty() || m_terminating;
+        });
+
+        if (m_tasks.empty()) {
+            ASSERT(m_terminating);
+            break;
+        }
+
+        Task task = std::move(m_tasks.front());
+        m_tasks.pop_front();
+        m_running = true;
+
+        lock.unlock();
+        bool result = runTask(task);
+        lock.lock();
+
+        m_running = false;
+        bool fileDone = false;
+        auto iter = m_pendingFiles.find(task.m_filePath);
+        ASSERT(iter != m_pendingFiles.end());
+        if (--iter->second == 0) {
+            m_pendingFiles.erase(iter);
+            fileDone = true;
+        }
+
+        if (UNLIKELY(!result)) {
+            // drop the following tasks
+            m_failed = true;
+            m_tasks.clear();
+            m_pendingFiles.clear();
+        }
+
+        if (fileDone || m_tasks.empty()) {
+            m_idleCondition.notify_all();
+        }
+    }
+}
+
+bool CodeCacheFileWriter::runTask(Task& task)
+{
+    switch (task.m_type) {
+    case TaskType::WriteData:
+        if (task.m_offset == 0) {
+            return writeNewFile(task.m_filePath, task.m_data);
+        }
+        return writeFileAt(task.m_filePath, task.m_offset, task.m_data);
+    case TaskType::WriteList:
+        return writeNewFile(task.m_filePath, task.m_data);
+    case TaskType::Remove:
+        if (remove(task.m_filePath.data()) != 0) {
+            ESCARGOT_LOG_ERROR("[CodeCache] can`t remove a cache file %s\n", task.m_filePath.data());
+            return false;
+        }
+#ifndef NDEBUG
+        ESCARGOT_LOG_INFO("[CodeCache] remove a cache file %s\n", task.m_filePath.data());
+#endif
+        return true;
+    default:
+        RELEASE_ASSERT_NOT_REACHED();
+        return false;
+    }
+}
+
+} // namespace Escargot
+
+#endif // ENABLE_CODE_CACHE
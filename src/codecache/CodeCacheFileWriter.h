@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) 2024-present Samsung Electronics Co., Ltd
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+ *  USA
+ */
+
+#ifndef __CodeCacheFileWriter__
+#define __CodeCacheFileWriter__
+
+#if defined(ENABLE_CODE_CACHE)
+
+#include <string>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <deque>
+#include <unordered_map>
+
+namespace Escargot {
+
+// CodeCacheFileWriter performs file I/O of CodeCache on a background thread
+// so that storing cache does not put disk latency on script loading
+// tasks are processed in the order they are requested. once a task fails, every following task is dropped
+// because the cache list of later tasks may refer to cache data which was not written
+class CodeCacheFileWriter {
+public:
+    CodeCacheFileWriter();
+    ~CodeCacheFileWriter();
+
+    // write data at offset of the cache data file
+    // data of a new file (offset 0) is written to a temporal file first and renamed
+    void writeCacheData(const std::string& filePath, size_t offset, std::string&& data);
+    // replace the cache list file by writing a temporal file and renaming it
+    void writeCacheList(const std::string& filePath, std::string&& data);
+    void removeCacheFile(const std::string& filePath);
+
+    // wait until every requested task is done
+    // returns false if any task failed
+    bool flush();
+    // wait only until tasks on the file are done (e.g. before reading the file)
+    // returns false if any task failed
+    bool waitForFile(const std::string& filePath);
+    bool hasFailed();
+
+private:
+    enum class TaskType : uint8_t {
+        WriteData,
+        WriteList,
+        Remove,
+    };
+
+    struct Task {
+        TaskType m_type;
+        std::string m_filePath;
+        size_t m_offset;
+        std::string m_data;
+    };
+
+    void addTask(TaskType type, const std::string& filePath, size_t offset, std::string&& data);
+    void run();
+    bool runTask(Task& task);
+
+    std::thread m_thread;
+    std::mutex m_mutex;
+    std::condition_variable m_taskCondition;
+    std::condition_variable m_idleCondition;
+    std::deque<Task> m_tasks;
+    std::unordered_map<std::string, size_t> m_pendingFiles; // count of queued or running tasks of each file
+    bool m_running; // a task is being processed
+    bool m_failed;
+    bool m_terminating;
+};
+} // namespace Escargot
+
+#endif // ENABLE_CODE_CACHE
+
+#endif
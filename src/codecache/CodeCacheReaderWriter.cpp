@@ -643,28 +643,43 @@ void CodeCacheWriter::storeByteCodeStream(ByteCodeBlock* block)
     }
 }
 
-void CodeCacheReader::CacheBuffer::resize(size_t size)
+char* CodeCacheReader::CacheBuffer::resize(size_t size)
 {
     ASSERT(!m_buffer && m_capacity == 0 && m_index == 0);
 
-    m_buffer = static_cast<char*>(malloc(size));
+    char* buffer = static_cast<char*>(malloc(size));
+    m_buffer = buffer;
     m_capacity = size;
+    m_isExternal = false;
+    return buffer;
+}
+
+void CodeCacheReader::CacheBuffer::setExternalData(const char* data, size_t size)
+{
+    ASSERT(!m_buffer && m_capacity == 0 && m_index == 0);
+
+    m_buffer = data;
+    m_capacity = size;
+    m_isExternal = true;
 }
 
 void CodeCacheReader::CacheBuffer::reset()
 {
     if (m_buffer) {
-        free(m_buffer);
+        if (!m_isExternal) {
+            free(const_cast<char*>(m_buffer));
+        }
         m_buffer = nullptr;
     }
     m_capacity = 0;
     m_index = 0;
+    m_isExternal = false;
 }
 
 bool CodeCacheReader::loadData(FILE* file, size_t size)
 {
-    m_buffer.resize(size);
-    if (UNLIKELY(fread((void*)bufferData(), sizeof(char), size, file) != size)) {
+    char* buffer = m_buffer.resize(size);
+    if (UNLIKELY(fread((void*)buffer, sizeof(char), size, file) != size)) {
         clearBuffer();
         return false;
     }
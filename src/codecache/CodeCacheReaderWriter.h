@@ -233,6 +233,7 @@ public:
             : m_buffer(nullptr)
             , m_capacity(0)
             , m_index(0)
+            , m_isExternal(false)
         {
         }
 
@@ -241,10 +242,13 @@ public:
             reset();
         }
 
-        char* data() const { return m_buffer; }
+        const char* data() const { return m_buffer; }
         size_t size() const { return m_index; }
         size_t index() const { return m_index; }
-        void resize(size_t size);
+        // allocates an owned buffer and returns it to be filled
+        char* resize(size_t size);
+        // reads data owned by someone else (e.g. mmaped cache data file) without copying it
+        void setExternalData(const char* data, size_t size);
         void reset();
 
         template <typename IntegralType>
@@ -303,9 +307,10 @@ public:
         }
 
     private:
-        char* m_buffer;
+        const char* m_buffer;
         size_t m_capacity;
         size_t m_index;
+        bool m_isExternal;
     };
 
     CodeCacheReader()
@@ -330,10 +335,11 @@ public:
         return m_stringTable;
     }
 
-    char* bufferData() { return m_buffer.data(); }
+    const char* bufferData() { return m_buffer.data(); }
     size_t bufferIndex() const { return m_buffer.index(); }
     void clearBuffer() { m_buffer.reset(); }
     bool loadData(FILE*, size_t);
+    void setData(const char* data, size_t size) { m_buffer.setExternalData(data, size); }
 
     InterpretedCodeBlock* loadInterpretedCodeBlock(Context* context, Script* script);
     ByteCodeBlock* loadByteCodeBlock(Context* context, InterpretedCodeBlock* topCodeBlock);
@@ -343,6 +343,30 @@ void iterateSpecificKindOfObject(ExecutionState& state, HeapObjectKind kind, Hea
     GC_enable();
 }
 
+void collectHeapObjectKindStats(HeapObjectKindStats (&stats)[HeapObjectKind::NumberOfKind])
+{
+    memset(stats, 0, sizeof(stats));
+
+    ASSERT(!GC_is_disabled());
+    GC_disable();
+    GC_enumerate_reachable_objects_inner([](void* obj, size_t bytes, void* cd) {
+        size_t size;
+        int kind = GC_get_kind_and_size(obj, &size);
+        ASSERT(size == bytes);
+
+        HeapObjectKindStats* stats = (HeapObjectKindStats*)cd;
+        for (size_t i = 0; i < HeapObjectKind::NumberOfKind; i++) {
+            if (s_gcKinds[i] == kind) {
+                stats[i].m_count++;
+                stats[i].m_bytes += bytes;
+                break;
+            }
+        }
+    },
+                                         (void*)stats);
+    GC_enable();
+}
+
 template <>
 Value* CustomAllocator<Value>::allocate(size_type GC_n, const void*)
 {
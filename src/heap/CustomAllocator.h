@@ -68,6 +68,17 @@ enum HeapObjectKind : unsigned {
 
 void initializeCustomAllocators();
 
+struct HeapObjectKindStats {
+    size_t m_count;
+    size_t m_bytes;
+};
+
+/*
+ * This Function counts objects of every kind marked by the last GC.
+ * It walks the heap but does not collect, so the result is as of the last GC.
+ */
+void collectHeapObjectKindStats(HeapObjectKindStats (&stats)[HeapObjectKind::NumberOfKind]);
+
 typedef std::function<void(ExecutionState& state, void* obj)> HeapObjectIteratorCallback;
 
 /*
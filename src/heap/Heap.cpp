@@ -24,6 +24,10 @@
 
 namespace Escargot {
 
+MAY_THREAD_LOCAL bool Heap::g_worldStopped;
+MAY_THREAD_LOCAL uint64_t Heap::g_pauseStartTime;
+MAY_THREAD_LOCAL Heap::PauseHistogram Heap::g_pauseHistogram;
+
 void Heap::initialize()
 {
     // disable data area searching in bdwgc
@@ -40,6 +44,9 @@ void Heap::initialize()
     GC_set_force_unmap_on_gcollect(1);
     initializeCustomAllocators();
 
+    g_worldStopped = false;
+    resetPauseHistogram();
+
 #ifdef PROFILE_BDWGC
     GCUtil::HeapUsageVisualizer::initialize();
 #endif
@@ -52,6 +59,82 @@ void Heap::finalize()
     }
 }
 
+bool Heap::setCollectionMode(CollectionMode mode, size_t pauseTimeTargetInMilliseconds)
+{
+    if (mode == Incremental) {
+        if (!GC_is_incremental_mode()) {
+            GC_enable_incremental();
+            if (!GC_is_incremental_mode()) {
+                return false;
+            }
+        }
+        GC_set_time_limit(pauseTimeTargetInMilliseconds ? pauseTimeTargetInMilliseconds : GC_TIME_UNLIMITED);
+    } else if (GC_is_incremental_mode()) {
+        GC_set_time_limit(GC_TIME_UNLIMITED);
+    }
+    return true;
+}
+
+Heap::CollectionMode Heap::collectionMode()
+{
+    return GC_is_incremental_mode() ? Incremental : StopTheWorld;
+}
+
+void Heap::recordGCEvent(GC_EventType type)
+{
+    switch (type) {
+    case GC_EVENT_PRE_STOP_WORLD:
+        g_worldStopped = true;
+        g_pauseStartTime = longTickCount();
+        break;
+    case GC_EVENT_POST_START_WORLD:
+        g_worldStopped = false;
+        recordPause(longTickCount() - g_pauseStartTime);
+        break;
+    case GC_EVENT_MARK_START:
+        // bdwgc built without thread support does not report stopping the world
+        if (!g_worldStopped) {
+            g_pauseStartTime = longTickCount();
+        }
+        break;
+    case GC_EVENT_MARK_END:
+        if (!g_worldStopped) {
+            recordPause(longTickCount() - g_pauseStartTime);
+        }
+        break;
+    case GC_EVENT_RECLAIM_START:
+        g_pauseStartTime = longTickCount();
+        break;
+    case GC_EVENT_RECLAIM_END:
+        recordPause(longTickCount() - g_pauseStartTime);
+        break;
+    default:
+        break;
+    }
+}
+
+void Heap::recordPause(uint64_t pauseInMicroseconds)
+{
+    PauseHistogram& histogram = g_pauseHistogram;
+    histogram.m_count++;
+    histogram.m_totalMicroseconds += pauseInMicroseconds;
+    histogram.m_maxMicroseconds = std::max(histogram.m_maxMicroseconds, pauseInMicroseconds);
+    histogram.m_lastMicroseconds = pauseInMicroseconds;
+
+    size_t bucket = 0;
+    uint64_t bound = 1000;
+    while (bucket < PauseHistogramBucketCount - 1 && pauseInMicroseconds >= bound) {
+        bucket++;
+        bound *= 2;
+    }
+    histogram.m_buckets[bucket]++;
+}
+
+void Heap::resetPauseHistogram()
+{
+    memset(&g_pauseHistogram, 0, sizeof(PauseHistogram));
+}
+
 void Heap::printGCHeapUsage()
 {
 #ifdef ESCARGOT_MEM_STATS
@@ -25,9 +25,61 @@ namespace Escargot {
 
 class Heap {
 public:
+    enum CollectionMode {
+        // incremental mode with an unlimited time slice is the same as StopTheWorld
+        StopTheWorld,
+        // marking is done in short steps between allocations
+        // Escargot has no write barrier. every store into heap (Object slots, EncodedValues, ByteCodeBlock literal vectors,
+        // gc vectors...) is a plain store and objects modified during marking are found by virtual dirty bits of bdwgc
+        // - Linux: soft-dirty bits of /proc/self/pagemap, or page protection where soft-dirty bits are not available
+        // - Windows: GetWriteWatch, or page protection
+        // - macOS and other POSIX: page protection
+        // - platforms without any of them (e.g. wasm, bare-metal) cannot use Incremental
+        // with page protection a system call writing into a heap page that may hold pointers fails instead of faulting,
+        // so native code must not pass such memory to the kernel as an output buffer. pointer-free (atomic) blocks are not protected
+        Incremental,
+    };
+
+    // each pause is counted in buckets of power of 2 milliseconds
+    enum : size_t { PauseHistogramBucketCount = 10 };
+    struct PauseHistogram {
+        size_t m_count;
+        uint64_t m_totalMicroseconds;
+        uint64_t m_maxMicroseconds;
+        uint64_t m_lastMicroseconds;
+        // m_buckets[i] counts pauses shorter than 2^i ms. the last bucket counts the others
+        size_t m_buckets[PauseHistogramBucketCount];
+    };
+
     static void initialize();
     static void finalize();
     static void printGCHeapUsage();
+
+    // collection mode is a process-wide state of bdwgc and incremental mode cannot be turned off once it is entered
+    // returns false if bdwgc is built without virtual dirty bit support
+    // pauseTimeTarget of 0 means an unlimited time slice.
+    // StopTheWorld after Incremental sets an unlimited time slice to finish each collection at once,
+    // but dirty bits are still tracked and collectionMode keeps returning Incremental
+    static bool setCollectionMode(CollectionMode mode, size_t pauseTimeTargetInMilliseconds);
+    static CollectionMode collectionMode();
+
+    // called for every GC event before the event listeners
+    // every interval in which the collecting thread cannot run JavaScript is recorded as a pause when it ends:
+    // each time the world is stopped (for marking, or for a time-limited mark step in incremental mode) and each reclaim phase
+    // mark steps bdwgc does inside allocation while the world runs raise no GC event, so they are not recorded
+    static void recordGCEvent(GC_EventType type);
+    static const PauseHistogram& pauseHistogram()
+    {
+        return g_pauseHistogram;
+    }
+    static void resetPauseHistogram();
+
+private:
+    static void recordPause(uint64_t pauseInMicroseconds);
+
+    static MAY_THREAD_LOCAL bool g_worldStopped;
+    static MAY_THREAD_LOCAL uint64_t g_pauseStartTime;
+    static MAY_THREAD_LOCAL PauseHistogram g_pauseHistogram;
 };
 } // namespace Escargot
 
@@ -0,0 +1,776 @@
+/*
+ * Copyright (c) 2024-present Samsung Electronics Co., Ltd
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+ *  USA
+ */
+
+#include "Escargot.h"
+#include "HeapSnapshot.h"
+#include "runtime/Object.h"
+#include "runtime/Context.h"
+#include "runtime/ArrayObject.h"
+#include "runtime/FunctionObject.h"
+#include "runtime/Symbol.h"
+#include "parser/CodeBlock.h"
+
+#include <cerrno>
+#if defined(_WINDOWS)
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+// strings longer than this are cut in node names
+#define HEAP_SNAPSHOT_STRING_NAME_MAX_LENGTH 1024
+// total bytes of distinct names. names which do not fit are written as "(string)"
+#define HEAP_SNAPSHOT_STRING_TABLE_MAX_SIZE (16 * 1024 * 1024)
+
+namespace Escargot {
+
+static inline void* userPointer(void* base)
+{
+    return GC_USR_PTR_FROM_BASE(base);
+}
+
+// object kinds of GC_MALLOC_UNCOLLECTABLE and GC_MALLOC_ATOMIC_UNCOLLECTABLE blocks in bdwgc
+// (UNCOLLECTABLE and AUNCOLLECTABLE of gc_priv.h)
+static inline bool isUncollectableKind(int kind)
+{
+    return kind == 2 || kind == 3;
+}
+
+// returns false if reading str needs allocation (rope, compressed or unloaded string)
+static bool readStringContent(String* str, std::string& result)
+{
+    if (str->isRopeString() || str->isCompressibleString() || str->isReloadableString()) {
+        return false;
+    }
+
+    StringBufferAccessData data = str->bufferAccessData();
+    data.length = std::min(data.length, (size_t)HEAP_SNAPSHOT_STRING_NAME_MAX_LENGTH);
+    UTF8StringDataNonGCStd utf8 = data.toUTF8String<UTF8StringDataNonGCStd>(StringWriteOption::ReplaceInvalidUtf8);
+    result.append(utf8.data(), utf8.length());
+    return true;
+}
+
+static const char* objectClassName(Object* obj)
+{
+    if (obj->isArrayObject()) {
+        return "Array";
+    } else if (obj->isFunctionObject() || obj->isBoundFunctionObject()) {
+        return "Function";
+    } else if (obj->isErrorObject()) {
+        return "Error";
+    } else if (obj->isRegExpObject()) {
+        return "RegExp";
+    } else if (obj->isDateObject()) {
+        return "Date";
+    } else if (obj->isMapObject()) {
+        return "Map";
+    } else if (obj->isSetObject()) {
+        return "Set";
+    } else if (obj->isWeakMapObject()) {
+        return "WeakMap";
+    } else if (obj->isWeakSetObject()) {
+        return "WeakSet";
+    } else if (obj->isWeakRefObject()) {
+        return "WeakRef";
+    } else if (obj->isFinalizationRegistryObject()) {
+        return "FinalizationRegistry";
+    } else if (obj->isPromiseObject()) {
+        return "Promise";
+    } else if (obj->isProxyObject()) {
+        return "Proxy";
+    } else if (obj->isArrayBufferObject()) {
+        return "ArrayBuffer";
+    } else if (obj->isSharedArrayBufferObject()) {
+        return "SharedArrayBuffer";
+    } else if (obj->isTypedArrayObject()) {
+        return "TypedArray";
+    } else if (obj->isDataViewObject()) {
+        return "DataView";
+    } else if (obj->isStringObject()) {
+        return "String";
+    } else if (obj->isNumberObject()) {
+        return "Number";
+    } else if (obj->isBooleanObject()) {
+        return "Boolean";
+    } else if (obj->isSymbolObject()) {
+        return "Symbol";
+    } else if (obj->isBigIntObject()) {
+        return "BigInt";
+    } else if (obj->isArgumentsObject()) {
+        return "Arguments";
+    } else if (obj->isGeneratorObject()) {
+        return "Generator";
+    } else if (obj->isAsyncGeneratorObject()) {
+        return "AsyncGenerator";
+    } else if (obj->isIteratorObject()) {
+        return "Iterator";
+    } else if (obj->isModuleNamespaceObject()) {
+        return "Module";
+    } else if (obj->isGlobalObject()) {
+        return "global";
+    }
+    return "Object";
+}
+
+HeapSnapshot::HeapSnapshot(int fd)
+    : m_fd(fd)
+    , m_failed(false)
+    , m_stringTableSize(0)
+    , m_bufferUsed(0)
+{
+}
+
+bool HeapSnapshot::write(int fd)
+{
+    std::unique_ptr<HeapSnapshot> snapshot(new HeapSnapshot(fd));
+
+    ASSERT(!GC_is_disabled());
+    GC_gcollect(); // update mark status
+    // blocks are read in place, so nothing may be collected until the graph is built
+    GC_disable();
+    snapshot->collectNodes();
+    snapshot->classifyNodes();
+    snapshot->nameNodes();
+    snapshot->collectEdges();
+    snapshot->collectRoots();
+    GC_enable();
+
+    snapshot->writeSnapshot();
+    return !snapshot->m_failed;
+}
+
+void HeapSnapshot::collectNodes()
+{
+    GC_enumerate_reachable_objects_inner([](void* obj, size_t bytes, void* cd) {
+        size_t size;
+        int kind = GC_get_kind_and_size(obj, &size);
+        ASSERT(size == bytes);
+
+        Node node;
+        node.m_base = obj;
+        node.m_size = static_cast<uint32_t>(bytes);
+        node.m_firstEdge = 0;
+        node.m_name = 0;
+        node.m_type = HiddenNode;
+        node.m_hasPointers = (kind != GC_I_PTRFREE);
+        node.m_isUncollectable = isUncollectableKind(kind);
+        ((std::vector<Node>*)cd)->push_back(node);
+    },
+                                         (void*)&m_nodes);
+
+    std::sort(m_nodes.begin(), m_nodes.end(), [](const Node& a, const Node& b) {
+        return reinterpret_cast<size_t>(a.m_base) < reinterpret_cast<size_t>(b.m_base);
+    });
+}
+
+size_t HeapSnapshot::findNode(const void* ptr)
+{
+    size_t address = reinterpret_cast<size_t>(ptr);
+    if (!address || m_nodes.empty()) {
+        return NotFound;
+    }
+
+    // the last node whose base is not above ptr
+    auto iter = std::upper_bound(m_nodes.begin(), m_nodes.end(), address, [](size_t address, const Node& node) {
+        return address < reinterpret_cast<size_t>(node.m_base);
+    });
+    if (iter == m_nodes.begin()) {
+        return NotFound;
+    }
+    iter--;
+
+    // only a pointer to the start of a block keeps it alive
+    if (reinterpret_cast<size_t>(userPointer(iter->m_base)) != address) {
+        return NotFound;
+    }
+    return iter - m_nodes.begin();
+}
+
+void HeapSnapshot::classifyNodes()
+{
+    m_objectTags.insert(PointerValue::g_objectTag);
+    m_objectTags.insert(PointerValue::g_prototypeObjectTag);
+    m_objectTags.insert(PointerValue::g_arrayObjectTag);
+    m_objectTags.insert(PointerValue::g_arrayPrototypeObjectTag);
+    m_objectTags.insert(PointerValue::g_scriptFunctionObjectTag);
+
+    // vtable addresses of other classes are learned from values held by the objects found so far
+    // a block is recognized by its first word, which is the vtable address for every PointerValue
+    // atomic blocks hold raw data (string buffers, numbers...) whose first word may equal a vtable address by chance,
+    // so only blocks which may hold pointers are recognized here
+    bool learned = true;
+    while (learned) {
+        learned = false;
+        for (auto& node : m_nodes) {
+            if (node.m_type != HiddenNode || !node.m_hasPointers || node.m_size < sizeof(size_t) * 2) {
+                continue;
+            }
+
+            void* ptr = userPointer(node.m_base);
+            size_t tag = *reinterpret_cast<size_t*>(ptr);
+            if (m_objectTags.find(tag) != m_objectTags.end()) {
+                if (node.m_size >= sizeof(Object)) {
+                    node.m_type = ObjectNode;
+                    learned |= learnTags(reinterpret_cast<Object*>(ptr));
+                }
+            } else if (m_stringTags.find(tag) != m_stringTags.end()) {
+                node.m_type = StringNode;
+            } else if (m_symbolTags.find(tag) != m_symbolTags.end()) {
+                node.m_type = SymbolNode;
+            } else if (m_bigIntTags.find(tag) != m_bigIntTags.end()) {
+                node.m_type = BigIntNode;
+            }
+        }
+    }
+}
+
+bool HeapSnapshot::learnTags(Object* obj)
+{
+    bool learned = false;
+
+    Optional<Object*> prototype = obj->rawInternalPrototypeObject();
+    if (prototype) {
+        learnTag(Value(prototype.value()), learned);
+    }
+
+    // accessor slots hold internal values, so only plain data properties are trusted
+    ObjectStructure* structure = obj->m_structure;
+    size_t propertyCount = structure->propertyCount();
+    for (size_t i = 0; i < propertyCount; i++) {
+        if (structure->readProperty(i).m_descriptor.isPlainDataProperty()) {
+            Value value = obj->m_values[i];
+            learnTag(value, learned);
+        }
+    }
+
+    if (obj->isArrayObject()) {
+        ArrayObject* array = obj->asArrayObject();
+        if (array->isFastModeArray()) {
+            for (uint32_t i = 0; i < array->m_arrayLength; i++) {
+                Value value = array->m_fastModeData[i];
+                learnTag(value, learned);
+            }
+        }
+    }
+
+    return learned;
+}
+
+void HeapSnapshot::learnTag(const Value& value, bool& learned)
+{
+    if (!value.isPointerValue()) {
+        return;
+    }
+
+    PointerValue* pointerValue = value.asPointerValue();
+    std::unordered_set<size_t>* tags;
+    NodeType type;
+    if (pointerValue->isObject()) {
+        tags = &m_objectTags;
+        type = ObjectNode;
+    } else if (pointerValue->isString()) {
+        tags = &m_stringTags;
+        type = StringNode;
+    } else if (pointerValue->isSymbol()) {
+        tags = &m_symbolTags;
+        type = SymbolNode;
+    } else if (pointerValue->isBigInt()) {
+        tags = &m_bigIntTags;
+        type = BigIntNode;
+    } else {
+        return;
+    }
+
+    // atomic blocks (BigInt, strings of external memory) are not classified by their first word,
+    // so they are typed here when an object is found to hold them
+    size_t index = findNode(pointerValue);
+    if (index != NotFound && !m_nodes[index].m_hasPointers && m_nodes[index].m_type == HiddenNode) {
+        m_nodes[index].m_type = type;
+    }
+
+    if (tags->insert(pointerValue->getVTag()).second) {
+        learned = true;
+    }
+}
+
+void HeapSnapshot::nameNodes()
+{
+    // storage blocks owned by objects are named first
+    // their values are written as edges of the owner object
+    auto nameStorage = [this](const void* ptr, NodeType type, const char* name) {
+        size_t index = findNode(ptr);
+        if (index != NotFound && m_nodes[index].m_type == HiddenNode) {
+            m_nodes[index].m_type = type;
+            m_nodes[index].m_name = stringIndex(name);
+        }
+    };
+
+    for (auto& node : m_nodes) {
+        if (node.m_type != ObjectNode) {
+            continue;
+        }
+        Object* obj = reinterpret_cast<Object*>(userPointer(node.m_base));
+        nameStorage(obj->m_structure, ObjectShapeNode, "(object structure)");
+        nameStorage(&obj->m_values[0], ArrayNode, "(object properties)");
+        if (obj->isArrayObject() && obj->asArrayObject()->isFastModeArray()) {
+            nameStorage(&obj->asArrayObject()->m_fastModeData[0], ArrayNode, "(object elements)");
+        }
+        // every Context has functions, so Contexts and VMInstances are found from them
+        if (obj->isFunctionObject() && obj->asFunctionObject()->codeBlock()) {
+            Context* context = obj->asFunctionObject()->codeBlock()->context();
+            if (context) {
+                addNamedRoot(context, ContextRoots, "Context");
+                addNamedRoot(context->vmInstance(), VMInstanceRoots, "VMInstance");
+            }
+        }
+    }
+
+    for (auto& node : m_nodes) {
+        void* ptr = userPointer(node.m_base);
+        switch (node.m_type) {
+        case ObjectNode: {
+            Object* obj = reinterpret_cast<Object*>(ptr);
+            if (obj->isFunctionObject()) {
+                node.m_type = ClosureNode;
+                CodeBlock* codeBlock = obj->asFunctionObject()->codeBlock();
+                node.m_name = codeBlock ? stringIndex(codeBlock->functionName().string()) : stringIndex("");
+            } else {
+                if (obj->isRegExpObject()) {
+                    node.m_type = RegExpNode;
+                }
+                node.m_name = stringIndex(objectClassName(obj));
+            }
+            break;
+        }
+        case StringNode: {
+            String* str = reinterpret_cast<String*>(ptr);
+            if (str->isRopeString()) {
+                node.m_type = ConcatenatedStringNode;
+                node.m_name = stringIndex("(concatenated string)");
+            } else {
+                node.m_name = stringIndex(str);
+            }
+            break;
+        }
+        case SymbolNode: {
+            std::string name = "Symbol(";
+            readStringContent(reinterpret_cast<Symbol*>(ptr)->descriptionString(), name);
+            name += ")";
+            node.m_name = stringIndex(name);
+            break;
+        }
+        case BigIntNode:
+            node.m_name = stringIndex("(bigint)");
+            break;
+        case HiddenNode:
+            node.m_name = stringIndex(node.m_hasPointers ? "(internal)" : "(internal data)");
+            break;
+        default:
+            break;
+        }
+    }
+}
+
+void HeapSnapshot::collectEdges()
+{
+    for (size_t i = 0; i < m_nodes.size(); i++) {
+        Node& node = m_nodes[i];
+        node.m_firstEdge = static_cast<uint32_t>(m_edges.size());
+        switch (node.m_type) {
+        case ObjectNode:
+        case ClosureNode:
+        case RegExpNode:
+            collectObjectEdges(i, reinterpret_cast<Object*>(userPointer(node.m_base)));
+            break;
+        case ArrayNode:
+            // values in property and element storage are edges of the owner object
+            break;
+        default:
+            if (node.m_hasPointers) {
+                collectConservativeEdges(i, 0, NotFound);
+            }
+            break;
+        }
+    }
+}
+
+void HeapSnapshot::collectObjectEdges(size_t index, Object* obj)
+{
+    addEdge(InternalEdge, "map", obj->m_structure);
+    if (obj->hasRareData()) {
+        addEdge(InternalEdge, "(rare data)", obj->m_prototype);
+    }
+    Optional<Object*> prototype = obj->rawInternalPrototypeObject();
+    if (prototype) {
+        addEdge(PropertyEdge, "__proto__", prototype.value());
+    }
+    addEdge(InternalEdge, "(properties)", &obj->m_values[0]);
+
+    ObjectStructure* structure = obj->m_structure;
+    size_t propertyCount = structure->propertyCount();
+    for (size_t i = 0; i < propertyCount; i++) {
+        Value value = obj->m_values[i];
+        if (!value.isPointerValue()) {
+            continue;
+        }
+        size_t to = findNode(value.asPointerValue());
+        if (to == NotFound) {
+            continue;
+        }
+
+        const ObjectStructureItem& item = structure->readProperty(i);
+        uint32_t name;
+        if (item.m_propertyName.isPlainString()) {
+            name = stringIndex(item.m_propertyName.plainString());
+        } else {
+            std::string symbolName = "<symbol ";
+            readStringContent(item.m_propertyName.symbol()->descriptionString(), symbolName);
+            symbolName += ">";
+            name = stringIndex(symbolName);
+        }
+        addEdge(item.m_descriptor.isPlainDataProperty() ? PropertyEdge : InternalEdge, name, to);
+    }
+
+    size_t elements = NotFound;
+    if (obj->isArrayObject() && obj->asArrayObject()->isFastModeArray()) {
+        ArrayObject* array = obj->asArrayObject();
+        elements = findNode(&array->m_fastModeData[0]);
+        if (elements != NotFound) {
+            addEdge(InternalEdge, stringIndex("(elements)"), elements);
+        }
+        for (uint32_t i = 0; i < array->m_arrayLength; i++) {
+            Value value = array->m_fastModeData[i];
+            if (value.isPointerValue()) {
+                size_t to = findNode(value.asPointerValue());
+                if (to != NotFound) {
+                    addEdge(ElementEdge, i, to);
+                }
+            }
+        }
+    }
+
+    // fields of subclasses (environment of closures, internal slots, ...) are scanned conservatively
+    collectConservativeEdges(index, sizeof(Object) / sizeof(size_t), elements);
+}
+
+void HeapSnapshot::collectConservativeEdges(size_t index, size_t fromWord, size_t skip)
+{
+    const Node& node = m_nodes[index];
+    size_t* words = reinterpret_cast<size_t*>(userPointer(node.m_base));
+    size_t wordCount = (reinterpret_cast<char*>(node.m_base) + node.m_size - reinterpret_cast<char*>(words)) / sizeof(size_t);
+    for (size_t i = fromWord; i < wordCount; i++) {
+        size_t to = findNode(reinterpret_cast<void*>(words[i]));
+        if (to != NotFound && to != index && to != skip) {
+            addEdge(HiddenEdge, i, to);
+        }
+    }
+}
+
+void HeapSnapshot::addNamedRoot(const void* ptr, RootGroup group, const char* name)
+{
+    size_t index = findNode(ptr);
+    if (index != NotFound && m_nodes[index].m_type == HiddenNode) {
+        m_nodes[index].m_type = NativeNode;
+        m_nodes[index].m_name = stringIndex(name);
+        m_roots[group].push_back(static_cast<uint32_t>(index));
+    }
+}
+
+void HeapSnapshot::collectRoots()
+{
+    // PersistentRefHolder keeps its value in a pointer-sized uncollectable block
+    for (size_t i = 0; i < m_nodes.size(); i++) {
+        Node& node = m_nodes[i];
+        if (!node.m_isUncollectable) {
+            continue;
+        }
+        if (node.m_hasPointers && node.m_size <= sizeof(void*) * 2) {
+            if (node.m_type == HiddenNode) {
+                node.m_name = stringIndex("(persistent handle)");
+            }
+            m_roots[PersistentHandleRoots].push_back(static_cast<uint32_t>(i));
+        } else {
+            m_roots[UncollectableRoots].push_back(static_cast<uint32_t>(i));
+        }
+    }
+
+    std::vector<bool> visited(m_nodes.size(), false);
+    for (const auto& edge : m_edges) {
+        visited[edge.m_to] = true;
+    }
+    std::vector<bool> referenced;
+    referenced.swap(visited);
+    visited.assign(m_nodes.size(), false);
+
+    std::vector<uint32_t> stack;
+    auto visit = [&](size_t root) {
+        visited[root] = true;
+        stack.push_back(static_cast<uint32_t>(root));
+        while (stack.size()) {
+            size_t index = stack.back();
+            stack.pop_back();
+            size_t end = index + 1 < m_nodes.size() ? m_nodes[index + 1].m_firstEdge : m_edges.size();
+            for (size_t i = m_nodes[index].m_firstEdge; i < end; i++) {
+                size_t to = m_edges[i].m_to;
+                if (!visited[to]) {
+                    visited[to] = true;
+                    stack.push_back(static_cast<uint32_t>(to));
+                }
+            }
+        }
+    };
+
+    for (size_t group = 0; group < OtherRoots; group++) {
+        for (size_t i = 0; i < m_roots[group].size(); i++) {
+            if (!visited[m_roots[group][i]]) {
+                visit(m_roots[group][i]);
+            }
+        }
+    }
+
+    // bdwgc does not tell which of the stack and static data keeps the other blocks alive
+    // so every remaining block not referenced by another block is a root,
+    // and then one block of each cycle which is still unreachable from those roots
+    auto addOtherRoot = [&](size_t root) {
+        m_roots[OtherRoots].push_back(static_cast<uint32_t>(root));
+        visit(root);
+    };
+    for (size_t i = 0; i < m_nodes.size(); i++) {
+        if (!visited[i] && !referenced[i]) {
+            addOtherRoot(i);
+        }
+    }
+    for (size_t i = 0; i < m_nodes.size(); i++) {
+        if (!visited[i]) {
+            addOtherRoot(i);
+        }
+    }
+}
+
+void HeapSnapshot::addEdge(EdgeType type, size_t nameOrIndex, size_t to)
+{
+    Edge edge;
+    edge.m_to = static_cast<uint32_t>(to);
+    edge.m_nameOrIndex = static_cast<uint32_t>(nameOrIndex);
+    edge.m_type = type;
+    m_edges.push_back(edge);
+}
+
+void HeapSnapshot::addEdge(EdgeType type, const char* name, const void* to)
+{
+    size_t index = findNode(to);
+    if (index != NotFound) {
+        addEdge(type, stringIndex(name), index);
+    }
+}
+
+uint32_t HeapSnapshot::stringIndex(const std::string& str)
+{
+    auto iter = m_stringIndices.find(str);
+    if (iter != m_stringIndices.end()) {
+        return iter->second;
+    }
+
+    if (UNLIKELY(m_stringTableSize + str.length() > HEAP_SNAPSHOT_STRING_TABLE_MAX_SIZE)) {
+        // "(string)" is short enough to be added even if the table is full
+        if (str != "(string)") {
+            return stringIndex("(string)");
+        }
+    }
+    m_stringTableSize += str.length();
+
+    uint32_t index = static_cast<uint32_t>(m_strings.size());
+    auto result = m_stringIndices.insert(std::make_pair(str, index));
+    // keys of unordered_map are not moved by rehashing
+    m_strings.push_back(&result.first->first);
+    return index;
+}
+
+uint32_t HeapSnapshot::stringIndex(String* str)
+{
+    std::string content;
+    if (!readStringContent(str, content)) {
+        return stringIndex("(string)");
+    }
+    return stringIndex(content);
+}
+
+void HeapSnapshot::writeSnapshot()
+{
+    const size_t nodeFieldCount = 6;
+    uint32_t rootName = stringIndex("(GC roots)");
+    const char* rootGroupNames[RootGroupCount] = { "(Persistent handles)", "(Uncollectable)", "(VM instances)", "(Contexts)", "(Other roots)" };
+    uint32_t rootGroupNameIndices[RootGroupCount];
+    size_t rootGroupEdgeCount = 0;
+    for (size_t i = 0; i < RootGroupCount; i++) {
+        rootGroupNameIndices[i] = stringIndex(rootGroupNames[i]);
+        rootGroupEdgeCount += m_roots[i].size();
+    }
+
+    writeCString("{\"snapshot\":{\"meta\":{"
+                 "\"node_fields\":[\"type\",\"name\",\"id\",\"self_size\",\"edge_count\",\"trace_node_id\"],"
+                 "\"node_types\":[[\"hidden\",\"array\",\"string\",\"object\",\"code\",\"closure\",\"regexp\",\"number\",\"native\","
+                 "\"synthetic\",\"concatenated string\",\"sliced string\",\"symbol\",\"bigint\",\"object shape\"],"
+                 "\"string\",\"number\",\"number\",\"number\",\"number\"],"
+                 "\"edge_fields\":[\"type\",\"name_or_index\",\"to_node\"],"
+                 "\"edge_types\":[[\"context\",\"element\",\"property\",\"internal\",\"hidden\",\"shortcut\",\"weak\"],"
+                 "\"string_or_number\",\"node\"],"
+                 "\"trace_function_info_fields\":[\"function_id\",\"name\",\"script_name\",\"script_id\",\"line\",\"column\"],"
+                 "\"trace_node_fields\":[\"id\",\"function_info_index\",\"count\",\"size\",\"children\"],"
+                 "\"sample_fields\":[\"timestamp_us\",\"last_assigned_id\"],"
+                 "\"location_fields\":[\"object_index\",\"script_id\",\"line\",\"column\"]},"
+                 "\"node_count\":");
+    writeNumber(m_nodes.size() + 1 + RootGroupCount);
+    writeCString(",\"edge_count\":");
+    writeNumber(RootGroupCount + m_edges.size() + rootGroupEdgeCount);
+    writeCString(",\"trace_function_count\":0},\n\"nodes\":[");
+
+    // the root is the first node, node i of the heap is written at i + 1
+    // and the children of the root are written after the heap
+    auto writeNode = [this](size_t type, size_t name, size_t index, size_t size, size_t edgeCount) {
+        writeNumber(type);
+        writeRaw(",", 1);
+        writeNumber(name);
+        writeRaw(",", 1);
+        writeNumber(index * 2 + 1);
+        writeRaw(",", 1);
+        writeNumber(size);
+        writeRaw(",", 1);
+        writeNumber(edgeCount);
+        writeRaw(",0", 2);
+    };
+    writeNode(SyntheticNode, rootName, 0, 0, RootGroupCount);
+    for (size_t i = 0; i < m_nodes.size(); i++) {
+        size_t end = i + 1 < m_nodes.size() ? m_nodes[i + 1].m_firstEdge : m_edges.size();
+        writeRaw(",\n", 2);
+        writeNode(m_nodes[i].m_type, m_nodes[i].m_name, i + 1, m_nodes[i].m_size, end - m_nodes[i].m_firstEdge);
+    }
+    const size_t firstRootGroupNode = m_nodes.size() + 1;
+    for (size_t i = 0; i < RootGroupCount; i++) {
+        writeRaw(",\n", 2);
+        writeNode(SyntheticNode, rootGroupNameIndices[i], firstRootGroupNode + i, 0, m_roots[i].size());
+    }
+
+    writeCString("],\n\"edges\":[");
+    // to is the position of the node as written
+    auto writeEdge = [this, nodeFieldCount](size_t type, size_t nameOrIndex, size_t to, bool first) {
+        if (!first) {
+            writeRaw(",\n", 2);
+        }
+        writeNumber(type);
+        writeRaw(",", 1);
+        writeNumber(nameOrIndex);
+        writeRaw(",", 1);
+        writeNumber(to * nodeFieldCount);
+    };
+    for (size_t i = 0; i < RootGroupCount; i++) {
+        writeEdge(ElementEdge, i, firstRootGroupNode + i, i == 0);
+    }
+    for (size_t i = 0; i < m_edges.size(); i++) {
+        writeEdge(m_edges[i].m_type, m_edges[i].m_nameOrIndex, m_edges[i].m_to + 1, false);
+    }
+    for (size_t i = 0; i < RootGroupCount; i++) {
+        for (size_t j = 0; j < m_roots[i].size(); j++) {
+            writeEdge(ElementEdge, j, m_roots[i][j] + 1, false);
+        }
+    }
+
+    writeCString("],\n\"trace_function_infos\":[],\"trace_tree\":[],\"samples\":[],\"locations\":[],\n\"strings\":[");
+    for (size_t i = 0; i < m_strings.size(); i++) {
+        if (i) {
+            writeRaw(",\n", 2);
+        }
+        writeJSONString(*m_strings[i]);
+    }
+    writeCString("]}\n");
+    flush();
+}
+
+void HeapSnapshot::writeRaw(const char* data, size_t length)
+{
+    while (length) {
+        if (m_bufferUsed == sizeof(m_buffer)) {
+            flush();
+        }
+        size_t copyLength = std::min(length, sizeof(m_buffer) - m_bufferUsed);
+        memcpy(m_buffer + m_bufferUsed, data, copyLength);
+        m_bufferUsed += copyLength;
+        data += copyLength;
+        length -= copyLength;
+    }
+}
+
+void HeapSnapshot::writeNumber(size_t number)
+{
+    char buf[32];
+    int length = snprintf(buf, sizeof(buf), "%zu", number);
+    writeRaw(buf, length);
+}
+
+void HeapSnapshot::writeJSONString(const std::string& str)
+{
+    writeRaw("\"", 1);
+    size_t start = 0;
+    for (size_t i = 0; i < str.length(); i++) {
+        unsigned char c = str[i];
+        if (c >= 0x20 && c != '"' && c != '\\') {
+            continue;
+        }
+        writeRaw(str.data() + start, i - start);
+        start = i + 1;
+
+        char buf[8];
+        if (c == '"' || c == '\\') {
+            buf[0] = '\\';
+            buf[1] = c;
+            writeRaw(buf, 2);
+        } else {
+            int length = snprintf(buf, sizeof(buf), "\\u%04x", c);
+            writeRaw(buf, length);
+        }
+    }
+    writeRaw(str.data() + start, str.length() - start);
+    writeRaw("\"", 1);
+}
+
+void HeapSnapshot::flush()
+{
+    const char* data = m_buffer;
+    size_t remain = m_bufferUsed;
+    m_bufferUsed = 0;
+
+    while (remain && !m_failed) {
+#if defined(_WINDOWS)
+        int written = _write(m_fd, data, static_cast<unsigned>(remain));
+#else
+        ssize_t written = ::write(m_fd, data, remain);
+        if (written < 0 && errno == EINTR) {
+            continue;
+        }
+#endif
+        if (written <= 0) {
+            m_failed = true;
+            break;
+        }
+        data += written;
+        remain -= written;
+    }
+}
+
+} // namespace Escargot
@@ -0,0 +1,146 @@
+/*
+ * Copyright (c) 2024-present Samsung Electronics Co., Ltd
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+ *  USA
+ */
+
+#ifndef __EscargotHeapSnapshot__
+#define __EscargotHeapSnapshot__
+
+namespace Escargot {
+
+class Object;
+class String;
+class Value;
+
+// writes the GC heap of the current thread in Chrome DevTools .heapsnapshot format
+// every block marked by a full GC becomes a node. edges come from a conservative scan of each block,
+// except for blocks recognized as JS objects whose structure, prototype, properties and elements are read as typed edges.
+// the root node has named synthetic children for persistent handles, other uncollectable blocks, VMInstances and Contexts.
+// blocks which are not reachable from them and not referenced by other blocks (stack, static data) are children of "(Other roots)".
+// the graph is kept as compact arrays and the JSON text is written to fd through a fixed-size buffer.
+// distinct names are bounded by HEAP_SNAPSHOT_STRING_TABLE_MAX_SIZE bytes
+class HeapSnapshot {
+public:
+    // returns false if writing to fd failed
+    static bool write(int fd);
+
+private:
+    enum NodeType : uint8_t {
+        HiddenNode,
+        ArrayNode,
+        StringNode,
+        ObjectNode,
+        CodeNode,
+        ClosureNode,
+        RegExpNode,
+        NumberNode,
+        NativeNode,
+        SyntheticNode,
+        ConcatenatedStringNode,
+        SlicedStringNode,
+        SymbolNode,
+        BigIntNode,
+        ObjectShapeNode,
+    };
+
+    enum EdgeType : uint8_t {
+        ContextEdge,
+        ElementEdge,
+        PropertyEdge,
+        InternalEdge,
+        HiddenEdge,
+        ShortcutEdge,
+        WeakEdge,
+    };
+
+    struct Node {
+        void* m_base;
+        uint32_t m_size;
+        uint32_t m_firstEdge;
+        uint32_t m_name;
+        NodeType m_type;
+        bool m_hasPointers;
+        bool m_isUncollectable;
+    };
+
+    // synthetic children of the root node
+    enum RootGroup : uint8_t {
+        PersistentHandleRoots,
+        UncollectableRoots,
+        VMInstanceRoots,
+        ContextRoots,
+        OtherRoots,
+        RootGroupCount,
+    };
+
+    struct Edge {
+        uint32_t m_to;
+        uint32_t m_nameOrIndex;
+        EdgeType m_type;
+    };
+
+    static const size_t NotFound = SIZE_MAX;
+
+    explicit HeapSnapshot(int fd);
+
+    void collectNodes();
+    void classifyNodes();
+    bool learnTags(Object* obj);
+    void learnTag(const Value& value, bool& learned);
+    void nameNodes();
+    void collectEdges();
+    void collectObjectEdges(size_t index, Object* obj);
+    void collectConservativeEdges(size_t index, size_t fromWord, size_t skip);
+    void addNamedRoot(const void* ptr, RootGroup group, const char* name);
+    void collectRoots();
+    void writeSnapshot();
+
+    size_t findNode(const void* ptr);
+    void addEdge(EdgeType type, size_t nameOrIndex, size_t to);
+    void addEdge(EdgeType type, const char* name, const void* to);
+    uint32_t stringIndex(const std::string& str);
+    uint32_t stringIndex(String* str);
+
+    void writeRaw(const char* data, size_t length);
+    void writeCString(const char* str)
+    {
+        writeRaw(str, strlen(str));
+    }
+    void writeNumber(size_t number);
+    void writeJSONString(const std::string& str);
+    void flush();
+
+    int m_fd;
+    bool m_failed;
+    std::vector<Node> m_nodes;
+    std::vector<Edge> m_edges;
+    std::vector<uint32_t> m_roots[RootGroupCount];
+    // vtable addresses of object, string, symbol and bigint classes seen in the heap
+    std::unordered_set<size_t> m_objectTags;
+    std::unordered_set<size_t> m_stringTags;
+    std::unordered_set<size_t> m_symbolTags;
+    std::unordered_set<size_t> m_bigIntTags;
+    std::unordered_map<std::string, uint32_t> m_stringIndices;
+    std::vector<const std::string*> m_strings;
+    size_t m_stringTableSize;
+    size_t m_bufferUsed;
+    char m_buffer[64 * 1024];
+};
+
+} // namespace Escargot
+
+#endif
@@ -103,6 +103,9 @@ ByteCodeBlock::ByteCodeBlock()
     , m_requiredOperandRegisterNumber(2)
     , m_requiredTotalRegisterNumber(0)
     , m_inlineCacheDataSize(0)
+    , m_calledSinceLastGC(false)
+    , m_usageHistory(0)
+    , m_lastUsedEpoch(0)
     , m_codeBlock(nullptr)
 {
     // This constructor is used to allocate a ByteCodeBlock on the stack
@@ -135,6 +138,9 @@ ByteCodeBlock::ByteCodeBlock(InterpretedCodeBlock* codeBlock)
     , m_requiredOperandRegisterNumber(2)
     , m_requiredTotalRegisterNumber(0)
     , m_inlineCacheDataSize(0)
+    , m_calledSinceLastGC(false)
+    , m_usageHistory(0)
+    , m_lastUsedEpoch(0)
     , m_codeBlock(codeBlock)
 {
     auto& v = m_codeBlock->context()->vmInstance()->compiledByteCodeBlocks();
@@ -347,6 +353,23 @@ void ByteCodeBlock::pushPauseStatementExtraData(ByteCodeGenerateContext* context
     }
 }
 
+void* KeyedInlineCacheData::operator new(size_t size)
+{
+    static MAY_THREAD_LOCAL bool typeInited = false;
+    static MAY_THREAD_LOCAL GC_descr descr;
+    if (!typeInited) {
+        GC_word obj_bitmap[GC_BITMAP_SIZE(KeyedInlineCacheData)] = { 0 };
+        for (size_t i = 0; i < inlineBufferSize; i++) {
+            GC_set_bit(obj_bitmap, GC_WORD_OFFSET(KeyedInlineCacheData, m_cachedStructures) + i);
+            GC_set_bit(obj_bitmap, GC_WORD_OFFSET(KeyedInlineCacheData, m_cachedKeys) + i);
+        }
+        descr = GC_make_descriptor(obj_bitmap, GC_WORD_LEN(KeyedInlineCacheData));
+        typeInited = true;
+    }
+
+    return GC_MALLOC_EXPLICITLY_TYPED(size, descr);
+}
+
 void* GetObjectInlineCacheSimpleCaseData::operator new(size_t size)
 {
     static MAY_THREAD_LOCAL bool typeInited = false;
@@ -32,6 +32,7 @@ namespace Escargot {
 class Node;
 class ObjectStructure;
 struct GlobalVariableAccessCacheItem;
+enum class TypedArrayType : unsigned;
 
 // <OpcodeName, PushCount, PopCount>
 #define FOR_EACH_BYTECODE_OP(F)                       \
@@ -156,9 +157,47 @@ struct GlobalVariableAccessCacheItem;
 #define FOR_EACH_BYTECODE_DEBUGGER_OP(F)
 #endif /* ESCARGOT_DEBUGGER */
 
-#define FOR_EACH_BYTECODE(F)         \
-    FOR_EACH_BYTECODE_TCO_OP(F)      \
-    FOR_EACH_BYTECODE_DEBUGGER_OP(F) \
+// superinstructions are never emitted by ast nodes
+// ByteCodeGenerator::relocateByteCode fuses them from an adjacent pair of bytecodes
+#if defined(ENABLE_SUPER_INSTRUCTION)
+#define FOR_EACH_BYTECODE_SUPER_INSTRUCTION_OP(F) \
+    F(BinaryLessThanJumpIfFalse)                  \
+    F(BinaryLessThanOrEqualJumpIfFalse)           \
+    F(BinaryGreaterThanJumpIfFalse)               \
+    F(BinaryGreaterThanOrEqualJumpIfFalse)        \
+    F(BinaryStrictEqualJumpIfFalse)               \
+    F(IncrementJump)                              \
+    F(DecrementJump)                              \
+    F(LoadLiteralSetObjectPreComputedCase)
+#else
+#define FOR_EACH_BYTECODE_SUPER_INSTRUCTION_OP(F)
+#endif
+
+// type specialized bytecodes are never emitted by ast nodes either
+// a generic bytecode rewrites itself into one of them at runtime (see ByteCodeQuickening)
+#if !defined(ESCARGOT_SMALL_CONFIG)
+#define FOR_EACH_BYTECODE_QUICKENED_OP(F) \
+    F(BinaryPlusInt32)                    \
+    F(BinaryPlusDouble)                   \
+    F(BinaryMinusInt32)                   \
+    F(BinaryMinusDouble)                  \
+    F(BinaryMultiplyInt32)                \
+    F(BinaryMultiplyDouble)               \
+    F(BinaryLessThanInt32)                \
+    F(BinaryLessThanOrEqualInt32)         \
+    F(BinaryGreaterThanInt32)             \
+    F(BinaryGreaterThanOrEqualInt32)      \
+    F(IncrementInt32)                     \
+    F(DecrementInt32)
+#else
+#define FOR_EACH_BYTECODE_QUICKENED_OP(F)
+#endif
+
+#define FOR_EACH_BYTECODE(F)                  \
+    FOR_EACH_BYTECODE_TCO_OP(F)               \
+    FOR_EACH_BYTECODE_DEBUGGER_OP(F)          \
+    FOR_EACH_BYTECODE_SUPER_INSTRUCTION_OP(F) \
+    FOR_EACH_BYTECODE_QUICKENED_OP(F)         \
     FOR_EACH_BYTECODE_OP(F)
 
 enum Opcode {
@@ -879,6 +918,22 @@ public:
     }
 #endif
 
+// Profile of operand types used for quickening
+// m_extraData of BinaryPlus, BinaryMinus, BinaryMultiply and relational bytecodes and
+// m_quickeningProfile of Increment and Decrement count executions with the kind of operands seen.
+// When the count reaches Threshold and only one kind has been seen, the bytecode rewrites itself
+// into the specialized variant by changeOpcode. The variant falls back to the generic bytecode
+// and disables quickening of the site as soon as its guard fails.
+struct ByteCodeQuickening {
+    enum : uint16_t {
+        Threshold = 32,
+        CountMask = 0x1fff,
+        SeenInt32 = 0x2000, // every operand was int32
+        SeenDouble = 0x4000, // operands were numbers but not all of them were int32
+        Disabled = 0x8000,
+    };
+};
+
 #define DEFINE_BINARY_OPERATION(CodeName, HumanName)                                                                                      \
     class Binary##CodeName : public ByteCode {                                                                                            \
     public:                                                                                                                               \
@@ -1111,6 +1166,37 @@ public:
 #endif
 };
 
+// inline cache for computed member access (GetObject, SetObjectOperation)
+// caches (structure, key, slot) of recurring string or symbol keys on ordinary objects
+// keys are compared by the pointer of atomic string or symbol
+// and the kind of TypedArray used for element access
+struct KeyedInlineCacheData : public gc {
+    KeyedInlineCacheData()
+        : m_typedArrayTag(0)
+        , m_typedArrayType()
+        , m_cacheMissCount(0)
+    {
+        memset(m_cachedStructures, 0, sizeof(ObjectStructure*) * inlineBufferSize);
+        memset(m_cachedKeys, 0, sizeof(PointerValue*) * inlineBufferSize);
+        memset(m_cachedIndexes, 0, sizeof(uint16_t) * inlineBufferSize);
+    }
+
+    void* operator new(size_t size);
+    void* operator new[](size_t size) = delete;
+
+    static constexpr size_t inlineBufferSize = 4;
+    static constexpr size_t CachedIndexMax = std::numeric_limits<uint16_t>::max();
+    static constexpr size_t MaxCacheMissCount = 32;
+
+    ObjectStructure* m_cachedStructures[inlineBufferSize];
+    PointerValue* m_cachedKeys[inlineBufferSize];
+    uint16_t m_cachedIndexes[inlineBufferSize];
+    // vtable address of the TypedArray class accessed last (zero if none)
+    size_t m_typedArrayTag;
+    TypedArrayType m_typedArrayType;
+    size_t m_cacheMissCount;
+};
+
 class GetObject : public ByteCode {
 public:
     GetObject(const ByteCodeLOC& loc, const size_t objectRegisterIndex, const size_t propertyRegisterIndex, const size_t storeRegisterIndex)
@@ -1118,12 +1204,14 @@ public:
         , m_objectRegisterIndex(objectRegisterIndex)
         , m_propertyRegisterIndex(propertyRegisterIndex)
         , m_storeRegisterIndex(storeRegisterIndex)
+        , m_inlineCache(nullptr)
     {
     }
 
     ByteCodeRegisterIndex m_objectRegisterIndex;
     ByteCodeRegisterIndex m_propertyRegisterIndex;
     ByteCodeRegisterIndex m_storeRegisterIndex;
+    KeyedInlineCacheData* m_inlineCache;
 
 #ifndef NDEBUG
     void dump()
@@ -1140,12 +1228,14 @@ public:
         , m_objectRegisterIndex(objectRegisterIndex)
         , m_propertyRegisterIndex(propertyRegisterIndex)
         , m_loadRegisterIndex(loadRegisterIndex)
+        , m_inlineCache(nullptr)
     {
     }
 
     ByteCodeRegisterIndex m_objectRegisterIndex;
     ByteCodeRegisterIndex m_propertyRegisterIndex;
     ByteCodeRegisterIndex m_loadRegisterIndex;
+    KeyedInlineCacheData* m_inlineCache;
 
 #ifndef NDEBUG
     void dump()
@@ -1356,7 +1446,9 @@ public:
     enum GetInlineCacheMode ENSURE_ENUM_UNSIGNED {
         None,
         Simple,
-        Complex
+        Complex,
+        // shares VM-wide GetObjectMegamorphicCache instead of per-site cache
+        Megamorphic
     };
 
     GetInlineCacheMode m_inlineCacheMode : 2;
@@ -1552,11 +1644,13 @@ public:
         : ByteCode(Opcode::IncrementOpcode, loc)
         , m_srcIndex(srcIndex)
         , m_dstIndex(dstIndex)
+        , m_quickeningProfile(0)
     {
     }
 
     ByteCodeRegisterIndex m_srcIndex;
     ByteCodeRegisterIndex m_dstIndex;
+    uint16_t m_quickeningProfile;
 
 #ifndef NDEBUG
     void dump()
@@ -1594,11 +1688,13 @@ public:
         : ByteCode(Opcode::DecrementOpcode, loc)
         , m_srcIndex(srcIndex)
         , m_dstIndex(dstIndex)
+        , m_quickeningProfile(0)
     {
     }
 
     ByteCodeRegisterIndex m_srcIndex;
     ByteCodeRegisterIndex m_dstIndex;
+    uint16_t m_quickeningProfile;
 
 #ifndef NDEBUG
     void dump()
@@ -2058,6 +2154,46 @@ public:
 #endif
 };
 
+// bytecode which shares the layout of an existing one and only differs in opcode
+#define DEFINE_BYTECODE_WITH_SAME_LAYOUT(CodeName, BaseCodeName) \
+    class CodeName : public BaseCodeName {                       \
+    public:                                                      \
+    };                                                           \
+    COMPILE_ASSERT(sizeof(CodeName) == sizeof(BaseCodeName), "");
+
+#if defined(ENABLE_SUPER_INSTRUCTION)
+// A superinstruction keeps the layout of its first bytecode and the second one stays in place right after it
+// so that jumps into the second one and every walker of bytecode stream work as before
+// compare then jump if the result is false (e.g. left operand of logical and)
+DEFINE_BYTECODE_WITH_SAME_LAYOUT(BinaryLessThanJumpIfFalse, BinaryLessThan)
+DEFINE_BYTECODE_WITH_SAME_LAYOUT(BinaryLessThanOrEqualJumpIfFalse, BinaryLessThanOrEqual)
+DEFINE_BYTECODE_WITH_SAME_LAYOUT(BinaryGreaterThanJumpIfFalse, BinaryGreaterThan)
+DEFINE_BYTECODE_WITH_SAME_LAYOUT(BinaryGreaterThanOrEqualJumpIfFalse, BinaryGreaterThanOrEqual)
+DEFINE_BYTECODE_WITH_SAME_LAYOUT(BinaryStrictEqualJumpIfFalse, BinaryStrictEqual)
+// update of a loop counter followed by back edge of the loop
+DEFINE_BYTECODE_WITH_SAME_LAYOUT(IncrementJump, Increment)
+DEFINE_BYTECODE_WITH_SAME_LAYOUT(DecrementJump, Decrement)
+// store of a non-numeral literal into a property (e.g. this.x = null)
+DEFINE_BYTECODE_WITH_SAME_LAYOUT(LoadLiteralSetObjectPreComputedCase, LoadLiteral)
+#endif
+
+#if !defined(ESCARGOT_SMALL_CONFIG)
+DEFINE_BYTECODE_WITH_SAME_LAYOUT(BinaryPlusInt32, BinaryPlus)
+DEFINE_BYTECODE_WITH_SAME_LAYOUT(BinaryPlusDouble, BinaryPlus)
+DEFINE_BYTECODE_WITH_SAME_LAYOUT(BinaryMinusInt32, BinaryMinus)
+DEFINE_BYTECODE_WITH_SAME_LAYOUT(BinaryMinusDouble, BinaryMinus)
+DEFINE_BYTECODE_WITH_SAME_LAYOUT(BinaryMultiplyInt32, BinaryMultiply)
+DEFINE_BYTECODE_WITH_SAME_LAYOUT(BinaryMultiplyDouble, BinaryMultiply)
+DEFINE_BYTECODE_WITH_SAME_LAYOUT(BinaryLessThanInt32, BinaryLessThan)
+DEFINE_BYTECODE_WITH_SAME_LAYOUT(BinaryLessThanOrEqualInt32, BinaryLessThanOrEqual)
+DEFINE_BYTECODE_WITH_SAME_LAYOUT(BinaryGreaterThanInt32, BinaryGreaterThan)
+DEFINE_BYTECODE_WITH_SAME_LAYOUT(BinaryGreaterThanOrEqualInt32, BinaryGreaterThanOrEqual)
+DEFINE_BYTECODE_WITH_SAME_LAYOUT(IncrementInt32, Increment)
+DEFINE_BYTECODE_WITH_SAME_LAYOUT(DecrementInt32, Decrement)
+#endif
+
+#undef DEFINE_BYTECODE_WITH_SAME_LAYOUT
+
 class Call : public ByteCode {
 public:
     Call(const ByteCodeLOC& loc, const size_t calleeIndex, const size_t argumentsStartIndex, const size_t resultIndex, const size_t argumentCount)
@@ -3311,6 +3447,14 @@ public:
     ByteCodeRegisterIndex m_requiredTotalRegisterNumber : REGISTER_INDEX_IN_BIT;
     size_t m_inlineCacheDataSize;
 
+    // hotness used for choosing ByteCodeBlocks to evict
+    // m_calledSinceLastGC is only written on the first call after a GC
+    // VMInstance folds it into others on GC while eviction is pending
+    bool m_calledSinceLastGC;
+    // one bit per GC, the most significant bit is the latest GC
+    uint32_t m_usageHistory;
+    uint32_t m_lastUsedEpoch;
+
     ByteCodeBlockData m_code;
     ByteCodeNumeralLiteralData m_numeralLiteralData;
     ByteCodeJumpFlowRecordData m_jumpFlowRecordData;
@@ -372,6 +372,56 @@ void ByteCodeGenerator::collectByteCodeLOCData(Context* context, InterpretedCode
     GC_enable();
 }
 
+#if defined(ENABLE_SUPER_INSTRUCTION)
+static Opcode superInstructionOpcode(Opcode first, Opcode second)
+{
+    switch (first) {
+    case BinaryLessThanOpcode:
+        return second == JumpIfFalseOpcode ? BinaryLessThanJumpIfFalseOpcode : EndOpcode;
+    case BinaryLessThanOrEqualOpcode:
+        return second == JumpIfFalseOpcode ? BinaryLessThanOrEqualJumpIfFalseOpcode : EndOpcode;
+    case BinaryGreaterThanOpcode:
+        return second == JumpIfFalseOpcode ? BinaryGreaterThanJumpIfFalseOpcode : EndOpcode;
+    case BinaryGreaterThanOrEqualOpcode:
+        return second == JumpIfFalseOpcode ? BinaryGreaterThanOrEqualJumpIfFalseOpcode : EndOpcode;
+    case BinaryStrictEqualOpcode:
+        return second == JumpIfFalseOpcode ? BinaryStrictEqualJumpIfFalseOpcode : EndOpcode;
+    case IncrementOpcode:
+        return second == JumpOpcode ? IncrementJumpOpcode : EndOpcode;
+    case DecrementOpcode:
+        return second == JumpOpcode ? DecrementJumpOpcode : EndOpcode;
+    case LoadLiteralOpcode:
+        return second == SetObjectPreComputedCaseOpcode ? LoadLiteralSetObjectPreComputedCaseOpcode : EndOpcode;
+    default:
+        return EndOpcode;
+    }
+}
+
+// peephole pass over a pair of adjacent bytecodes
+// only the opcode of the first one is changed, so code size and every jump position are kept
+static void fuseSuperInstruction(ByteCode* first, Opcode firstOpcode, ByteCode* second, Opcode secondOpcode)
+{
+    Opcode fused = superInstructionOpcode(firstOpcode, secondOpcode);
+    if (fused == EndOpcode) {
+        return;
+    }
+
+    if (secondOpcode == JumpIfFalseOpcode) {
+        // fused compare jumps by its own result instead of reading the register again
+        // every compare bytecode shares the layout of BinaryLessThan
+        if (static_cast<JumpIfFalse*>(second)->m_registerIndex != static_cast<BinaryLessThan*>(first)->m_dstIndex) {
+            return;
+        }
+    } else if (secondOpcode == SetObjectPreComputedCaseOpcode) {
+        if (static_cast<SetObjectPreComputedCase*>(second)->m_loadRegisterIndex != static_cast<LoadLiteral*>(first)->m_registerIndex) {
+            return;
+        }
+    }
+
+    first->changeOpcode(fused);
+}
+#endif
+
 void ByteCodeGenerator::relocateByteCode(ByteCodeBlock* block)
 {
     InterpretedCodeBlock* codeBlock = block->codeBlock();
@@ -383,6 +433,10 @@ void ByteCodeGenerator::relocateByteCode(ByteCodeBlock* block)
     uint8_t* code = block->m_code.data();
     size_t codeBase = (size_t)code;
     uint8_t* end = code + block->m_code.size();
+#if defined(ENABLE_SUPER_INSTRUCTION)
+    ByteCode* previousCode = nullptr;
+    Opcode previousOpcode = EndOpcode;
+#endif
 
     while (code < end) {
         ByteCode* currentCode = (ByteCode*)code;
@@ -894,6 +948,15 @@ void ByteCodeGenerator::relocateByteCode(ByteCodeBlock* block)
 #else
         ASSERT(opcode <= EndOpcode);
 #endif
+
+#if defined(ENABLE_SUPER_INSTRUCTION)
+        // both bytecodes are relocated already
+        if (previousCode) {
+            fuseSuperInstruction(previousCode, previousOpcode, currentCode, opcode);
+        }
+        previousCode = currentCode;
+        previousOpcode = opcode;
+#endif
         code += byteCodeLengths[opcode];
     }
 }
@@ -20,6 +20,8 @@
 #include "Escargot.h"
 #include "ByteCode.h"
 #include "ByteCodeInterpreter.h"
+#include "GetObjectMegamorphicCache.h"
+#include "OpcodeStats.h"
 #include "runtime/Global.h"
 #include "runtime/Platform.h"
 #include "runtime/Environment.h"
@@ -34,7 +36,10 @@
 #include "runtime/EnumerateObject.h"
 #include "runtime/ErrorObject.h"
 #include "runtime/ArrayObject.h"
+#include "runtime/TypedArrayObject.h"
+#include "runtime/TypedArrayInlines.h"
 #include "runtime/VMInstance.h"
+#include "runtime/SamplingProfiler.h"
 #include "runtime/IteratorObject.h"
 #include "runtime/GeneratorObject.h"
 #include "runtime/ModuleNamespaceObject.h"
@@ -74,6 +79,16 @@ namespace Escargot {
 
 #define ADD_PROGRAM_COUNTER(CodeType) programCounter += sizeof(CodeType);
 
+#if defined(ENABLE_SAMPLING_PROFILER)
+// function entries and jumps are safepoints of SamplingProfiler
+#define PROFILER_SAFEPOINT()                        \
+    if (SamplingProfiler::countDownSafepoint()) {   \
+        SamplingProfiler::safepointReached(*state); \
+    }
+#else
+#define PROFILER_SAFEPOINT()
+#endif
+
 ALWAYS_INLINE size_t jumpTo(uint8_t* codeBuffer, const size_t jumpPosition)
 {
     return (size_t)&codeBuffer[jumpPosition];
@@ -111,7 +126,8 @@ OpcodeTable::OpcodeTable()
 #else
     size_t dummyCode = reinterpret_cast<size_t>(FillOpcodeTableAddress[0]);
 #endif
-    Interpreter::interpret(&state, nullptr, reinterpret_cast<size_t>(&dummyCode), nullptr);
+    ByteCodeBlock dummyBlock;
+    Interpreter::interpret(&state, &dummyBlock, reinterpret_cast<size_t>(&dummyCode), nullptr);
 #endif
 }
 
@@ -144,6 +160,7 @@ public:
     static bool abstractLeftIsLessThanEqualRight(ExecutionState& state, const Value& left, const Value& right, bool switched);
 
     static void getObjectPrecomputedCaseOperation(ExecutionState& state, GetObjectPreComputedCase* code, Value* registerFile, ByteCodeBlock* block);
+    static Value getObjectPrecomputedCaseMegamorphicOperation(ExecutionState& state, Object* obj, const Value& receiver, const ObjectStructurePropertyName& propertyName);
     static void setObjectPreComputedCaseOperation(ExecutionState& state, const Value& willBeObject, const Value& value, SetObjectPreComputedCase* code, ByteCodeBlock* block);
 
     static Object* fastToObject(ExecutionState& state, const Value& obj);
@@ -188,9 +205,16 @@ public:
     static void defineObjectGetterSetter(ExecutionState& state, ObjectDefineGetterSetter* code, ByteCodeBlock* byteCodeBlock, Value* registerFile);
     static Value incrementOperation(ExecutionState& state, const Value& value);
     static Value decrementOperation(ExecutionState& state, const Value& value);
+#if !defined(ESCARGOT_SMALL_CONFIG)
+    static void profileOperandType(ByteCode* code, uint16_t& profile, bool isInt32, Opcode int32Opcode, Opcode doubleOpcode);
+    static void quickenByteCode(ByteCode* code, uint16_t& profile, Opcode int32Opcode, Opcode doubleOpcode);
+#endif
 
-    static void getObjectOpcodeSlowCase(ExecutionState& state, GetObject* code, Value* registerFile);
-    static void setObjectOpcodeSlowCase(ExecutionState& state, SetObjectOperation* code, Value* registerFile);
+    static void getObjectOpcodeSlowCase(ExecutionState& state, GetObject* code, Value* registerFile, ByteCodeBlock* block);
+    static void setObjectOpcodeSlowCase(ExecutionState& state, SetObjectOperation* code, Value* registerFile, ByteCodeBlock* block);
+    static bool getObjectByKeyedInlineCache(ExecutionState& state, KeyedInlineCacheData* inlineCache, Object* obj, const Value& property, Value& result);
+    static bool setObjectByKeyedInlineCache(ExecutionState& state, KeyedInlineCacheData* inlineCache, Object* obj, const Value& property, const Value& value);
+    static void updateKeyedInlineCache(ExecutionState& state, KeyedInlineCacheData*& inlineCache, Object* obj, const Value& property, bool isStore, ByteCodeBlock* block);
 
     static void unaryTypeof(ExecutionState& state, UnaryTypeof* code, Value* registerFile);
 
@@ -228,6 +252,10 @@ private:
 Value Interpreter::interpret(ExecutionState* state, ByteCodeBlock* byteCodeBlock, size_t programCounter, Value* registerFile)
 {
     state->m_programCounter = &programCounter;
+    if (UNLIKELY(!byteCodeBlock->m_calledSinceLastGC)) {
+        byteCodeBlock->m_calledSinceLastGC = true;
+    }
+    PROFILER_SAFEPOINT();
     {
 #if defined(ESCARGOT_COMPUTED_GOTO_INTERPRETER)
 #if defined(ESCARGOT_COMPUTED_GOTO_INTERPRETER_INIT_WITH_NULL)
@@ -260,6 +288,7 @@ Value Interpreter::interpret(ExecutionState* state, ByteCodeBlock* byteCodeBlock
 
     NextInstruction:
         Opcode currentOpcode = ((ByteCode*)programCounter)->m_opcode;
+        OPCODE_STATS_COUNT_OPCODE(currentOpcode);
 
     NextInstructionWithoutFetchOpcode:
         switch (currentOpcode) {
@@ -302,9 +331,11 @@ Value Interpreter::interpret(ExecutionState* state, ByteCodeBlock* byteCodeBlock
                     ASSERT(slot->m_cachedAddress < (globalObject->m_values.data() + globalObject->structure()->propertyCount()));
                     registerFile[code->m_registerIndex] = *((ObjectPropertyValue*)slot->m_cachedAddress);
                     isCacheWork = true;
+                    OPCODE_STATS_COUNT_INLINE_CACHE_HIT(GetGlobalVariable);
                 } else if (slot->m_cachedStructure == nullptr) {
                     const EncodedValueVectorElement& val = ctx->globalDeclarativeStorage()->at(idx);
                     isCacheWork = true;
+                    OPCODE_STATS_COUNT_INLINE_CACHE_HIT(GetGlobalVariable);
                     if (UNLIKELY(val.isEmpty())) {
                         ErrorObject::throwBuiltinError(*state, ErrorCode::ReferenceError, ctx->globalDeclarativeRecord()->at(idx).m_name.string(), false, String::emptyString, ErrorObject::Messages::IsNotInitialized);
                     }
@@ -312,6 +343,7 @@ Value Interpreter::interpret(ExecutionState* state, ByteCodeBlock* byteCodeBlock
                 }
             }
             if (UNLIKELY(!isCacheWork)) {
+                OPCODE_STATS_COUNT_INLINE_CACHE_MISS(GetGlobalVariable);
                 registerFile[code->m_registerIndex] = InterpreterSlowPath::getGlobalVariableSlowCase(*state, globalObject, slot, byteCodeBlock);
             }
             ADD_PROGRAM_COUNTER(GetGlobalVariable);
@@ -374,10 +406,19 @@ Value Interpreter::interpret(ExecutionState* state, ByteCodeBlock* byteCodeBlock
                 } else {
                     ret = Value(Value::EncodeAsDouble, (double)a + (double)b);
                 }
+#if !defined(ESCARGOT_SMALL_CONFIG)
+                InterpreterSlowPath::profileOperandType(code, code->m_extraData, true, BinaryPlusInt32Opcode, BinaryPlusDoubleOpcode);
+#endif
             } else if (v0.isNumber() && v1.isNumber()) {
                 // most cases are double
                 ret = Value(Value::EncodeAsDouble, v0.asNumber() + v1.asNumber());
+#if !defined(ESCARGOT_SMALL_CONFIG)
+                InterpreterSlowPath::profileOperandType(code, code->m_extraData, false, BinaryPlusInt32Opcode, BinaryPlusDoubleOpcode);
+#endif
             } else {
+#if !defined(ESCARGOT_SMALL_CONFIG)
+                code->m_extraData = ByteCodeQuickening::Disabled;
+#endif
                 ret = InterpreterSlowPath::plusSlowCase(*state, v0, v1);
             }
             ADD_PROGRAM_COUNTER(BinaryPlus);
@@ -401,10 +442,19 @@ Value Interpreter::interpret(ExecutionState* state, ByteCodeBlock* byteCodeBlock
                 } else {
                     ret = Value(Value::EncodeAsDouble, (double)a - (double)b);
                 }
+#if !defined(ESCARGOT_SMALL_CONFIG)
+                InterpreterSlowPath::profileOperandType(code, code->m_extraData, true, BinaryMinusInt32Opcode, BinaryMinusDoubleOpcode);
+#endif
             } else if (LIKELY(left.isNumber() && right.isNumber())) {
                 // most cases are double
                 ret = Value(Value::EncodeAsDouble, left.asNumber() - right.asNumber());
+#if !defined(ESCARGOT_SMALL_CONFIG)
+                InterpreterSlowPath::profileOperandType(code, code->m_extraData, false, BinaryMinusInt32Opcode, BinaryMinusDoubleOpcode);
+#endif
             } else {
+#if !defined(ESCARGOT_SMALL_CONFIG)
+                code->m_extraData = ByteCodeQuickening::Disabled;
+#endif
                 ret = InterpreterSlowPath::minusSlowCase(*state, left, right);
             }
             ADD_PROGRAM_COUNTER(BinaryMinus);
@@ -432,10 +482,19 @@ Value Interpreter::interpret(ExecutionState* state, ByteCodeBlock* byteCodeBlock
                         ret = Value(Value::EncodeAsDouble, a * (double)b);
                     }
                 }
+#if !defined(ESCARGOT_SMALL_CONFIG)
+                InterpreterSlowPath::profileOperandType(code, code->m_extraData, true, BinaryMultiplyInt32Opcode, BinaryMultiplyDoubleOpcode);
+#endif
             } else if (LIKELY(left.isNumber() && right.isNumber())) {
                 // most cases are double
                 ret = Value(Value::EncodeAsDouble, left.asNumber() * right.asNumber());
+#if !defined(ESCARGOT_SMALL_CONFIG)
+                InterpreterSlowPath::profileOperandType(code, code->m_extraData, false, BinaryMultiplyInt32Opcode, BinaryMultiplyDoubleOpcode);
+#endif
             } else {
+#if !defined(ESCARGOT_SMALL_CONFIG)
+                code->m_extraData = ByteCodeQuickening::Disabled;
+#endif
                 ret = InterpreterSlowPath::multiplySlowCase(*state, left, right);
             }
             ADD_PROGRAM_COUNTER(BinaryMultiply);
@@ -487,6 +546,9 @@ Value Interpreter::interpret(ExecutionState* state, ByteCodeBlock* byteCodeBlock
             BinaryLessThan* code = (BinaryLessThan*)programCounter;
             const Value& left = registerFile[code->m_srcIndex0];
             const Value& right = registerFile[code->m_srcIndex1];
+#if !defined(ESCARGOT_SMALL_CONFIG)
+            InterpreterSlowPath::profileOperandType(code, code->m_extraData, left.isInt32() && right.isInt32(), BinaryLessThanInt32Opcode, EndOpcode);
+#endif
             registerFile[code->m_dstIndex] = Value(InterpreterSlowPath::abstractLeftIsLessThanRight(*state, left, right, false));
             ADD_PROGRAM_COUNTER(BinaryLessThan);
             NEXT_INSTRUCTION();
@@ -498,6 +560,9 @@ Value Interpreter::interpret(ExecutionState* state, ByteCodeBlock* byteCodeBlock
             BinaryLessThanOrEqual* code = (BinaryLessThanOrEqual*)programCounter;
             const Value& left = registerFile[code->m_srcIndex0];
             const Value& right = registerFile[code->m_srcIndex1];
+#if !defined(ESCARGOT_SMALL_CONFIG)
+            InterpreterSlowPath::profileOperandType(code, code->m_extraData, left.isInt32() && right.isInt32(), BinaryLessThanOrEqualInt32Opcode, EndOpcode);
+#endif
             registerFile[code->m_dstIndex] = Value(InterpreterSlowPath::abstractLeftIsLessThanEqualRight(*state, left, right, false));
             ADD_PROGRAM_COUNTER(BinaryLessThanOrEqual);
             NEXT_INSTRUCTION();
@@ -509,6 +574,9 @@ Value Interpreter::interpret(ExecutionState* state, ByteCodeBlock* byteCodeBlock
             BinaryGreaterThan* code = (BinaryGreaterThan*)programCounter;
             const Value& left = registerFile[code->m_srcIndex0];
             const Value& right = registerFile[code->m_srcIndex1];
+#if !defined(ESCARGOT_SMALL_CONFIG)
+            InterpreterSlowPath::profileOperandType(code, code->m_extraData, left.isInt32() && right.isInt32(), BinaryGreaterThanInt32Opcode, EndOpcode);
+#endif
             registerFile[code->m_dstIndex] = Value(InterpreterSlowPath::abstractLeftIsLessThanRight(*state, right, left, true));
             ADD_PROGRAM_COUNTER(BinaryGreaterThan);
             NEXT_INSTRUCTION();
@@ -520,6 +588,9 @@ Value Interpreter::interpret(ExecutionState* state, ByteCodeBlock* byteCodeBlock
             BinaryGreaterThanOrEqual* code = (BinaryGreaterThanOrEqual*)programCounter;
             const Value& left = registerFile[code->m_srcIndex0];
             const Value& right = registerFile[code->m_srcIndex1];
+#if !defined(ESCARGOT_SMALL_CONFIG)
+            InterpreterSlowPath::profileOperandType(code, code->m_extraData, left.isInt32() && right.isInt32(), BinaryGreaterThanOrEqualInt32Opcode, EndOpcode);
+#endif
             registerFile[code->m_dstIndex] = Value(InterpreterSlowPath::abstractLeftIsLessThanEqualRight(*state, right, left, true));
             ADD_PROGRAM_COUNTER(BinaryGreaterThanOrEqual);
             NEXT_INSTRUCTION();
@@ -539,6 +610,9 @@ Value Interpreter::interpret(ExecutionState* state, ByteCodeBlock* byteCodeBlock
             :
         {
             Increment* code = (Increment*)programCounter;
+#if !defined(ESCARGOT_SMALL_CONFIG)
+            InterpreterSlowPath::profileOperandType(code, code->m_quickeningProfile, registerFile[code->m_srcIndex].isInt32(), IncrementInt32Opcode, EndOpcode);
+#endif
             registerFile[code->m_dstIndex] = InterpreterSlowPath::incrementOperation(*state, registerFile[code->m_srcIndex]);
             ADD_PROGRAM_COUNTER(Increment);
             NEXT_INSTRUCTION();
@@ -558,6 +632,9 @@ Value Interpreter::interpret(ExecutionState* state, ByteCodeBlock* byteCodeBlock
             :
         {
             Decrement* code = (Decrement*)programCounter;
+#if !defined(ESCARGOT_SMALL_CONFIG)
+            InterpreterSlowPath::profileOperandType(code, code->m_quickeningProfile, registerFile[code->m_srcIndex].isInt32(), DecrementInt32Opcode, EndOpcode);
+#endif
             registerFile[code->m_dstIndex] = InterpreterSlowPath::decrementOperation(*state, registerFile[code->m_srcIndex]);
             ADD_PROGRAM_COUNTER(Decrement);
             NEXT_INSTRUCTION();
@@ -592,10 +669,11 @@ Value Interpreter::interpret(ExecutionState* state, ByteCodeBlock* byteCodeBlock
                             NEXT_INSTRUCTION();
                         }
                     }
-                } else {
-                    registerFile[code->m_storeRegisterIndex] = obj->getIndexedPropertyValue(*state, property, willBeObject);
-                    ADD_PROGRAM_COUNTER(GetObject);
-                    NEXT_INSTRUCTION();
+                } else if (code->m_inlineCache) {
+                    if (InterpreterSlowPath::getObjectByKeyedInlineCache(*state, code->m_inlineCache, obj, property, registerFile[code->m_storeRegisterIndex])) {
+                        ADD_PROGRAM_COUNTER(GetObject);
+                        NEXT_INSTRUCTION();
+                    }
                 }
             }
             JUMP_INSTRUCTION(GetObjectOpcodeSlowCase);
@@ -617,6 +695,11 @@ Value Interpreter::interpret(ExecutionState* state, ByteCodeBlock* byteCodeBlock
                         NEXT_INSTRUCTION();
                     }
                 }
+            } else if (code->m_inlineCache && willBeObject.isObject()) {
+                if (InterpreterSlowPath::setObjectByKeyedInlineCache(*state, code->m_inlineCache, willBeObject.asObject(), property, registerFile[code->m_loadRegisterIndex])) {
+                    ADD_PROGRAM_COUNTER(SetObjectOperation);
+                    NEXT_INSTRUCTION();
+                }
             }
             JUMP_INSTRUCTION(SetObjectOpcodeSlowCase);
         }
@@ -644,6 +727,7 @@ Value Interpreter::interpret(ExecutionState* state, ByteCodeBlock* byteCodeBlock
                 if (cacheData[currentCacheIndex] == objStructure) {
                     ASSERT(objStructure->findProperty(code->m_simpleInlineCache->m_propertyName).first == code->m_simpleInlineCache->m_cachedIndexes[currentCacheIndex]);
                     registerFile[code->m_storeRegisterIndex] = obj->m_values[code->m_simpleInlineCache->m_cachedIndexes[currentCacheIndex]];
+                    OPCODE_STATS_COUNT_INLINE_CACHE_HIT(GetObjectPreComputedCase);
                     ADD_PROGRAM_COUNTER(GetObjectPreComputedCase);
                     NEXT_INSTRUCTION();
                 }
@@ -673,6 +757,7 @@ Value Interpreter::interpret(ExecutionState* state, ByteCodeBlock* byteCodeBlock
         {
             Jump* code = (Jump*)programCounter;
             ASSERT(code->m_jumpPosition != SIZE_MAX);
+            PROFILER_SAFEPOINT();
             programCounter = code->m_jumpPosition;
             NEXT_INSTRUCTION();
         }
@@ -718,6 +803,10 @@ Value Interpreter::interpret(ExecutionState* state, ByteCodeBlock* byteCodeBlock
             JumpIfTrue* code = (JumpIfTrue*)programCounter;
             ASSERT(code->m_jumpPosition != SIZE_MAX);
             if (registerFile[code->m_registerIndex].toBoolean()) {
+                // back edge of do-while loop
+                if (code->m_jumpPosition < programCounter) {
+                    PROFILER_SAFEPOINT();
+                }
                 programCounter = code->m_jumpPosition;
             } else {
                 ADD_PROGRAM_COUNTER(JumpIfTrue);
@@ -753,6 +842,394 @@ Value Interpreter::interpret(ExecutionState* state, ByteCodeBlock* byteCodeBlock
             NEXT_INSTRUCTION();
         }
 
+#if defined(ENABLE_SUPER_INSTRUCTION)
+        // superinstructions execute the following bytecode without dispatching it
+        // programCounter moves to the following bytecode first so that it reports its own location on error
+
+        DEFINE_OPCODE(BinaryLessThanJumpIfFalse)
+            :
+        {
+            BinaryLessThan* code = (BinaryLessThan*)programCounter;
+            const Value& left = registerFile[code->m_srcIndex0];
+            const Value& right = registerFile[code->m_srcIndex1];
+            bool result = InterpreterSlowPath::abstractLeftIsLessThanRight(*state, left, right, false);
+            registerFile[code->m_dstIndex] = Value(result);
+            ADD_PROGRAM_COUNTER(BinaryLessThan);
+
+            JumpIfFalse* jumpCode = (JumpIfFalse*)programCounter;
+            ASSERT(jumpCode->m_jumpPosition != SIZE_MAX);
+            ASSERT(jumpCode->m_registerIndex == code->m_dstIndex);
+            if (!result) {
+                programCounter = jumpCode->m_jumpPosition;
+            } else {
+                ADD_PROGRAM_COUNTER(JumpIfFalse);
+            }
+            NEXT_INSTRUCTION();
+        }
+
+        DEFINE_OPCODE(BinaryLessThanOrEqualJumpIfFalse)
+            :
+        {
+            BinaryLessThanOrEqual* code = (BinaryLessThanOrEqual*)programCounter;
+            const Value& left = registerFile[code->m_srcIndex0];
+            const Value& right = registerFile[code->m_srcIndex1];
+            bool result = InterpreterSlowPath::abstractLeftIsLessThanEqualRight(*state, left, right, false);
+            registerFile[code->m_dstIndex] = Value(result);
+            ADD_PROGRAM_COUNTER(BinaryLessThanOrEqual);
+
+            JumpIfFalse* jumpCode = (JumpIfFalse*)programCounter;
+            ASSERT(jumpCode->m_jumpPosition != SIZE_MAX);
+            ASSERT(jumpCode->m_registerIndex == code->m_dstIndex);
+            if (!result) {
+                programCounter = jumpCode->m_jumpPosition;
+            } else {
+                ADD_PROGRAM_COUNTER(JumpIfFalse);
+            }
+            NEXT_INSTRUCTION();
+        }
+
+        DEFINE_OPCODE(BinaryGreaterThanJumpIfFalse)
+            :
+        {
+            BinaryGreaterThan* code = (BinaryGreaterThan*)programCounter;
+            const Value& left = registerFile[code->m_srcIndex0];
+            const Value& right = registerFile[code->m_srcIndex1];
+            bool result = InterpreterSlowPath::abstractLeftIsLessThanRight(*state, right, left, true);
+            registerFile[code->m_dstIndex] = Value(result);
+            ADD_PROGRAM_COUNTER(BinaryGreaterThan);
+
+            JumpIfFalse* jumpCode = (JumpIfFalse*)programCounter;
+            ASSERT(jumpCode->m_jumpPosition != SIZE_MAX);
+            ASSERT(jumpCode->m_registerIndex == code->m_dstIndex);
+            if (!result) {
+                programCounter = jumpCode->m_jumpPosition;
+            } else {
+                ADD_PROGRAM_COUNTER(JumpIfFalse);
+            }
+            NEXT_INSTRUCTION();
+        }
+
+        DEFINE_OPCODE(BinaryGreaterThanOrEqualJumpIfFalse)
+            :
+        {
+            BinaryGreaterThanOrEqual* code = (BinaryGreaterThanOrEqual*)programCounter;
+            const Value& left = registerFile[code->m_srcIndex0];
+            const Value& right = registerFile[code->m_srcIndex1];
+            bool result = InterpreterSlowPath::abstractLeftIsLessThanEqualRight(*state, right, left, true);
+            registerFile[code->m_dstIndex] = Value(result);
+            ADD_PROGRAM_COUNTER(BinaryGreaterThanOrEqual);
+
+            JumpIfFalse* jumpCode = (JumpIfFalse*)programCounter;
+            ASSERT(jumpCode->m_jumpPosition != SIZE_MAX);
+            ASSERT(jumpCode->m_registerIndex == code->m_dstIndex);
+            if (!result) {
+                programCounter = jumpCode->m_jumpPosition;
+            } else {
+                ADD_PROGRAM_COUNTER(JumpIfFalse);
+            }
+            NEXT_INSTRUCTION();
+        }
+
+        DEFINE_OPCODE(BinaryStrictEqualJumpIfFalse)
+            :
+        {
+            BinaryStrictEqual* code = (BinaryStrictEqual*)programCounter;
+            const Value& left = registerFile[code->m_srcIndex0];
+            const Value& right = registerFile[code->m_srcIndex1];
+            bool result = static_cast<bool>(left.equalsTo(*state, right) ^ code->m_extraData);
+            registerFile[code->m_dstIndex] = Value(result);
+            ADD_PROGRAM_COUNTER(BinaryStrictEqual);
+
+            JumpIfFalse* jumpCode = (JumpIfFalse*)programCounter;
+            ASSERT(jumpCode->m_jumpPosition != SIZE_MAX);
+            ASSERT(jumpCode->m_registerIndex == code->m_dstIndex);
+            if (!result) {
+                programCounter = jumpCode->m_jumpPosition;
+            } else {
+                ADD_PROGRAM_COUNTER(JumpIfFalse);
+            }
+            NEXT_INSTRUCTION();
+        }
+
+        DEFINE_OPCODE(IncrementJump)
+            :
+        {
+            Increment* code = (Increment*)programCounter;
+            registerFile[code->m_dstIndex] = InterpreterSlowPath::incrementOperation(*state, registerFile[code->m_srcIndex]);
+            ADD_PROGRAM_COUNTER(Increment);
+
+            Jump* jumpCode = (Jump*)programCounter;
+            ASSERT(jumpCode->m_jumpPosition != SIZE_MAX);
+            PROFILER_SAFEPOINT();
+            programCounter = jumpCode->m_jumpPosition;
+            NEXT_INSTRUCTION();
+        }
+
+        DEFINE_OPCODE(DecrementJump)
+            :
+        {
+            Decrement* code = (Decrement*)programCounter;
+            registerFile[code->m_dstIndex] = InterpreterSlowPath::decrementOperation(*state, registerFile[code->m_srcIndex]);
+            ADD_PROGRAM_COUNTER(Decrement);
+
+            Jump* jumpCode = (Jump*)programCounter;
+            ASSERT(jumpCode->m_jumpPosition != SIZE_MAX);
+            PROFILER_SAFEPOINT();
+            programCounter = jumpCode->m_jumpPosition;
+            NEXT_INSTRUCTION();
+        }
+
+        DEFINE_OPCODE(LoadLiteralSetObjectPreComputedCase)
+            :
+        {
+            LoadLiteral* code = (LoadLiteral*)programCounter;
+            registerFile[code->m_registerIndex] = code->m_value;
+            ADD_PROGRAM_COUNTER(LoadLiteral);
+
+            SetObjectPreComputedCase* setCode = (SetObjectPreComputedCase*)programCounter;
+            InterpreterSlowPath::setObjectPreComputedCaseOperation(*state, registerFile[setCode->m_objectRegisterIndex], registerFile[setCode->m_loadRegisterIndex], setCode, byteCodeBlock);
+            ADD_PROGRAM_COUNTER(SetObjectPreComputedCase);
+            NEXT_INSTRUCTION();
+        }
+#endif
+
+#if !defined(ESCARGOT_SMALL_CONFIG)
+        // type specialized bytecodes rewritten by quickening
+        // they have a single guard and go back to the generic bytecode for good when it fails
+
+        DEFINE_OPCODE(BinaryPlusInt32)
+            :
+        {
+            BinaryPlus* code = (BinaryPlus*)programCounter;
+            const Value& left = registerFile[code->m_srcIndex0];
+            const Value& right = registerFile[code->m_srcIndex1];
+            if (UNLIKELY(!left.isInt32() || !right.isInt32())) {
+                code->m_extraData = ByteCodeQuickening::Disabled;
+                code->changeOpcode(BinaryPlusOpcode);
+                JUMP_INSTRUCTION(BinaryPlus);
+            }
+            int32_t a = left.asInt32();
+            int32_t b = right.asInt32();
+            int32_t c;
+            bool result = ArithmeticOperations<int32_t, int32_t, int32_t>::add(a, b, c);
+            if (LIKELY(result)) {
+                registerFile[code->m_dstIndex] = Value(c);
+            } else {
+                registerFile[code->m_dstIndex] = Value(Value::EncodeAsDouble, (double)a + (double)b);
+            }
+            ADD_PROGRAM_COUNTER(BinaryPlus);
+            NEXT_INSTRUCTION();
+        }
+
+        DEFINE_OPCODE(BinaryPlusDouble)
+            :
+        {
+            BinaryPlus* code = (BinaryPlus*)programCounter;
+            const Value& left = registerFile[code->m_srcIndex0];
+            const Value& right = registerFile[code->m_srcIndex1];
+            if (UNLIKELY(!left.isNumber() || !right.isNumber() || (left.isInt32() && right.isInt32()))) {
+                code->m_extraData = ByteCodeQuickening::Disabled;
+                code->changeOpcode(BinaryPlusOpcode);
+                JUMP_INSTRUCTION(BinaryPlus);
+            }
+            registerFile[code->m_dstIndex] = Value(Value::EncodeAsDouble, left.asNumber() + right.asNumber());
+            ADD_PROGRAM_COUNTER(BinaryPlus);
+            NEXT_INSTRUCTION();
+        }
+
+        DEFINE_OPCODE(BinaryMinusInt32)
+            :
+        {
+            BinaryMinus* code = (BinaryMinus*)programCounter;
+            const Value& left = registerFile[code->m_srcIndex0];
+            const Value& right = registerFile[code->m_srcIndex1];
+            if (UNLIKELY(!left.isInt32() || !right.isInt32())) {
+                code->m_extraData = ByteCodeQuickening::Disabled;
+                code->changeOpcode(BinaryMinusOpcode);
+                JUMP_INSTRUCTION(BinaryMinus);
+            }
+            int32_t a = left.asInt32();
+            int32_t b = right.asInt32();
+            int32_t c;
+            bool result = ArithmeticOperations<int32_t, int32_t, int32_t>::sub(a, b, c);
+            if (LIKELY(result)) {
+                registerFile[code->m_dstIndex] = Value(c);
+            } else {
+                registerFile[code->m_dstIndex] = Value(Value::EncodeAsDouble, (double)a - (double)b);
+            }
+            ADD_PROGRAM_COUNTER(BinaryMinus);
+            NEXT_INSTRUCTION();
+        }
+
+        DEFINE_OPCODE(BinaryMinusDouble)
+            :
+        {
+            BinaryMinus* code = (BinaryMinus*)programCounter;
+            const Value& left = registerFile[code->m_srcIndex0];
+            const Value& right = registerFile[code->m_srcIndex1];
+            if (UNLIKELY(!left.isNumber() || !right.isNumber() || (left.isInt32() && right.isInt32()))) {
+                code->m_extraData = ByteCodeQuickening::Disabled;
+                code->changeOpcode(BinaryMinusOpcode);
+                JUMP_INSTRUCTION(BinaryMinus);
+            }
+            registerFile[code->m_dstIndex] = Value(Value::EncodeAsDouble, left.asNumber() - right.asNumber());
+            ADD_PROGRAM_COUNTER(BinaryMinus);
+            NEXT_INSTRUCTION();
+        }
+
+        DEFINE_OPCODE(BinaryMultiplyInt32)
+            :
+        {
+            BinaryMultiply* code = (BinaryMultiply*)programCounter;
+            const Value& left = registerFile[code->m_srcIndex0];
+            const Value& right = registerFile[code->m_srcIndex1];
+            if (UNLIKELY(!left.isInt32() || !right.isInt32())) {
+                code->m_extraData = ByteCodeQuickening::Disabled;
+                code->changeOpcode(BinaryMultiplyOpcode);
+                JUMP_INSTRUCTION(BinaryMultiply);
+            }
+            int32_t a = left.asInt32();
+            int32_t b = right.asInt32();
+            if (UNLIKELY((!a || !b) && (a >> 31 || b >> 31))) { // -1 * 0 should be treated as -0, not +0
+                registerFile[code->m_dstIndex] = Value(Value::DoubleToIntConvertibleTestNeeds, (double)a * (double)b);
+            } else {
+                int32_t c;
+                bool result = ArithmeticOperations<int32_t, int32_t, int32_t>::multiply(a, b, c);
+                if (LIKELY(result)) {
+                    registerFile[code->m_dstIndex] = Value(c);
+                } else {
+                    registerFile[code->m_dstIndex] = Value(Value::EncodeAsDouble, a * (double)b);
+                }
+            }
+            ADD_PROGRAM_COUNTER(BinaryMultiply);
+            NEXT_INSTRUCTION();
+        }
+
+        DEFINE_OPCODE(BinaryMultiplyDouble)
+            :
+        {
+            BinaryMultiply* code = (BinaryMultiply*)programCounter;
+            const Value& left = registerFile[code->m_srcIndex0];
+            const Value& right = registerFile[code->m_srcIndex1];
+            if (UNLIKELY(!left.isNumber() || !right.isNumber() || (left.isInt32() && right.isInt32()))) {
+                code->m_extraData = ByteCodeQuickening::Disabled;
+                code->changeOpcode(BinaryMultiplyOpcode);
+                JUMP_INSTRUCTION(BinaryMultiply);
+            }
+            registerFile[code->m_dstIndex] = Value(Value::EncodeAsDouble, left.asNumber() * right.asNumber());
+            ADD_PROGRAM_COUNTER(BinaryMultiply);
+            NEXT_INSTRUCTION();
+        }
+
+        DEFINE_OPCODE(BinaryLessThanInt32)
+            :
+        {
+            BinaryLessThan* code = (BinaryLessThan*)programCounter;
+            const Value& left = registerFile[code->m_srcIndex0];
+            const Value& right = registerFile[code->m_srcIndex1];
+            if (UNLIKELY(!left.isInt32() || !right.isInt32())) {
+                code->m_extraData = ByteCodeQuickening::Disabled;
+                code->changeOpcode(BinaryLessThanOpcode);
+                JUMP_INSTRUCTION(BinaryLessThan);
+            }
+            registerFile[code->m_dstIndex] = Value(left.asInt32() < right.asInt32());
+            ADD_PROGRAM_COUNTER(BinaryLessThan);
+            NEXT_INSTRUCTION();
+        }
+
+        DEFINE_OPCODE(BinaryLessThanOrEqualInt32)
+            :
+        {
+            BinaryLessThanOrEqual* code = (BinaryLessThanOrEqual*)programCounter;
+            const Value& left = registerFile[code->m_srcIndex0];
+            const Value& right = registerFile[code->m_srcIndex1];
+            if (UNLIKELY(!left.isInt32() || !right.isInt32())) {
+                code->m_extraData = ByteCodeQuickening::Disabled;
+                code->changeOpcode(BinaryLessThanOrEqualOpcode);
+                JUMP_INSTRUCTION(BinaryLessThanOrEqual);
+            }
+            registerFile[code->m_dstIndex] = Value(left.asInt32() <= right.asInt32());
+            ADD_PROGRAM_COUNTER(BinaryLessThanOrEqual);
+            NEXT_INSTRUCTION();
+        }
+
+        DEFINE_OPCODE(BinaryGreaterThanInt32)
+            :
+        {
+            BinaryGreaterThan* code = (BinaryGreaterThan*)programCounter;
+            const Value& left = registerFile[code->m_srcIndex0];
+            const Value& right = registerFile[code->m_srcIndex1];
+            if (UNLIKELY(!left.isInt32() || !right.isInt32())) {
+                code->m_extraData = ByteCodeQuickening::Disabled;
+                code->changeOpcode(BinaryGreaterThanOpcode);
+                JUMP_INSTRUCTION(BinaryGreaterThan);
+            }
+            registerFile[code->m_dstIndex] = Value(left.asInt32() > right.asInt32());
+            ADD_PROGRAM_COUNTER(BinaryGreaterThan);
+            NEXT_INSTRUCTION();
+        }
+
+        DEFINE_OPCODE(BinaryGreaterThanOrEqualInt32)
+            :
+        {
+            BinaryGreaterThanOrEqual* code = (BinaryGreaterThanOrEqual*)programCounter;
+            const Value& left = registerFile[code->m_srcIndex0];
+            const Value& right = registerFile[code->m_srcIndex1];
+            if (UNLIKELY(!left.isInt32() || !right.isInt32())) {
+                code->m_extraData = ByteCodeQuickening::Disabled;
+                code->changeOpcode(BinaryGreaterThanOrEqualOpcode);
+                JUMP_INSTRUCTION(BinaryGreaterThanOrEqual);
+            }
+            registerFile[code->m_dstIndex] = Value(left.asInt32() >= right.asInt32());
+            ADD_PROGRAM_COUNTER(BinaryGreaterThanOrEqual);
+            NEXT_INSTRUCTION();
+        }
+
+        DEFINE_OPCODE(IncrementInt32)
+            :
+        {
+            Increment* code = (Increment*)programCounter;
+            const Value& src = registerFile[code->m_srcIndex];
+            if (UNLIKELY(!src.isInt32())) {
+                code->m_quickeningProfile = ByteCodeQuickening::Disabled;
+                code->changeOpcode(IncrementOpcode);
+                JUMP_INSTRUCTION(Increment);
+            }
+            int32_t a = src.asInt32();
+            int32_t c;
+            bool result = ArithmeticOperations<int32_t, int32_t, int32_t>::add(a, 1, c);
+            if (LIKELY(result)) {
+                registerFile[code->m_dstIndex] = Value(c);
+            } else {
+                registerFile[code->m_dstIndex] = Value(Value::EncodeAsDouble, (double)a + 1);
+            }
+            ADD_PROGRAM_COUNTER(Increment);
+            NEXT_INSTRUCTION();
+        }
+
+        DEFINE_OPCODE(DecrementInt32)
+            :
+        {
+            Decrement* code = (Decrement*)programCounter;
+            const Value& src = registerFile[code->m_srcIndex];
+            if (UNLIKELY(!src.isInt32())) {
+                code->m_quickeningProfile = ByteCodeQuickening::Disabled;
+                code->changeOpcode(DecrementOpcode);
+                JUMP_INSTRUCTION(Decrement);
+            }
+            int32_t a = src.asInt32();
+            int32_t c;
+            bool result = ArithmeticOperations<int32_t, int32_t, int32_t>::sub(a, 1, c);
+            if (LIKELY(result)) {
+                registerFile[code->m_dstIndex] = Value(c);
+            } else {
+                registerFile[code->m_dstIndex] = Value(Value::EncodeAsDouble, (double)a - 1);
+            }
+            ADD_PROGRAM_COUNTER(Decrement);
+            NEXT_INSTRUCTION();
+        }
+#endif
+
         DEFINE_OPCODE(Call)
             :
         {
@@ -1118,7 +1595,7 @@ Value Interpreter::interpret(ExecutionState* state, ByteCodeBlock* byteCodeBlock
             :
         {
             GetObject* code = (GetObject*)programCounter;
-            InterpreterSlowPath::getObjectOpcodeSlowCase(*state, code, registerFile);
+            InterpreterSlowPath::getObjectOpcodeSlowCase(*state, code, registerFile, byteCodeBlock);
             ADD_PROGRAM_COUNTER(GetObject);
             NEXT_INSTRUCTION();
         }
@@ -1127,7 +1604,7 @@ Value Interpreter::interpret(ExecutionState* state, ByteCodeBlock* byteCodeBlock
             :
         {
             SetObjectOperation* code = (SetObjectOperation*)programCounter;
-            InterpreterSlowPath::setObjectOpcodeSlowCase(*state, code, registerFile);
+            InterpreterSlowPath::setObjectOpcodeSlowCase(*state, code, registerFile, byteCodeBlock);
             ADD_PROGRAM_COUNTER(SetObjectOperation);
             NEXT_INSTRUCTION();
         }
@@ -1750,6 +2227,7 @@ Value Interpreter::interpret(ExecutionState* state, ByteCodeBlock* byteCodeBlock
 
 NEVER_INLINE EnvironmentRecord* InterpreterSlowPath::getBindedEnvironmentRecordByName(ExecutionState& state, LexicalEnvironment* env, const AtomicString& name, Value& bindedValue)
 {
+    OPCODE_STATS_COUNT_SLOW_PATH();
     while (env) {
         EnvironmentRecord::GetBindingValueResult result = env->record()->getBindingValue(state, name);
         if (result.m_hasBindingValue) {
@@ -1765,6 +2243,7 @@ NEVER_INLINE EnvironmentRecord* InterpreterSlowPath::getBindedEnvironmentRecordB
 
 NEVER_INLINE Value InterpreterSlowPath::loadByName(ExecutionState& state, LexicalEnvironment* env, const AtomicString& name, bool throwException)
 {
+    OPCODE_STATS_COUNT_SLOW_PATH();
     while (env) {
         EnvironmentRecord::GetBindingValueResult result = env->record()->getBindingValue(state, name);
         if (result.m_hasBindingValue) {
@@ -1787,6 +2266,7 @@ NEVER_INLINE Value InterpreterSlowPath::loadByName(ExecutionState& state, Lexica
 
 NEVER_INLINE void InterpreterSlowPath::storeByName(ExecutionState& state, LexicalEnvironment* env, const AtomicString& name, const Value& value)
 {
+    OPCODE_STATS_COUNT_SLOW_PATH();
     while (env) {
         auto result = env->record()->hasBinding(state, name);
         if (result.m_index != SIZE_MAX) {
@@ -1804,6 +2284,7 @@ NEVER_INLINE void InterpreterSlowPath::storeByName(ExecutionState& state, Lexica
 
 NEVER_INLINE void InterpreterSlowPath::initializeByName(ExecutionState& state, LexicalEnvironment* env, const AtomicString& name, bool isLexicallyDeclaredName, const Value& value)
 {
+    OPCODE_STATS_COUNT_SLOW_PATH();
     if (isLexicallyDeclaredName) {
         state.lexicalEnvironment()->record()->initializeBinding(state, name, value);
     } else {
@@ -1823,6 +2304,7 @@ NEVER_INLINE void InterpreterSlowPath::initializeByName(ExecutionState& state, L
 
 NEVER_INLINE void InterpreterSlowPath::resolveNameAddress(ExecutionState& state, ResolveNameAddress* code, Value* registerFile)
 {
+    OPCODE_STATS_COUNT_SLOW_PATH();
     LexicalEnvironment* env = state.lexicalEnvironment();
     int64_t count = 0;
     while (env) {
@@ -1854,6 +2336,7 @@ NEVER_INLINE void InterpreterSlowPath::resolveNameAddress(ExecutionState& state,
 
 NEVER_INLINE void InterpreterSlowPath::storeByNameWithAddress(ExecutionState& state, StoreByNameWithAddress* code, Value* registerFile)
 {
+    OPCODE_STATS_COUNT_SLOW_PATH();
     LexicalEnvironment* env = state.lexicalEnvironment();
     const Value& value = registerFile[code->m_valueRegisterIndex];
     int64_t count = registerFile[code->m_addressRegisterIndex].toNumber(state);
@@ -1881,6 +2364,7 @@ NEVER_INLINE void InterpreterSlowPath::storeByNameWithAddress(ExecutionState& st
 
 NEVER_INLINE Value InterpreterSlowPath::plusSlowCase(ExecutionState& state, const Value& left, const Value& right)
 {
+    OPCODE_STATS_COUNT_SLOW_PATH();
     Value ret(Value::ForceUninitialized);
     Value lval(Value::ForceUninitialized);
     Value rval(Value::ForceUninitialized);
@@ -1924,6 +2408,7 @@ NEVER_INLINE Value InterpreterSlowPath::plusSlowCase(ExecutionState& state, cons
 
 NEVER_INLINE Value InterpreterSlowPath::minusSlowCase(ExecutionState& state, const Value& left, const Value& right)
 {
+    OPCODE_STATS_COUNT_SLOW_PATH();
     // https://www.ecma-international.org/ecma-262/#sec-subtraction-operator-minus
     // Let lref be the result of evaluating AdditiveExpression.
     // Let lval be ? GetValue(lref).
@@ -1948,6 +2433,7 @@ NEVER_INLINE Value InterpreterSlowPath::minusSlowCase(ExecutionState& state, con
 
 NEVER_INLINE Value InterpreterSlowPath::multiplySlowCase(ExecutionState& state, const Value& left, const Value& right)
 {
+    OPCODE_STATS_COUNT_SLOW_PATH();
     auto lnum = left.toNumeric(state);
     auto rnum = right.toNumeric(state);
     if (UNLIKELY(lnum.second != rnum.second)) {
@@ -1962,6 +2448,7 @@ NEVER_INLINE Value InterpreterSlowPath::multiplySlowCase(ExecutionState& state,
 
 NEVER_INLINE Value InterpreterSlowPath::divisionSlowCase(ExecutionState& state, const Value& left, const Value& right)
 {
+    OPCODE_STATS_COUNT_SLOW_PATH();
     auto lnum = left.toNumeric(state);
     auto rnum = right.toNumeric(state);
     if (UNLIKELY(lnum.second != rnum.second)) {
@@ -1979,6 +2466,7 @@ NEVER_INLINE Value InterpreterSlowPath::divisionSlowCase(ExecutionState& state,
 
 NEVER_INLINE Value InterpreterSlowPath::unaryMinusSlowCase(ExecutionState& state, const Value& src)
 {
+    OPCODE_STATS_COUNT_SLOW_PATH();
     auto r = src.toNumeric(state);
     if (r.second) {
         return r.first.asBigInt()->negativeValue(state);
@@ -1989,6 +2477,7 @@ NEVER_INLINE Value InterpreterSlowPath::unaryMinusSlowCase(ExecutionState& state
 
 NEVER_INLINE Value InterpreterSlowPath::modOperation(ExecutionState& state, const Value& left, const Value& right)
 {
+    OPCODE_STATS_COUNT_SLOW_PATH();
     Value ret(Value::ForceUninitialized);
 
     int32_t intLeft;
@@ -2038,6 +2527,7 @@ NEVER_INLINE Value InterpreterSlowPath::modOperation(ExecutionState& state, cons
 
 NEVER_INLINE Value InterpreterSlowPath::exponentialOperation(ExecutionState& state, const Value& left, const Value& right)
 {
+    OPCODE_STATS_COUNT_SLOW_PATH();
     Value ret(Value::ForceUninitialized);
 
     auto lnum = left.toNumeric(state);
@@ -2065,11 +2555,13 @@ NEVER_INLINE Value InterpreterSlowPath::exponentialOperation(ExecutionState& sta
 
 NEVER_INLINE void InterpreterSlowPath::instanceOfOperation(ExecutionState& state, BinaryInstanceOfOperation* code, Value* registerFile)
 {
+    OPCODE_STATS_COUNT_SLOW_PATH();
     registerFile[code->m_dstIndex] = Value(registerFile[code->m_srcIndex0].instanceOf(state, registerFile[code->m_srcIndex1]));
 }
 
 NEVER_INLINE void InterpreterSlowPath::templateOperation(ExecutionState& state, LexicalEnvironment* env, TemplateOperation* code, Value* registerFile)
 {
+    OPCODE_STATS_COUNT_SLOW_PATH();
     const Value& s1 = registerFile[code->m_src0Index];
     const Value& s2 = registerFile[code->m_src1Index];
 
@@ -2081,6 +2573,7 @@ NEVER_INLINE void InterpreterSlowPath::templateOperation(ExecutionState& state,
 
 NEVER_INLINE Value InterpreterSlowPath::bitwiseOperationSlowCase(ExecutionState& state, const Value& left, const Value& right, Interpreter::BitwiseOperationKind kind)
 {
+    OPCODE_STATS_COUNT_SLOW_PATH();
     auto lnum = left.toNumeric(state);
     auto rnum = right.toNumeric(state);
     if (UNLIKELY(lnum.second != rnum.second)) {
@@ -2116,6 +2609,7 @@ NEVER_INLINE Value InterpreterSlowPath::bitwiseOperationSlowCase(ExecutionState&
 
 NEVER_INLINE Value InterpreterSlowPath::bitwiseNotOperationSlowCase(ExecutionState& state, const Value& a)
 {
+    OPCODE_STATS_COUNT_SLOW_PATH();
     auto r = a.toNumeric(state);
     if (r.second) {
         return r.first.asBigInt()->bitwiseNot(state);
@@ -2126,6 +2620,7 @@ NEVER_INLINE Value InterpreterSlowPath::bitwiseNotOperationSlowCase(ExecutionSta
 
 NEVER_INLINE Value InterpreterSlowPath::shiftOperationSlowCase(ExecutionState& state, const Value& left, const Value& right, Interpreter::ShiftOperationKind kind)
 {
+    OPCODE_STATS_COUNT_SLOW_PATH();
     auto lnum = left.toNumeric(state);
     auto rnum = right.toNumeric(state);
     if (UNLIKELY(lnum.second != rnum.second)) {
@@ -2174,6 +2669,7 @@ NEVER_INLINE Value InterpreterSlowPath::shiftOperationSlowCase(ExecutionState& s
 
 NEVER_INLINE void InterpreterSlowPath::deleteOperation(ExecutionState& state, LexicalEnvironment* env, UnaryDelete* code, Value* registerFile, ByteCodeBlock* byteCodeBlock)
 {
+    OPCODE_STATS_COUNT_SLOW_PATH();
     if (code->m_id.string()->length()) {
         bool result;
         AtomicString arguments = state.context()->staticStrings().arguments;
@@ -2305,6 +2801,7 @@ ALWAYS_INLINE bool abstractLeftIsLessThanRightNumeric(ExecutionState& state, con
 
 NEVER_INLINE bool InterpreterSlowPath::abstractLeftIsLessThanRightSlowCase(ExecutionState& state, const Value& left, const Value& right, bool switched)
 {
+    OPCODE_STATS_COUNT_SLOW_PATH();
     Value lval, rval;
     if (switched) {
         rval = right.toPrimitive(state, Value::PreferNumber);
@@ -2337,6 +2834,7 @@ NEVER_INLINE bool InterpreterSlowPath::abstractLeftIsLessThanRightSlowCase(Execu
 
 NEVER_INLINE bool InterpreterSlowPath::abstractLeftIsLessThanEqualRightSlowCase(ExecutionState& state, const Value& left, const Value& right, bool switched)
 {
+    OPCODE_STATS_COUNT_SLOW_PATH();
     Value lval, rval;
     if (switched) {
         rval = right.toPrimitive(state, Value::PreferNumber);
@@ -2369,6 +2867,7 @@ NEVER_INLINE bool InterpreterSlowPath::abstractLeftIsLessThanEqualRightSlowCase(
 
 NEVER_INLINE void InterpreterSlowPath::getObjectPrecomputedCaseOperation(ExecutionState& state, GetObjectPreComputedCase* code, Value* registerFile, ByteCodeBlock* block)
 {
+    OPCODE_STATS_COUNT_SLOW_PATH();
     const Value& receiver = registerFile[code->m_objectRegisterIndex];
     Object* orgObj;
     if (LIKELY(receiver.isObject())) {
@@ -2417,6 +2916,7 @@ NEVER_INLINE void InterpreterSlowPath::getObjectPrecomputedCaseOperation(Executi
                     } else {
                         registerFile[code->m_storeRegisterIndex] = Value();
                     }
+                    OPCODE_STATS_COUNT_INLINE_CACHE_HIT(GetObjectPreComputedCase);
                     return;
                 }
             }
@@ -2429,6 +2929,8 @@ NEVER_INLINE void InterpreterSlowPath::getObjectPrecomputedCaseOperation(Executi
         return;
     }
 
+    OPCODE_STATS_COUNT_INLINE_CACHE_MISS(GetObjectPreComputedCase);
+
 #if defined(ESCARGOT_SMALL_CONFIG)
     registerFile[code->m_storeRegisterIndex] = obj->get(state, ObjectPropertyName(state, code->m_propertyName)).value(state, receiver);
     return;
@@ -2436,7 +2938,10 @@ NEVER_INLINE void InterpreterSlowPath::getObjectPrecomputedCaseOperation(Executi
 #else
 
     ObjectStructurePropertyName propertyName;
-    if (code->m_inlineCacheMode == GetObjectPreComputedCase::None) {
+    if (code->m_inlineCacheMode == GetObjectPreComputedCase::Megamorphic) {
+        registerFile[code->m_storeRegisterIndex] = getObjectPrecomputedCaseMegamorphicOperation(state, obj, receiver, code->m_propertyName);
+        return;
+    } else if (code->m_inlineCacheMode == GetObjectPreComputedCase::None) {
         propertyName = code->m_propertyName;
     } else if (code->m_inlineCacheMode == GetObjectPreComputedCase::Simple) {
         propertyName = code->m_simpleInlineCache->m_propertyName;
@@ -2463,7 +2968,11 @@ NEVER_INLINE void InterpreterSlowPath::getObjectPrecomputedCaseOperation(Executi
     }
 
     if (UNLIKELY(code->m_cacheMissCount == GetObjectInlineCacheData::MaxCacheMissCount)) {
-        registerFile[code->m_storeRegisterIndex] = obj->get(state, ObjectPropertyName(state, propertyName)).value(state, receiver);
+        // this site has seen too many structures. use VM-wide megamorphic cache from now on
+        code->changeOpcode(Opcode::GetObjectPreComputedCaseOpcode);
+        code->m_inlineCacheMode = GetObjectPreComputedCase::Megamorphic;
+        code->m_propertyName = propertyName;
+        registerFile[code->m_storeRegisterIndex] = getObjectPrecomputedCaseMegamorphicOperation(state, obj, receiver, propertyName);
         return;
     }
 
@@ -2618,6 +3127,90 @@ GiveUp:
     // clang-format on
 }
 
+Value InterpreterSlowPath::getObjectPrecomputedCaseMegamorphicOperation(ExecutionState& state, Object* obj, const Value& receiver, const ObjectStructurePropertyName& propertyName)
+{
+    OPCODE_STATS_COUNT_SLOW_PATH();
+    GetObjectMegamorphicCache* cache = state.context()->vmInstance()->getObjectMegamorphicCache();
+    ObjectStructure* const objStructure = obj->structure();
+    GetObjectMegamorphicCache::Entry& entry = cache->entry(objStructure, propertyName);
+
+    if (entry.m_structures[0] == objStructure && entry.m_propertyName == propertyName) {
+        Object* holder = obj;
+        size_t chainIndex = 1;
+        for (; chainIndex < entry.m_chainLength; chainIndex++) {
+            holder = holder->Object::getPrototypeObject(state);
+            if (!holder || holder->structure() != entry.m_structures[chainIndex]) {
+                break;
+            }
+        }
+
+        if (LIKELY(chainIndex == entry.m_chainLength)) {
+            if (LIKELY(entry.m_cachedIndex != GetObjectMegamorphicCache::NotFoundIndex)) {
+                cache->recordHit();
+                ASSERT(holder->structure()->findProperty(propertyName).first == entry.m_cachedIndex);
+                if (LIKELY(entry.m_isPlainDataProperty)) {
+                    return holder->m_values[entry.m_cachedIndex];
+                }
+                return holder->getOwnNonPlainDataPropertyUtilForObject(state, entry.m_cachedIndex, receiver);
+            } else if (!holder->Object::getPrototypeObject(state)) {
+                cache->recordHit();
+                return Value();
+            }
+        }
+    }
+
+    cache->recordMiss();
+
+    // fill the entry if every object on the lookup path is ordinary
+    ObjectStructure* chain[GetObjectMegamorphicCache::MaxChainLength];
+    size_t chainLength = 0;
+    size_t cachedIndex = 0;
+    bool isPlainDataProperty = false;
+    Object* holder = obj;
+    if (UNLIKELY(!obj->isInlineCacheable())) {
+        goto NotCacheable;
+    }
+
+    while (true) {
+        if (UNLIKELY(chainLength == GetObjectMegamorphicCache::MaxChainLength)) {
+            goto NotCacheable;
+        }
+        ObjectStructure* s = holder->structure();
+        chain[chainLength++] = s;
+        auto result = s->findProperty(propertyName);
+        if (result.first != SIZE_MAX) {
+            if (UNLIKELY(result.first >= GetObjectMegamorphicCache::NotFoundIndex)) {
+                goto NotCacheable;
+            }
+            cachedIndex = result.first;
+            isPlainDataProperty = result.second->m_descriptor.isPlainDataProperty();
+            break;
+        }
+
+        holder = holder->Object::getPrototypeObject(state);
+        if (!holder) {
+            cachedIndex = GetObjectMegamorphicCache::NotFoundIndex;
+            break;
+        }
+
+        if (UNLIKELY(!holder->isInlineCacheable())) {
+            goto NotCacheable;
+        }
+    }
+
+    for (size_t i = 0; i < chainLength; i++) {
+        chain[i]->markReferencedByInlineCache();
+        entry.m_structures[i] = chain[i];
+    }
+    entry.m_propertyName = propertyName;
+    entry.m_chainLength = chainLength;
+    entry.m_cachedIndex = cachedIndex;
+    entry.m_isPlainDataProperty = isPlainDataProperty;
+
+NotCacheable:
+    return obj->get(state, ObjectPropertyName(state, propertyName)).value(state, receiver);
+}
+
 ALWAYS_INLINE void InterpreterSlowPath::setObjectPreComputedCaseOperation(ExecutionState& state, const Value& willBeObject, const Value& value, SetObjectPreComputedCase* code, ByteCodeBlock* block)
 {
     Object* obj;
@@ -2644,19 +3237,23 @@ ALWAYS_INLINE void InterpreterSlowPath::setObjectPreComputedCaseOperation(Execut
                 if (testItem == item.m_cachedHiddenClass) {
                     // cache hit!
                     obj->m_values[item.m_cachedIndex] = value;
+                    OPCODE_STATS_COUNT_INLINE_CACHE_HIT(SetObjectPreComputedCase);
                     return;
                 }
             }
         } else if (setObjectPreComputedCaseOperationSlowCase(state, originalObject, willBeObject, value, code, block)) {
+            OPCODE_STATS_COUNT_INLINE_CACHE_HIT(SetObjectPreComputedCase);
             return;
         }
     }
 
+    OPCODE_STATS_COUNT_INLINE_CACHE_MISS(SetObjectPreComputedCase);
     setObjectPreComputedCaseOperationCacheMiss(state, originalObject, willBeObject, value, code, block);
 }
 
 NEVER_INLINE bool InterpreterSlowPath::setObjectPreComputedCaseOperationSlowCase(ExecutionState& state, Object* originalObject, const Value& willBeObject, const Value& value, SetObjectPreComputedCase* code, ByteCodeBlock* block)
 {
+    OPCODE_STATS_COUNT_SLOW_PATH();
     ASSERT(code->m_inlineCacheProtoTraverseMaxIndex > 0);
     ASSERT(code->m_inlineCacheProtoTraverseMaxIndex < SetObjectPreComputedCase::inlineCacheProtoTraverseMaxCount);
 
@@ -2707,6 +3304,7 @@ NEVER_INLINE bool InterpreterSlowPath::setObjectPreComputedCaseOperationSlowCase
 
 NEVER_INLINE void InterpreterSlowPath::setObjectPreComputedCaseOperationCacheMiss(ExecutionState& state, Object* originalObject, const Value& willBeObject, const Value& value, SetObjectPreComputedCase* code, ByteCodeBlock* block)
 {
+    OPCODE_STATS_COUNT_SLOW_PATH();
     if (code->m_isLength && originalObject->isArrayObject()) {
         if (LIKELY(originalObject->asArrayObject()->isFastModeArray())) {
             if (!originalObject->asArrayObject()->setArrayLength(state, value) && state.inStrictMode()) {
@@ -2905,6 +3503,7 @@ GiveUp:
 
 NEVER_INLINE Object* InterpreterSlowPath::fastToObject(ExecutionState& state, const Value& obj)
 {
+    OPCODE_STATS_COUNT_SLOW_PATH();
     if (LIKELY(obj.isString())) {
         StringObject* o = state.context()->globalObject()->stringProxyObject();
         o->setPrimitiveValue(state, obj.asString());
@@ -2919,6 +3518,7 @@ NEVER_INLINE Object* InterpreterSlowPath::fastToObject(ExecutionState& state, co
 
 NEVER_INLINE Value InterpreterSlowPath::getGlobalVariableSlowCase(ExecutionState& state, Object* go, GlobalVariableAccessCacheItem* slot, ByteCodeBlock* block)
 {
+    OPCODE_STATS_COUNT_SLOW_PATH();
     Context* ctx = state.context();
     auto& records = *ctx->globalDeclarativeRecord();
     AtomicString name = slot->m_propertyName;
@@ -2970,6 +3570,7 @@ NEVER_INLINE Value InterpreterSlowPath::getGlobalVariableSlowCase(ExecutionState
 
 NEVER_INLINE void InterpreterSlowPath::setGlobalVariableSlowCase(ExecutionState& state, Object* go, GlobalVariableAccessCacheItem* slot, const Value& value, ByteCodeBlock* block)
 {
+    OPCODE_STATS_COUNT_SLOW_PATH();
     Context* ctx = state.context();
     auto& records = *ctx->globalDeclarativeRecord();
     AtomicString name = slot->m_propertyName;
@@ -3019,6 +3620,7 @@ NEVER_INLINE void InterpreterSlowPath::setGlobalVariableSlowCase(ExecutionState&
 
 NEVER_INLINE void InterpreterSlowPath::initializeGlobalVariable(ExecutionState& state, InitializeGlobalVariable* code, const Value& value)
 {
+    OPCODE_STATS_COUNT_SLOW_PATH();
     Context* ctx = state.context();
     auto& records = *ctx->globalDeclarativeRecord();
     for (size_t i = 0; i < records.size(); i++) {
@@ -3032,6 +3634,7 @@ NEVER_INLINE void InterpreterSlowPath::initializeGlobalVariable(ExecutionState&
 
 NEVER_INLINE void InterpreterSlowPath::createObjectOperation(ExecutionState& state, CreateObject* code, ByteCodeBlock* byteCodeBlock, Value* registerFile)
 {
+    OPCODE_STATS_COUNT_SLOW_PATH();
     if (code->m_dataRegisterIndex != REGISTER_LIMIT) {
         CreateObjectPrepare::CreateObjectData* data;
         if (byteCodeBlock->codeBlock()->isAsyncOrGenerator()) {
@@ -3091,6 +3694,7 @@ static Value createObjectPropertyFunctionName(ExecutionState& state, const Value
 
 NEVER_INLINE void InterpreterSlowPath::createObjectPrepareOperation(ExecutionState& state, CreateObjectPrepare* code, ByteCodeBlock* byteCodeBlock, Value* registerFile)
 {
+    OPCODE_STATS_COUNT_SLOW_PATH();
     if (code->m_stage == CreateObjectPrepare::Init) {
         void* ptr;
         if (byteCodeBlock->codeBlock()->isAsyncOrGenerator()) {
@@ -3207,11 +3811,13 @@ NEVER_INLINE void InterpreterSlowPath::createObjectPrepareOperation(ExecutionSta
 
 NEVER_INLINE void InterpreterSlowPath::createArrayOperation(ExecutionState& state, CreateArray* code, ByteCodeBlock* byteCodeBlock, Value* registerFile)
 {
+    OPCODE_STATS_COUNT_SLOW_PATH();
     registerFile[code->m_registerIndex] = new ArrayObject(state, (uint64_t)code->m_length);
 }
 
 NEVER_INLINE void InterpreterSlowPath::createFunctionOperation(ExecutionState& state, CreateFunction* code, ByteCodeBlock* byteCodeBlock, Value* registerFile)
 {
+    OPCODE_STATS_COUNT_SLOW_PATH();
     InterpretedCodeBlock* cb = code->m_codeBlock;
 
     LexicalEnvironment* outerLexicalEnvironment = state.mostNearestHeapAllocatedLexicalEnvironment().unwrap();
@@ -3252,6 +3858,7 @@ NEVER_INLINE void InterpreterSlowPath::createFunctionOperation(ExecutionState& s
 
 NEVER_INLINE ArrayObject* InterpreterSlowPath::createRestElementOperation(ExecutionState& state, ByteCodeBlock* byteCodeBlock)
 {
+    OPCODE_STATS_COUNT_SLOW_PATH();
     ASSERT(state.resolveCallee());
 
     ArrayObject* newArray;
@@ -3274,6 +3881,7 @@ NEVER_INLINE ArrayObject* InterpreterSlowPath::createRestElementOperation(Execut
 
 NEVER_INLINE Value InterpreterSlowPath::tryOperation(ExecutionState*& state, size_t& programCounter, ByteCodeBlock* byteCodeBlock, Value* registerFile)
 {
+    OPCODE_STATS_COUNT_SLOW_PATH();
     uint8_t* codeBuffer = byteCodeBlock->m_code.data();
     TryOperation* code = (TryOperation*)programCounter;
 
@@ -3517,6 +4125,7 @@ NEVER_INLINE Value InterpreterSlowPath::tryOperation(ExecutionState*& state, siz
 
 NEVER_INLINE void InterpreterSlowPath::initializeClassOperation(ExecutionState& state, InitializeClass* code, Value* registerFile)
 {
+    OPCODE_STATS_COUNT_SLOW_PATH();
     if (code->m_stage == InitializeClass::CreateClass) {
         Value protoParent;
         Value constructorParent;
@@ -3665,6 +4274,7 @@ NEVER_INLINE void InterpreterSlowPath::initializeClassOperation(ExecutionState&
 
 NEVER_INLINE void InterpreterSlowPath::superOperation(ExecutionState& state, SuperReference* code, Value* registerFile)
 {
+    OPCODE_STATS_COUNT_SLOW_PATH();
     if (code->m_isCall) {
         // Let newTarget be GetNewTarget().
         Object* newTarget = state.getNewTarget();
@@ -3680,6 +4290,7 @@ NEVER_INLINE void InterpreterSlowPath::superOperation(ExecutionState& state, Sup
 
 NEVER_INLINE void InterpreterSlowPath::complexSetObjectOperation(ExecutionState& state, ComplexSetObjectOperation* code, Value* registerFile, ByteCodeBlock* byteCodeBlock)
 {
+    OPCODE_STATS_COUNT_SLOW_PATH();
     if (code->m_type == ComplexSetObjectOperation::Super) {
         // find `this` value for receiver
         Value thisValue(Value::ForceUninitialized);
@@ -3717,6 +4328,7 @@ NEVER_INLINE void InterpreterSlowPath::complexSetObjectOperation(ExecutionState&
 
 NEVER_INLINE void InterpreterSlowPath::complexGetObjectOperation(ExecutionState& state, ComplexGetObjectOperation* code, Value* registerFile, ByteCodeBlock* byteCodeBlock)
 {
+    OPCODE_STATS_COUNT_SLOW_PATH();
     if (code->m_type == ComplexGetObjectOperation::Super) {
         // find `this` value for receiver
         Value thisValue(Value::ForceUninitialized);
@@ -3740,6 +4352,7 @@ NEVER_INLINE void InterpreterSlowPath::complexGetObjectOperation(ExecutionState&
 
 NEVER_INLINE Value InterpreterSlowPath::openLexicalEnvironment(ExecutionState*& state, size_t& programCounter, ByteCodeBlock* byteCodeBlock, Value* registerFile)
 {
+    OPCODE_STATS_COUNT_SLOW_PATH();
     OpenLexicalEnvironment* code = (OpenLexicalEnvironment*)programCounter;
     bool inWithStatement = code->m_kind == OpenLexicalEnvironment::WithStatement;
 
@@ -3817,6 +4430,7 @@ NEVER_INLINE Value InterpreterSlowPath::openLexicalEnvironment(ExecutionState*&
 
 NEVER_INLINE void InterpreterSlowPath::replaceBlockLexicalEnvironmentOperation(ExecutionState& state, size_t programCounter, ByteCodeBlock* byteCodeBlock)
 {
+    OPCODE_STATS_COUNT_SLOW_PATH();
     ReplaceBlockLexicalEnvironmentOperation* code = (ReplaceBlockLexicalEnvironmentOperation*)programCounter;
     // setup new env
     EnvironmentRecord* newRecord;
@@ -3844,6 +4458,7 @@ NEVER_INLINE void InterpreterSlowPath::replaceBlockLexicalEnvironmentOperation(E
 
 NEVER_INLINE Value InterpreterSlowPath::blockOperation(ExecutionState*& state, BlockOperation* code, size_t& programCounter, ByteCodeBlock* byteCodeBlock, Value* registerFile)
 {
+    OPCODE_STATS_COUNT_SLOW_PATH();
     state->rareData()->ensureControlFlowRecordVector()->push_back(nullptr);
     size_t newPc = programCounter + sizeof(BlockOperation);
     uint8_t* codeBuffer = byteCodeBlock->m_code.data();
@@ -3937,6 +4552,7 @@ NEVER_INLINE Value InterpreterSlowPath::blockOperation(ExecutionState*& state, B
 
 NEVER_INLINE void InterpreterSlowPath::binaryInOperation(ExecutionState& state, BinaryInOperation* code, Value* registerFile)
 {
+    OPCODE_STATS_COUNT_SLOW_PATH();
     const Value& left = registerFile[code->m_srcIndex0];
     const Value& right = registerFile[code->m_srcIndex1];
     if (!right.isObject()) {
@@ -3952,6 +4568,7 @@ NEVER_INLINE void InterpreterSlowPath::binaryInOperation(ExecutionState& state,
 
 NEVER_INLINE Value InterpreterSlowPath::constructOperation(ExecutionState& state, const Value& constructor, const size_t argc, Value* argv)
 {
+    OPCODE_STATS_COUNT_SLOW_PATH();
     if (!constructor.isConstructor()) {
         if (constructor.isFunction()) {
             ErrorObject::throwBuiltinError(state, ErrorCode::TypeError, ErrorObject::Messages::Not_Constructor_Function, constructor.asFunction()->codeBlock()->functionName());
@@ -4002,6 +4619,7 @@ static Value callDynamicImportRejected(ExecutionState& state, Value thisValue, s
 
 NEVER_INLINE void InterpreterSlowPath::callFunctionComplexCase(ExecutionState& state, CallComplexCase* code, Value* registerFile, ByteCodeBlock* byteCodeBlock)
 {
+    OPCODE_STATS_COUNT_SLOW_PATH();
     switch (code->m_kind) {
     case CallComplexCase::InWithScope: {
         const AtomicString& calleeName = code->m_calleeName;
@@ -4252,6 +4870,7 @@ NEVER_INLINE void InterpreterSlowPath::callFunctionComplexCase(ExecutionState& s
 
 NEVER_INLINE void InterpreterSlowPath::spreadFunctionArguments(ExecutionState& state, const Value* argv, const size_t argc, ValueVector& argVector)
 {
+    OPCODE_STATS_COUNT_SLOW_PATH();
     for (size_t i = 0; i < argc; i++) {
         Value arg = argv[i];
         if (arg.isObject() && arg.asObject()->isSpreadArray()) {
@@ -4268,6 +4887,7 @@ NEVER_INLINE void InterpreterSlowPath::spreadFunctionArguments(ExecutionState& s
 
 NEVER_INLINE void InterpreterSlowPath::createEnumerateObject(ExecutionState& state, CreateEnumerateObject* code, Value* registerFile)
 {
+    OPCODE_STATS_COUNT_SLOW_PATH();
     Object* obj = registerFile[code->m_objectRegisterIndex].toObject(state);
     bool isDestruction = code->m_isDestruction;
 
@@ -4282,6 +4902,7 @@ NEVER_INLINE void InterpreterSlowPath::createEnumerateObject(ExecutionState& sta
 
 NEVER_INLINE void InterpreterSlowPath::checkLastEnumerateKey(ExecutionState& state, CheckLastEnumerateKey* code, uint8_t* codeBuffer, size_t& programCounter, Value* registerFile)
 {
+    OPCODE_STATS_COUNT_SLOW_PATH();
     EnumerateObject* data = (EnumerateObject*)registerFile[code->m_registerIndex].asPointerValue();
     if (data->checkLastEnumerateKey(state)) {
         delete data;
@@ -4293,6 +4914,7 @@ NEVER_INLINE void InterpreterSlowPath::checkLastEnumerateKey(ExecutionState& sta
 
 NEVER_INLINE void InterpreterSlowPath::markEnumerateKey(ExecutionState& state, MarkEnumerateKey* code, Value* registerFile)
 {
+    OPCODE_STATS_COUNT_SLOW_PATH();
     EnumerateObject* data = (EnumerateObject*)registerFile[code->m_dataRegisterIndex].asPointerValue();
     Value key = registerFile[code->m_keyRegisterIndex];
     bool mark = false;
@@ -4314,6 +4936,7 @@ NEVER_INLINE void InterpreterSlowPath::markEnumerateKey(ExecutionState& state, M
 
 NEVER_INLINE void InterpreterSlowPath::executionPauseOperation(ExecutionState& state, Value* registerFile, size_t& programCounter, uint8_t* codeBuffer)
 {
+    OPCODE_STATS_COUNT_SLOW_PATH();
     ExecutionPause* code = (ExecutionPause*)programCounter;
     if (code->m_reason == ExecutionPause::Yield) {
         // http://www.ecma-international.org/ecma-262/6.0/#sec-generator-function-definitions-runtime-semantics-evaluation
@@ -4346,6 +4969,7 @@ NEVER_INLINE void InterpreterSlowPath::executionPauseOperation(ExecutionState& s
 
 NEVER_INLINE Value InterpreterSlowPath::executionResumeOperation(ExecutionState*& state, size_t& programCounter, ByteCodeBlock* byteCodeBlock)
 {
+    OPCODE_STATS_COUNT_SLOW_PATH();
     ExecutionResume* code = (ExecutionResume*)programCounter;
 
     bool needsReturn = code->m_needsReturn;
@@ -4410,6 +5034,7 @@ NEVER_INLINE Value InterpreterSlowPath::executionResumeOperation(ExecutionState*
 
 NEVER_INLINE void InterpreterSlowPath::metaPropertyOperation(ExecutionState& state, MetaPropertyOperation* code, ByteCodeBlock* byteCodeBlock, Value* registerFile)
 {
+    OPCODE_STATS_COUNT_SLOW_PATH();
     if (code->m_type == MetaPropertyOperation::NewTarget) {
         auto newTarget = state.getNewTarget();
         if (newTarget) {
@@ -4427,6 +5052,7 @@ NEVER_INLINE void InterpreterSlowPath::metaPropertyOperation(ExecutionState& sta
 
 NEVER_INLINE void InterpreterSlowPath::objectDefineOwnPropertyOperation(ExecutionState& state, ObjectDefineOwnPropertyOperation* code, Value* registerFile)
 {
+    OPCODE_STATS_COUNT_SLOW_PATH();
     const Value& willBeObject = registerFile[code->m_objectRegisterIndex];
     const Value& property = registerFile[code->m_propertyRegisterIndex];
     const Value& value = registerFile[code->m_loadRegisterIndex];
@@ -4444,6 +5070,7 @@ NEVER_INLINE void InterpreterSlowPath::objectDefineOwnPropertyOperation(Executio
 
 NEVER_INLINE void InterpreterSlowPath::objectDefineOwnPropertyWithNameOperation(ExecutionState& state, ObjectDefineOwnPropertyWithNameOperation* code, ByteCodeBlock* byteCodeBlock, Value* registerFile)
 {
+    OPCODE_STATS_COUNT_SLOW_PATH();
     Object* object = registerFile[code->m_objectRegisterIndex].asObject();
     const Value& v = registerFile[code->m_loadRegisterIndex];
     // http://www.ecma-international.org/ecma-262/6.0/#sec-__proto__-property-names-in-object-initializers
@@ -4486,6 +5113,7 @@ NEVER_INLINE void InterpreterSlowPath::objectDefineOwnPropertyWithNameOperation(
 
 NEVER_INLINE void InterpreterSlowPath::arrayDefineOwnPropertyOperation(ExecutionState& state, ArrayDefineOwnPropertyOperation* code, Value* registerFile)
 {
+    OPCODE_STATS_COUNT_SLOW_PATH();
     ArrayObject* arr = registerFile[code->m_objectRegisterIndex].asObject()->asArrayObject();
     if (LIKELY(arr->isFastModeArray())) {
         for (size_t i = 0; i < code->m_count; i++) {
@@ -4505,6 +5133,7 @@ NEVER_INLINE void InterpreterSlowPath::arrayDefineOwnPropertyOperation(Execution
 
 NEVER_INLINE void InterpreterSlowPath::arrayDefineOwnPropertyBySpreadElementOperation(ExecutionState& state, ArrayDefineOwnPropertyBySpreadElementOperation* code, Value* registerFile)
 {
+    OPCODE_STATS_COUNT_SLOW_PATH();
     ArrayObject* arr = registerFile[code->m_objectRegisterIndex].asObject()->asArrayObject();
 
     if (LIKELY(arr->isFastModeArray())) {
@@ -4580,6 +5209,7 @@ NEVER_INLINE void InterpreterSlowPath::arrayDefineOwnPropertyBySpreadElementOper
 
 NEVER_INLINE void InterpreterSlowPath::createSpreadArrayObject(ExecutionState& state, CreateSpreadArrayObject* code, Value* registerFile)
 {
+    OPCODE_STATS_COUNT_SLOW_PATH();
     ArrayObject* spreadArray = ArrayObject::createSpreadArray(state);
     ASSERT(spreadArray->isFastModeArray());
 
@@ -4598,6 +5228,7 @@ NEVER_INLINE void InterpreterSlowPath::createSpreadArrayObject(ExecutionState& s
 
 NEVER_INLINE void InterpreterSlowPath::updateObjectGetterSetterFunctionName(ExecutionState& state, FunctionObject* fn, Value propertyName, bool isGetter)
 {
+    OPCODE_STATS_COUNT_SLOW_PATH();
     Value fnName;
     if (isGetter) {
         fnName = createObjectPropertyFunctionName(state, propertyName, "get ");
@@ -4609,6 +5240,7 @@ NEVER_INLINE void InterpreterSlowPath::updateObjectGetterSetterFunctionName(Exec
 
 NEVER_INLINE void InterpreterSlowPath::defineObjectGetterSetterOperation(ExecutionState& state, ObjectDefineGetterSetter* code, ByteCodeBlock* byteCodeBlock, Value* registerFile, Object* object)
 {
+    OPCODE_STATS_COUNT_SLOW_PATH();
     FunctionObject* fn = registerFile[code->m_objectPropertyValueRegisterIndex].asFunction();
     Value pName = code->m_objectPropertyNameRegisterIndex == REGISTER_LIMIT ? fn->codeBlock()->functionName().string() : registerFile[code->m_objectPropertyNameRegisterIndex];
     updateObjectGetterSetterFunctionName(state, fn, pName, code->m_isGetter);
@@ -4624,6 +5256,7 @@ NEVER_INLINE void InterpreterSlowPath::defineObjectGetterSetterOperation(Executi
 
 NEVER_INLINE void InterpreterSlowPath::defineObjectGetterSetter(ExecutionState& state, ObjectDefineGetterSetter* code, ByteCodeBlock* byteCodeBlock, Value* registerFile)
 {
+    OPCODE_STATS_COUNT_SLOW_PATH();
     Object* object = registerFile[code->m_objectRegisterIndex].toObject(state);
     const size_t minCacheFillCount = 2;
     if (object->structure() == code->m_inlineCachedStructureBefore) {
@@ -4682,6 +5315,7 @@ ALWAYS_INLINE Value InterpreterSlowPath::incrementOperation(ExecutionState& stat
 
 NEVER_INLINE Value InterpreterSlowPath::incrementOperationSlowCase(ExecutionState& state, const Value& value)
 {
+    OPCODE_STATS_COUNT_SLOW_PATH();
     // https://www.ecma-international.org/ecma-262/#sec-postfix-increment-operator
     // https://www.ecma-international.org/ecma-262/#sec-prefix-increment-operator
     auto newVal = value.toNumeric(state);
@@ -4711,6 +5345,7 @@ ALWAYS_INLINE Value InterpreterSlowPath::decrementOperation(ExecutionState& stat
 
 NEVER_INLINE Value InterpreterSlowPath::decrementOperationSlowCase(ExecutionState& state, const Value& value)
 {
+    OPCODE_STATS_COUNT_SLOW_PATH();
     // https://www.ecma-international.org/ecma-262/#sec-postfix-decrement-operator
     // https://www.ecma-international.org/ecma-262/#sec-prefix-decrement-operator
     auto newVal = value.toNumeric(state);
@@ -4721,8 +5356,36 @@ NEVER_INLINE Value InterpreterSlowPath::decrementOperationSlowCase(ExecutionStat
     }
 }
 
+#if !defined(ESCARGOT_SMALL_CONFIG)
+ALWAYS_INLINE void InterpreterSlowPath::profileOperandType(ByteCode* code, uint16_t& profile, bool isInt32, Opcode int32Opcode, Opcode doubleOpcode)
+{
+    if (LIKELY(!(profile & ByteCodeQuickening::Disabled))) {
+        profile = (profile + 1) | (isInt32 ? ByteCodeQuickening::SeenInt32 : ByteCodeQuickening::SeenDouble);
+        if (UNLIKELY((profile & ByteCodeQuickening::CountMask) == ByteCodeQuickening::Threshold)) {
+            quickenByteCode(code, profile, int32Opcode, doubleOpcode);
+        }
+    }
+}
+
+NEVER_INLINE void InterpreterSlowPath::quickenByteCode(ByteCode* code, uint16_t& profile, Opcode int32Opcode, Opcode doubleOpcode)
+{
+    OPCODE_STATS_COUNT_SLOW_PATH();
+    // doubleOpcode is EndOpcode if the bytecode has no double variant
+    // (SeenDouble of relational bytecodes also covers operands which are not numbers)
+    const uint16_t seen = profile & (ByteCodeQuickening::SeenInt32 | ByteCodeQuickening::SeenDouble);
+    if (seen == ByteCodeQuickening::SeenInt32) {
+        code->changeOpcode(int32Opcode);
+    } else if (seen == ByteCodeQuickening::SeenDouble && doubleOpcode != EndOpcode) {
+        code->changeOpcode(doubleOpcode);
+    } else {
+        profile = ByteCodeQuickening::Disabled;
+    }
+}
+#endif
+
 NEVER_INLINE void InterpreterSlowPath::unaryTypeof(ExecutionState& state, UnaryTypeof* code, Value* registerFile)
 {
+    OPCODE_STATS_COUNT_SLOW_PATH();
     Value val;
     if (code->m_id.string()->length()) {
         val = loadByName(state, state.lexicalEnvironment(), code->m_id, false);
@@ -4765,6 +5428,7 @@ NEVER_INLINE void InterpreterSlowPath::unaryTypeof(ExecutionState& state, UnaryT
 
 NEVER_INLINE void InterpreterSlowPath::iteratorOperation(ExecutionState& state, size_t& programCounter, Value* registerFile, uint8_t* codeBuffer)
 {
+    OPCODE_STATS_COUNT_SLOW_PATH();
     IteratorOperation* code = (IteratorOperation*)programCounter;
     if (code->m_operation == IteratorOperation::Operation::GetIterator) {
         const Value& obj = registerFile[code->m_getIteratorData.m_srcObjectRegisterIndex];
@@ -4879,12 +5543,14 @@ NEVER_INLINE void InterpreterSlowPath::iteratorOperation(ExecutionState& state,
 
 NEVER_INLINE void InterpreterSlowPath::getMethodOperation(ExecutionState& state, size_t programCounter, Value* registerFile)
 {
+    OPCODE_STATS_COUNT_SLOW_PATH();
     GetMethod* code = (GetMethod*)programCounter;
     registerFile[code->m_resultRegisterIndex] = Object::getMethod(state, registerFile[code->m_objectRegisterIndex], code->m_propertyName);
 }
 
 NEVER_INLINE Object* InterpreterSlowPath::restBindOperation(ExecutionState& state, IteratorRecord* iteratorRecord)
 {
+    OPCODE_STATS_COUNT_SLOW_PATH();
     auto strings = &state.context()->staticStrings();
 
     Object* result = new ArrayObject(state);
@@ -4927,6 +5593,7 @@ NEVER_INLINE Object* InterpreterSlowPath::restBindOperation(ExecutionState& stat
 
 NEVER_INLINE void InterpreterSlowPath::taggedTemplateOperation(ExecutionState& state, size_t& programCounter, Value* registerFile, uint8_t* codeBuffer, ByteCodeBlock* byteCodeBlock)
 {
+    OPCODE_STATS_COUNT_SLOW_PATH();
     TaggedTemplateOperation* code = (TaggedTemplateOperation*)programCounter;
     InterpretedCodeBlock* cb = byteCodeBlock->m_codeBlock;
     auto& cache = cb->taggedTemplateLiteralCache();
@@ -4948,27 +5615,39 @@ NEVER_INLINE void InterpreterSlowPath::taggedTemplateOperation(ExecutionState& s
     }
 }
 
-NEVER_INLINE void InterpreterSlowPath::getObjectOpcodeSlowCase(ExecutionState& state, GetObject* code, Value* registerFile)
+NEVER_INLINE void InterpreterSlowPath::getObjectOpcodeSlowCase(ExecutionState& state, GetObject* code, Value* registerFile, ByteCodeBlock* block)
 {
+    OPCODE_STATS_COUNT_SLOW_PATH();
     const Value& willBeObject = registerFile[code->m_objectRegisterIndex];
     const Value& property = registerFile[code->m_propertyRegisterIndex];
     Object* obj;
     if (LIKELY(willBeObject.isObject())) {
         obj = willBeObject.asObject();
+#if !defined(ESCARGOT_SMALL_CONFIG)
+        if (!obj->hasArrayObjectTag()) {
+            updateKeyedInlineCache(state, code->m_inlineCache, obj, property, false, block);
+        }
+#endif
     } else {
         obj = fastToObject(state, willBeObject);
     }
     registerFile[code->m_storeRegisterIndex] = obj->getIndexedPropertyValue(state, property, willBeObject);
 }
 
-NEVER_INLINE void InterpreterSlowPath::setObjectOpcodeSlowCase(ExecutionState& state, SetObjectOperation* code, Value* registerFile)
+NEVER_INLINE void InterpreterSlowPath::setObjectOpcodeSlowCase(ExecutionState& state, SetObjectOperation* code, Value* registerFile, ByteCodeBlock* block)
 {
+    OPCODE_STATS_COUNT_SLOW_PATH();
     const Value& willBeObject = registerFile[code->m_objectRegisterIndex];
     const Value& property = registerFile[code->m_propertyRegisterIndex];
     Object* obj = willBeObject.toObject(state);
     if (willBeObject.isPrimitive()) {
         obj->preventExtensions(state);
     } else {
+#if !defined(ESCARGOT_SMALL_CONFIG)
+        if (!obj->hasArrayObjectTag()) {
+            updateKeyedInlineCache(state, code->m_inlineCache, obj, property, true, block);
+        }
+#endif
         obj->markThisObjectDontNeedStructureTransitionTable();
     }
     bool result = obj->setIndexedProperty(state, property, registerFile[code->m_loadRegisterIndex]);
@@ -4978,8 +5657,150 @@ NEVER_INLINE void InterpreterSlowPath::setObjectOpcodeSlowCase(ExecutionState& s
     }
 }
 
+// atomic string or symbol of a keyed access without looking at the string content
+// returns nullptr if the string is not linked to an atomic string yet
+static ALWAYS_INLINE PointerValue* keyedInlineCacheKey(const Value& property)
+{
+    if (property.isString()) {
+        size_t v = property.asString()->getTypeTag();
+        if (v > POINTER_VALUE_STRING_TAG_IN_DATA) {
+            return (String*)(v & ~POINTER_VALUE_STRING_TAG_IN_DATA);
+        }
+    } else if (property.isSymbol()) {
+        return property.asSymbol();
+    }
+    return nullptr;
+}
+
+ALWAYS_INLINE bool InterpreterSlowPath::getObjectByKeyedInlineCache(ExecutionState& state, KeyedInlineCacheData* inlineCache, Object* obj, const Value& property, Value& result)
+{
+    if (property.isString() || property.isSymbol()) {
+        ObjectStructure* const objStructure = obj->structure();
+        PointerValue* const key = keyedInlineCacheKey(property);
+        for (size_t i = 0; i < KeyedInlineCacheData::inlineBufferSize; i++) {
+            if (inlineCache->m_cachedStructures[i] == objStructure && inlineCache->m_cachedKeys[i] == key) {
+                ASSERT(objStructure->findProperty(ObjectStructurePropertyName(state, property)).first == inlineCache->m_cachedIndexes[i]);
+                result = obj->m_values[inlineCache->m_cachedIndexes[i]];
+                return true;
+            }
+        }
+    } else if (obj->getVTag() == inlineCache->m_typedArrayTag && property.isUInt32()) {
+        ArrayBufferView* view = reinterpret_cast<TypedArrayObject*>(obj);
+        const TypedArrayType type = inlineCache->m_typedArrayType;
+        ASSERT(obj->isTypedArrayObject() && obj->asTypedArrayObject()->typedArrayType() == type);
+        const uint32_t idx = property.asUInt32();
+        uint8_t* buffer = view->rawBuffer();
+        if (LIKELY(idx < view->arrayLength() && buffer && !view->buffer()->isDetachedBuffer())) {
+            result = TypedArrayHelper::rawBytesToNumber(state, type, buffer + idx * TypedArrayHelper::elementSize(type));
+            return true;
+        }
+    }
+    return false;
+}
+
+ALWAYS_INLINE bool InterpreterSlowPath::setObjectByKeyedInlineCache(ExecutionState& state, KeyedInlineCacheData* inlineCache, Object* obj, const Value& property, const Value& value)
+{
+    if (property.isString() || property.isSymbol()) {
+        ObjectStructure* const objStructure = obj->structure();
+        PointerValue* const key = keyedInlineCacheKey(property);
+        for (size_t i = 0; i < KeyedInlineCacheData::inlineBufferSize; i++) {
+            if (inlineCache->m_cachedStructures[i] == objStructure && inlineCache->m_cachedKeys[i] == key) {
+                ASSERT(objStructure->findProperty(ObjectStructurePropertyName(state, property)).first == inlineCache->m_cachedIndexes[i]);
+                ASSERT(objStructure->readProperty(inlineCache->m_cachedIndexes[i]).m_descriptor.isWritable());
+                obj->m_values[inlineCache->m_cachedIndexes[i]] = value;
+                return true;
+            }
+        }
+    } else if (obj->getVTag() == inlineCache->m_typedArrayTag && property.isUInt32() && value.isNumber()) {
+        // converting number never calls user code so buffer cannot be detached while storing
+        ArrayBufferView* view = reinterpret_cast<TypedArrayObject*>(obj);
+        const TypedArrayType type = inlineCache->m_typedArrayType;
+        ASSERT(obj->isTypedArrayObject() && obj->asTypedArrayObject()->typedArrayType() == type);
+        const uint32_t idx = property.asUInt32();
+        uint8_t* buffer = view->rawBuffer();
+        if (LIKELY(idx < view->arrayLength() && buffer && !view->buffer()->isDetachedBuffer())) {
+            TypedArrayHelper::numberToRawBytes(state, type, value, buffer + idx * TypedArrayHelper::elementSize(type));
+            return true;
+        }
+    }
+    return false;
+}
+
+NEVER_INLINE void InterpreterSlowPath::updateKeyedInlineCache(ExecutionState& state, KeyedInlineCacheData*& inlineCache, Object* obj, const Value& property, bool isStore, ByteCodeBlock* block)
+{
+    OPCODE_STATS_COUNT_SLOW_PATH();
+    if (inlineCache && inlineCache->m_cacheMissCount > KeyedInlineCacheData::MaxCacheMissCount) {
+        return;
+    }
+
+    bool isTypedArray = obj->isTypedArrayObject();
+    TypedArrayType typedArrayType = TypedArrayType::Int8;
+    if (isTypedArray) {
+        // BigInt element needs allocation anyway
+        typedArrayType = obj->asTypedArrayObject()->typedArrayType();
+        if (!property.isUInt32() || typedArrayType == TypedArrayType::BigInt64 || typedArrayType == TypedArrayType::BigUint64) {
+            return;
+        }
+    } else if (!(property.isString() || property.isSymbol()) || !obj->isInlineCacheable()) {
+        return;
+    }
+
+    if (!inlineCache) {
+        inlineCache = new KeyedInlineCacheData();
+        block->m_otherLiteralData.push_back(inlineCache);
+        block->m_inlineCacheDataSize += sizeof(KeyedInlineCacheData);
+        state.context()->vmInstance()->compiledByteCodeSize() += sizeof(KeyedInlineCacheData);
+    }
+    inlineCache->m_cacheMissCount++;
+
+    if (isTypedArray) {
+        inlineCache->m_typedArrayTag = obj->getVTag();
+        inlineCache->m_typedArrayType = typedArrayType;
+        return;
+    }
+
+    ObjectStructurePropertyName propertyName(state, property);
+    PointerValue* key;
+    if (propertyName.hasAtomicString()) {
+        // index-like keys could have special meaning on exotic objects
+        if (propertyName.isIndexString()) {
+            return;
+        }
+        key = propertyName.plainString();
+    } else if (propertyName.isSymbol()) {
+        key = propertyName.symbol();
+    } else {
+        return;
+    }
+    if (keyedInlineCacheKey(property) != key) {
+        // string is not linked to its atomic string (e.g. single character), so it cannot hit
+        return;
+    }
+
+    ObjectStructure* objStructure = obj->structure();
+    auto findResult = objStructure->findProperty(propertyName);
+    if (findResult.first == SIZE_MAX || findResult.first >= KeyedInlineCacheData::CachedIndexMax) {
+        return;
+    }
+    const auto& desc = findResult.second->m_descriptor;
+    if (!desc.isPlainDataProperty() || (isStore && !desc.isWritable())) {
+        return;
+    }
+
+    objStructure->markReferencedByInlineCache();
+    for (size_t i = KeyedInlineCacheData::inlineBufferSize - 1; i > 0; i--) {
+        inlineCache->m_cachedStructures[i] = inlineCache->m_cachedStructures[i - 1];
+        inlineCache->m_cachedKeys[i] = inlineCache->m_cachedKeys[i - 1];
+        inlineCache->m_cachedIndexes[i] = inlineCache->m_cachedIndexes[i - 1];
+    }
+    inlineCache->m_cachedStructures[0] = objStructure;
+    inlineCache->m_cachedKeys[0] = key;
+    inlineCache->m_cachedIndexes[0] = findResult.first;
+}
+
 NEVER_INLINE void InterpreterSlowPath::ensureArgumentsObjectOperation(ExecutionState& state, ByteCodeBlock* byteCodeBlock, Value* registerFile)
 {
+    OPCODE_STATS_COUNT_SLOW_PATH();
     FunctionEnvironmentRecord* funcRecord = nullptr;
     ScriptFunctionObject* funcObject = nullptr;
 
@@ -5002,6 +5823,7 @@ NEVER_INLINE void InterpreterSlowPath::ensureArgumentsObjectOperation(ExecutionS
 
 NEVER_INLINE int InterpreterSlowPath::evaluateImportAssertionOperation(ExecutionState& state, const Value& options)
 {
+    OPCODE_STATS_COUNT_SLOW_PATH();
     if (options.isUndefined()) {
         return Platform::ModuleES;
     }
@@ -5060,6 +5882,7 @@ NEVER_INLINE int InterpreterSlowPath::evaluateImportAssertionOperation(Execution
 #if defined(ENABLE_TCO)
 NEVER_INLINE Value InterpreterSlowPath::tailRecursionSlowCase(ExecutionState& state, TailRecursion* code, ByteCodeBlock* byteCodeBlock, const Value& callee, Value* registerFile)
 {
+    OPCODE_STATS_COUNT_SLOW_PATH();
     // fail to tail recursion
     // fix the caller's call site to TailCall
     code->changeOpcode(Opcode::TailCallOpcode);
@@ -5078,6 +5901,7 @@ NEVER_INLINE Value InterpreterSlowPath::tailRecursionSlowCase(ExecutionState& st
 
 NEVER_INLINE Value InterpreterSlowPath::prepareTailCallOptimization(ExecutionState*& state, TailCall* code, ScriptFunctionObject* callee, ByteCodeBlock*& callerByteBlock, size_t& programCounter, const Value* registerFile)
 {
+    OPCODE_STATS_COUNT_SLOW_PATH();
     ASSERT(!callee->isScriptArrowFunctionObject() && !!callerByteBlock);
     ASSERT(state->m_programCounter == &programCounter);
     ASSERT(Interpreter::tcoBuffer);
@@ -5180,6 +6004,7 @@ NEVER_INLINE Value InterpreterSlowPath::prepareTailCallOptimization(ExecutionSta
 
 NEVER_INLINE Value InterpreterSlowPath::tailCallSlowCase(ExecutionState& state, TailCall* code, const Value& callee, Value* registerFile)
 {
+    OPCODE_STATS_COUNT_SLOW_PATH();
     // fail to tail Call
     // convert to CallReturn
     code->changeOpcode(Opcode::CallReturnOpcode);
@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) 2024-present Samsung Electronics Co., Ltd
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+ *  USA
+ */
+
+#ifndef __EscargotGetObjectMegamorphicCache__
+#define __EscargotGetObjectMegamorphicCache__
+
+#include "runtime/ObjectStructurePropertyName.h"
+
+namespace Escargot {
+
+class ObjectStructure;
+
+// VM-wide stub cache shared by every GetObjectPreComputedCase site that went megamorphic
+// An entry is keyed by (receiver structure, property name) and remembers where the property was found
+// Entries do not keep structures alive. the cache is cleared at the end of every GC
+// so that a stale entry can never match a structure allocated at the same address
+class GetObjectMegamorphicCache {
+public:
+    enum : size_t { CacheSize = 1024 };
+    // receiver + 3 prototypes covers plain objects and common class hierarchies
+    enum : size_t { MaxChainLength = 4 };
+    enum : uint16_t { NotFoundIndex = std::numeric_limits<uint16_t>::max() };
+
+    struct Entry {
+        // structures of receiver and its prototypes. the property is found on the last one
+        ObjectStructure* m_structures[MaxChainLength];
+        ObjectStructurePropertyName m_propertyName;
+        uint16_t m_cachedIndex;
+        uint8_t m_chainLength;
+        bool m_isPlainDataProperty;
+    };
+
+    GetObjectMegamorphicCache()
+        : m_hitCount(0)
+        , m_missCount(0)
+    {
+        clear();
+    }
+
+    Entry& entry(ObjectStructure* structure, const ObjectStructurePropertyName& propertyName)
+    {
+        size_t h = (reinterpret_cast<size_t>(structure) >> 3) ^ (propertyName.hashValue() >> 2) * 31;
+        h ^= h >> 11;
+        return m_entries[h & (CacheSize - 1)];
+    }
+
+    void clear()
+    {
+        // entry with null receiver structure never matches
+        for (size_t i = 0; i < CacheSize; i++) {
+            m_entries[i].m_structures[0] = nullptr;
+        }
+    }
+
+    size_t hitCount() const
+    {
+        return m_hitCount;
+    }
+
+    size_t missCount() const
+    {
+        return m_missCount;
+    }
+
+    void recordHit()
+    {
+        m_hitCount++;
+    }
+
+    void recordMiss()
+    {
+        m_missCount++;
+    }
+
+private:
+    size_t m_hitCount;
+    size_t m_missCount;
+    Entry m_entries[CacheSize];
+};
+
+} // namespace Escargot
+
+#endif
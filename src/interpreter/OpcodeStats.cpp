@@ -0,0 +1,130 @@
+/*
+ * Copyright (c) 2024-present Samsung Electronics Co., Ltd
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+ *  USA
+ */
+
+#include "Escargot.h"
+#include "OpcodeStats.h"
+
+#if defined(ENABLE_OPCODE_STATS)
+
+namespace Escargot {
+
+size_t OpcodeStats::g_opcodeCounts[OpcodeKindEnd];
+size_t OpcodeStats::g_inlineCacheHitCounts[InlineCacheKindEnd];
+size_t OpcodeStats::g_inlineCacheMissCounts[InlineCacheKindEnd];
+
+static const char* const opcodeNames[] = {
+#define DECLARE_BYTECODE_NAME(name) #name,
+    FOR_EACH_BYTECODE(DECLARE_BYTECODE_NAME)
+#undef DECLARE_BYTECODE_NAME
+};
+
+static const char* const inlineCacheKindNames[] = {
+    "GetObjectPreComputedCase",
+    "SetObjectPreComputedCase",
+    "GetGlobalVariable",
+};
+
+COMPILE_ASSERT(sizeof(opcodeNames) / sizeof(const char*) == OpcodeKindEnd, "");
+COMPILE_ASSERT(sizeof(inlineCacheKindNames) / sizeof(const char*) == OpcodeStats::InlineCacheKindEnd, "");
+
+// std::map never moves its values so that callers can keep the address of a counter
+static std::map<std::string, size_t>& slowPathCounters()
+{
+    static std::map<std::string, size_t> counters;
+    return counters;
+}
+
+size_t* OpcodeStats::slowPathCounter(const char* functionName, int line)
+{
+    return &slowPathCounters()[std::string(functionName) + ":" + std::to_string(line)];
+}
+
+void OpcodeStats::reset()
+{
+    memset(g_opcodeCounts, 0, sizeof(g_opcodeCounts));
+    memset(g_inlineCacheHitCounts, 0, sizeof(g_inlineCacheHitCounts));
+    memset(g_inlineCacheMissCounts, 0, sizeof(g_inlineCacheMissCounts));
+    for (auto& iter : slowPathCounters()) {
+        iter.second = 0;
+    }
+}
+
+template <typename Item>
+static void appendCounts(std::string& out, std::vector<Item>& items)
+{
+    // most frequent first
+    std::stable_sort(items.begin(), items.end(), [](const Item& a, const Item& b) {
+        return a.second > b.second;
+    });
+
+    out += '{';
+    for (size_t i = 0; i < items.size(); i++) {
+        if (i) {
+            out += ',';
+        }
+        out += '"';
+        out += items[i].first;
+        out += "\":" + std::to_string(items[i].second);
+    }
+    out += '}';
+}
+
+std::string OpcodeStats::toJSON()
+{
+    std::string out;
+    size_t total = 0;
+
+    std::vector<std::pair<const char*, size_t>> opcodes;
+    for (size_t i = 0; i < OpcodeKindEnd; i++) {
+        if (g_opcodeCounts[i]) {
+            opcodes.push_back(std::make_pair(opcodeNames[i], g_opcodeCounts[i]));
+            total += g_opcodeCounts[i];
+        }
+    }
+    out += "{\"totalDispatchCount\":" + std::to_string(total);
+    out += ",\"opcodes\":";
+    appendCounts(out, opcodes);
+
+    std::vector<std::pair<std::string, size_t>> slowPaths;
+    for (const auto& iter : slowPathCounters()) {
+        if (iter.second) {
+            slowPaths.push_back(iter);
+        }
+    }
+    out += ",\"slowPaths\":";
+    appendCounts(out, slowPaths);
+
+    out += ",\"inlineCaches\":{";
+    for (size_t i = 0; i < InlineCacheKindEnd; i++) {
+        if (i) {
+            out += ',';
+        }
+        out += '"';
+        out += inlineCacheKindNames[i];
+        out += "\":{\"hit\":" + std::to_string(g_inlineCacheHitCounts[i]);
+        out += ",\"miss\":" + std::to_string(g_inlineCacheMissCounts[i]) + "}";
+    }
+    out += "}}";
+
+    return out;
+}
+
+} // namespace Escargot
+
+#endif
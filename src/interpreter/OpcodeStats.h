@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) 2024-present Samsung Electronics Co., Ltd
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+ *  USA
+ */
+
+#ifndef __EscargotOpcodeStats__
+#define __EscargotOpcodeStats__
+
+#if defined(ENABLE_OPCODE_STATS)
+
+#include "interpreter/ByteCode.h"
+
+namespace Escargot {
+
+// Execution counters for interpreter tuning (ESCARGOT_OPCODE_STATS build only)
+// Counts dispatches of each opcode, entries of each InterpreterSlowPath call site
+// and inline cache hit/miss of property and global variable access sites.
+// Counters are process-wide and not synchronized
+class OpcodeStats {
+public:
+    enum InlineCacheKind {
+        GetObjectPreComputedCaseInlineCache,
+        SetObjectPreComputedCaseInlineCache,
+        GetGlobalVariableInlineCache,
+        InlineCacheKindEnd,
+    };
+
+    static void countOpcode(Opcode opcode)
+    {
+        ASSERT(opcode < OpcodeKindEnd);
+        g_opcodeCounts[opcode]++;
+    }
+
+    static void countInlineCacheHit(InlineCacheKind kind)
+    {
+        g_inlineCacheHitCounts[kind]++;
+    }
+
+    static void countInlineCacheMiss(InlineCacheKind kind)
+    {
+        g_inlineCacheMissCounts[kind]++;
+    }
+
+    // returns counter of a slow path call site, keyed by "function:line"
+    // so that overloads and several sites in one function are counted apart
+    // callers keep it in a function-local static
+    static size_t* slowPathCounter(const char* functionName, int line);
+
+    static void reset();
+    static std::string toJSON();
+
+private:
+    static size_t g_opcodeCounts[OpcodeKindEnd];
+    static size_t g_inlineCacheHitCounts[InlineCacheKindEnd];
+    static size_t g_inlineCacheMissCounts[InlineCacheKindEnd];
+};
+
+} // namespace Escargot
+
+#define OPCODE_STATS_COUNT_OPCODE(opcode) OpcodeStats::countOpcode(opcode)
+#define OPCODE_STATS_COUNT_SLOW_PATH()                                                     \
+    {                                                                                      \
+        static size_t* slowPathCounter = OpcodeStats::slowPathCounter(__func__, __LINE__); \
+        (*slowPathCounter)++;                                                              \
+    }
+#define OPCODE_STATS_COUNT_INLINE_CACHE_HIT(kind) OpcodeStats::countInlineCacheHit(OpcodeStats::kind##InlineCache)
+#define OPCODE_STATS_COUNT_INLINE_CACHE_MISS(kind) OpcodeStats::countInlineCacheMiss(OpcodeStats::kind##InlineCache)
+
+#else
+
+#define OPCODE_STATS_COUNT_OPCODE(opcode)
+#define OPCODE_STATS_COUNT_SLOW_PATH()
+#define OPCODE_STATS_COUNT_INLINE_CACHE_HIT(kind)
+#define OPCODE_STATS_COUNT_INLINE_CACHE_MISS(kind)
+
+#endif
+
+#endif
@@ -289,6 +289,7 @@ InterpretedCodeBlock::InterpretedCodeBlock(Context* ctx, Script* script)
     , m_allowSuperProperty(false)
     , m_allowArguments(false)
     , m_hasDynamicSourceCode(false)
+    , m_isByteCodeBlockEvicted(false)
 #if defined(ENABLE_TCO)
     , m_isTailRecursionDisabled(false)
 #endif
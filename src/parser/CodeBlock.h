@@ -795,6 +795,16 @@ public:
         m_hasDynamicSourceCode = true;
     }
 
+    bool isByteCodeBlockEvicted() const
+    {
+        return m_isByteCodeBlockEvicted;
+    }
+
+    void setByteCodeBlockEvicted(bool evicted)
+    {
+        m_isByteCodeBlockEvicted = evicted;
+    }
+
 #if defined(ENABLE_TCO)
     bool isTailRecursionDisabled() const
     {
@@ -1012,6 +1022,8 @@ protected:
     bool m_allowArguments : 1;
     // represent if its source code is created dynamically by createDynamicFunctionScript
     bool m_hasDynamicSourceCode : 1;
+    // ByteCodeBlock was released by VMInstance to reduce memory and should be regenerated on the next call
+    bool m_isByteCodeBlockEvicted : 1;
 #if defined(ENABLE_TCO)
     bool m_isTailRecursionDisabled : 1;
 #endif
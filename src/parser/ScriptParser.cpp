@@ -77,6 +77,7 @@ ScriptParser::ScriptParser(Context* c)
 ScriptParser::InitializeScriptResult::InitializeScriptResult()
     : parseErrorCode(ErrorCode::None)
     , parseErrorMessage(String::emptyString)
+    , loadedFromCodeCache(false)
 {
 }
 
@@ -311,6 +312,111 @@ void ScriptParser::deleteCodeBlockCacheInfo()
     delete m_codeBlockCacheInfo;
     m_codeBlockCacheInfo = nullptr;
 }
+
+bool ScriptParser::createCodeCacheData(Script* script, std::string& data)
+{
+    ASSERT(m_context->astAllocator().isInitialized());
+
+    String* source = script->sourceCode();
+    if (script->isModule() || !source->length()) {
+        return false;
+    }
+
+    CodeCache* codeCache = m_context->vmInstance()->codeCache();
+    CodeCacheIndex::ScriptID scriptID(source->hashValue(), source->length());
+    std::vector<CodeCache::CodeCacheEntryChunk> entries;
+    std::string cacheData;
+
+    GC_disable();
+
+    // parse the source code again to store CodeBlock tree and bytecode
+    // given script is not changed
+    CodeBlockCacheInfoHolder cacheInfoHolder;
+    cacheInfoHolder.setCacheInfo(this, new CodeBlockCacheInfo());
+
+    StringView sourceView(source, 0, source->length());
+    InterpretedCodeBlock* topCodeBlock = nullptr;
+    ProgramNode* programNode = nullptr;
+
+    try {
+        ASTClassInfo* outerClassInfo = esprima::generateClassInfoFrom(m_context, nullptr);
+        programNode = esprima::parseProgram(m_context, sourceView, outerClassInfo, false, false, false, false, false, false, true);
+
+        Script* cacheScript = new Script(script->srcName(), source, nullptr, 0, false, scriptID.m_srcHash);
+        topCodeBlock = generateCodeBlockTreeFromAST(m_context, sourceView, cacheScript, programNode, false, false);
+        generateCodeBlockTreeFromASTWalkerPostProcess(topCodeBlock);
+        cacheScript->m_topCodeBlock = topCodeBlock;
+    } catch (esprima::Error* orgError) {
+        m_context->astAllocator().reset();
+        GC_enable();
+        delete orgError;
+        return false;
+    }
+
+    bool result = codeCache->storeCacheData(m_context, CodeCacheIndex(scriptID.m_srcHash, scriptID.m_srcLength, SIZE_MAX), topCodeBlock, m_codeBlockCacheInfo, programNode, entries, cacheData);
+    m_context->astAllocator().reset();
+
+    // store every function too
+    std::vector<InterpretedCodeBlock*> codeBlocks;
+    codeBlocks.push_back(topCodeBlock);
+    for (size_t i = 0; result && i < codeBlocks.size(); i++) {
+        InterpretedCodeBlock* codeBlock = codeBlocks[i];
+        if (codeBlock->hasChildren()) {
+            InterpretedCodeBlockVector& childrenVector = codeBlock->children();
+            for (size_t j = 0; j < childrenVector.size(); j++) {
+                codeBlocks.push_back(childrenVector[j]);
+            }
+        }
+
+        if (codeBlock == topCodeBlock) {
+            continue;
+        }
+
+        FunctionNode* functionNode;
+        try {
+            functionNode = esprima::parseSingleFunction(m_context, codeBlock);
+        } catch (esprima::Error* orgError) {
+            m_context->astAllocator().reset();
+            delete orgError;
+            result = false;
+            break;
+        }
+
+        result = codeCache->storeCacheData(m_context, CodeCacheIndex(scriptID.m_srcHash, scriptID.m_srcLength, codeBlock->functionStart().index), codeBlock, nullptr, functionNode, entries, cacheData);
+        m_context->astAllocator().reset();
+    }
+
+    GC_enable();
+
+    if (LIKELY(result)) {
+        data = CodeCache::createCacheData(scriptID, entries, cacheData);
+    }
+    return result;
+}
+
+ScriptParser::InitializeScriptResult ScriptParser::initializeScriptWithCodeCacheData(String* source, String* srcName, const char* data, size_t size)
+{
+    ASSERT(m_context->astAllocator().isInitialized());
+
+    if (data && size && source->length()) {
+        GC_disable();
+
+        Script* script = new Script(srcName, source, nullptr, 0, false, source->hashValue());
+        bool loadingDone = m_context->vmInstance()->codeCache()->loadCacheData(m_context, script, data, size);
+
+        GC_enable();
+
+        if (LIKELY(loadingDone)) {
+            ScriptParser::InitializeScriptResult result;
+            result.script = script;
+            result.loadedFromCodeCache = true;
+            return result;
+        }
+    }
+
+    // version or source code mismatch, parse the source code instead
+    return initializeScript(source, srcName, false);
+}
 #endif
 
 ScriptParser::InitializeScriptResult ScriptParser::initializeScript(String* originSource, size_t originLineOffset, String* source, String* srcName, InterpretedCodeBlock* parentCodeBlock, bool isModule, bool isEvalMode, bool isEvalCodeInFunction, bool inWithOperation, bool strictFromOutside, bool allowSuperCall, bool allowSuperProperty, bool allowNewTarget, bool needByteCodeGeneration)
@@ -344,6 +450,7 @@ ScriptParser::InitializeScriptResult ScriptParser::initializeScript(String* orig
             if (LIKELY(loadingDone)) {
                 ScriptParser::InitializeScriptResult result;
                 result.script = script;
+                result.loadedFromCodeCache = true;
                 return result;
             }
 
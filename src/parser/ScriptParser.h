@@ -46,6 +46,7 @@ public:
         Optional<Script*> script;
         ErrorCode parseErrorCode;
         String* parseErrorMessage;
+        bool loadedFromCodeCache;
 
         InitializeScriptResult();
         Script* scriptThrowsExceptionIfParseError(ExecutionState& state);
@@ -66,6 +67,10 @@ public:
 #if defined(ENABLE_CODE_CACHE)
     void setCodeBlockCacheInfo(CodeBlockCacheInfo* info);
     void deleteCodeBlockCacheInfo();
+
+    // in-memory code cache data of a whole script (global code and every function) taken and given back by embedder
+    bool createCodeCacheData(Script* script, std::string& data);
+    InitializeScriptResult initializeScriptWithCodeCacheData(String* source, String* srcName, const char* data, size_t size);
 #endif
 
 private:
@@ -79,6 +79,37 @@ void GlobalObject::initializeBuiltins(ExecutionState& state)
 #undef DECLARE_BUILTIN_INIT_FUNC
 }
 
+bool GlobalObject::builtinPlaceholderSetter(ExecutionState& state, Object* self, const Value& receiver, EncodedValue& privateDataFromObjectPrivateArea, const Value& setterInputData)
+{
+    ASSERT(self->isGlobalObject());
+    privateDataFromObjectPrivateArea = setterInputData;
+    return true;
+}
+
+void GlobalObject::replaceBuiltinValue(ExecutionState& state, const ObjectPropertyName& P, const ObjectPropertyDescriptor& desc)
+{
+    ASSERT(!P.isIndexString());
+    ASSERT(desc.isDataProperty());
+    ASSERT(desc.isWritable());
+    ASSERT(desc.isConfigurable());
+
+    auto findResult = m_structure->findProperty(P.toObjectStructurePropertyName(state));
+    if (findResult.first == SIZE_MAX) {
+        // deleted before installation
+        return;
+    }
+
+    const ObjectStructurePropertyDescriptor& current = findResult.second.value()->m_descriptor;
+    if (!current.isNativeAccessorProperty() || current.nativeGetterSetterData()->m_setter != builtinPlaceholderSetter
+        || !Value(m_values[findResult.first]).isEmpty()) {
+        // redefined or written before installation
+        return;
+    }
+
+    m_structure = m_structure->replacePropertyDescriptor(findResult.first, desc.toObjectStructurePropertyDescriptor());
+    m_values[findResult.first] = desc.value();
+}
+
 Value builtinSpeciesGetter(ExecutionState& state, Value thisValue, size_t argc, Value* argv, Optional<Object*> newTarget)
 {
     return thisValue;
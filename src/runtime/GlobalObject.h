@@ -160,10 +160,7 @@ class FunctionObject;
     F(eval, FunctionObject, objName)            \
     F(parseInt, FunctionObject, objName)        \
     F(parseFloat, FunctionObject, objName)      \
-    F(arrayToString, FunctionObject, objName)   \
-    F(asyncIteratorPrototype, Object, objName)  \
-    F(iteratorPrototype, Object, objName)       \
-    F(genericIteratorPrototype, Object, objName)
+    F(arrayToString, FunctionObject, objName)
 
 #define GLOBALOBJECT_BUILTIN_PROMISE(F, objName)  \
     F(promise, FunctionObject, objName)           \
@@ -252,6 +249,9 @@ class FunctionObject;
 
 #define GLOBALOBJECT_BUILTIN_ITERATOR(F, objName)     \
     F(iterator, FunctionObject, objName)              \
+    F(asyncIteratorPrototype, Object, objName)        \
+    F(iteratorPrototype, Object, objName)             \
+    F(genericIteratorPrototype, Object, objName)      \
     F(wrapForValidIteratorPrototype, Object, objName) \
     F(iteratorHelperPrototype, Object, objName)
 
@@ -402,6 +402,35 @@ private:
     GLOBALOBJECT_BUILTIN_OBJECT_LIST(DECLARE_BUILTIN_MEMBER_FUNC, )
 #undef DECLARE_BUILTIN_MEMBER_FUNC
 
+    /*
+       Lazy builtin placeholder
+       initialize##objName defines the global property as a native data property whose getter installs the builtin
+       placeholder data is static and shared by every context, so defining it allocates nothing per context
+       a value written before installation is kept in the property slot and returned instead of the builtin
+    */
+    template <typename T, T* (GlobalObject::*builtin)()>
+    static Value builtinPlaceholderGetter(ExecutionState& state, Object* self, const Value& receiver, const EncodedValue& privateDataFromObjectPrivateArea)
+    {
+        ASSERT(self->isGlobalObject());
+        Value written(privateDataFromObjectPrivateArea);
+        if (!written.isEmpty()) {
+            return written;
+        }
+        return (self->asGlobalObject()->*builtin)();
+    }
+    static bool builtinPlaceholderSetter(ExecutionState& state, Object* self, const Value& receiver, EncodedValue& privateDataFromObjectPrivateArea, const Value& setterInputData);
+
+    template <typename T, T* (GlobalObject::*builtin)()>
+    void defineBuiltinPlaceholder(ExecutionState& state, const ObjectPropertyName& name)
+    {
+        static ObjectPropertyNativeGetterSetterData placeholderData(true, false, true, &builtinPlaceholderGetter<T, builtin>, &builtinPlaceholderSetter);
+        defineNativeDataAccessorProperty(state, name, &placeholderData, Value(Value::EmptyValue));
+    }
+
+    // called at the end of install##objName to replace the placeholder with the installed builtin
+    // the property is left alone when the program has already deleted, written or redefined it
+    void replaceBuiltinValue(ExecutionState& state, const ObjectPropertyName& P, const ObjectPropertyDescriptor& desc);
+
     template <typename TA, int elementSize>
     FunctionObject* installTypedArray(ExecutionState& state, AtomicString taName, Object** proto, FunctionObject* typedArrayFunction);
 };
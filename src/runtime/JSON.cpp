@@ -20,15 +20,17 @@
 #include "Escargot.h"
 #include "runtime/JSON.h"
 #include "runtime/Context.h"
+#include "runtime/VMInstance.h"
 #include "runtime/StringObject.h"
 #include "runtime/ArrayObject.h"
 #include "runtime/TypedArrayObject.h"
 #include "runtime/BooleanObject.h"
 #include "runtime/BigIntObject.h"
+#include "double-conversion.h"
 
 #define RAPIDJSON_PARSE_DEFAULT_FLAGS kParseFullPrecisionFlag
 #define RAPIDJSON_ERROR_CHARTYPE char
-#include <rapidjson/document.h>
+#include <rapidjson/reader.h>
 #include <rapidjson/filereadstream.h>
 #include <rapidjson/memorystream.h>
 #include <rapidjson/internal/dtoa.h>
@@ -38,11 +40,12 @@
 
 namespace Escargot {
 
-template <typename Encoding>
+// SourceCharType can be narrower than Ch, so 8-bit strings are parsed without widening them first
+template <typename Encoding, typename SourceCharType = typename Encoding::Ch>
 struct JSONStringStream {
     typedef typename Encoding::Ch Ch;
 
-    JSONStringStream(const Ch* src, size_t length)
+    JSONStringStream(const SourceCharType* src, size_t length)
         : src_(src)
         , head_(src)
         , tail_(src + length)
@@ -77,103 +80,506 @@ struct JSONStringStream {
         return 0;
     }
 
-    const Ch* src_; //!< Current read position.
-    const Ch* head_; //!< Original head of the string.
-    const Ch* tail_;
+    const SourceCharType* src_; //!< Current read position.
+    const SourceCharType* head_; //!< Original head of the string.
+    const SourceCharType* tail_;
 };
 
-template <typename CharType, typename JSONCharType>
-static Value parseJSONWorker(ExecutionState& state, rapidjson::GenericValue<JSONCharType>& value)
-{
-    CHECK_STACK_OVERFLOW(state);
-
-    if (value.IsBool()) {
-        return Value(value.GetBool());
-    } else if (value.IsInt()) {
-        return Value(value.GetInt());
-    } else if (value.IsUint()) {
-        return Value(value.GetUint());
-    } else if (value.IsInt64()) {
-        return Value(value.GetInt64());
-    } else if (value.IsUint64()) {
-        return Value(value.GetUint64());
-    } else if (value.IsDouble()) {
-        return Value(Value::DoubleToIntConvertibleTestNeeds, value.GetDouble());
-    } else if (value.IsNull()) {
-        return Value(Value::Null);
-    } else if (value.IsString()) {
-        if (std::is_same<CharType, char16_t>::value) {
-            const char16_t* chars = (const char16_t*)value.GetString();
-            unsigned len = value.GetStringLength();
-            if (isAllLatin1(chars, len)) {
-                return String::fromLatin1(chars, len);
+bool JSONValueBuilder::String(const char16_t* str, unsigned length, bool copy)
+{
+    if (isAllLatin1(str, length)) {
+        m_stack.pushBack(Escargot::String::fromLatin1(str, length));
+    } else {
+        m_stack.pushBack(new UTF16String(str, length));
+    }
+    return true;
+}
+
+bool JSONValueBuilder::Key(const char16_t* str, unsigned length, bool copy)
+{
+    m_stack.pushBack(AtomicString(*m_state, str, length).string());
+    return true;
+}
+
+Object* JSONValueBuilder::createObjectWithCachedStructure(size_t base, unsigned memberCount, size_t keysHash)
+{
+    auto iter = m_structureCache.find(keysHash);
+    if (iter == m_structureCache.end()) {
+        return nullptr;
+    }
+
+    ObjectStructure* structure = iter->second;
+    if (structure->propertyCount() != memberCount) {
+        return nullptr;
+    }
+    const ObjectStructureItem* properties = structure->properties();
+    for (size_t i = 0; i < memberCount; i++) {
+        if (properties[i].m_propertyName != AtomicString(m_state->context(), m_stack[base + i * 2].asString())) {
+            return nullptr;
+        }
+    }
+
+    ObjectPropertyValueVector values;
+    values.resizeWithUninitializedValues(0, memberCount);
+    for (size_t i = 0; i < memberCount; i++) {
+        values[i] = m_stack[base + i * 2 + 1];
+    }
+    return new Object(structure, std::move(values), m_state->context()->globalObject()->objectPrototype());
+}
+
+bool JSONValueBuilder::EndObject(unsigned memberCount)
+{
+    ExecutionState& state = *m_state;
+    size_t base = m_stack.size() - memberCount * 2;
+    Object* obj;
+    if (!ObjectStructure::isTransitionModeAvailable(memberCount)) {
+        Value* member = &m_stack[base];
+        obj = new Object(state, memberCount,
+                         [](ExecutionState& state, void* data) -> std::pair<Value, Value> {
+                             Value*& member = *((Value**)data);
+                             auto keyAndValue = std::make_pair(member[0], member[1]);
+                             member += 2;
+                             return keyAndValue;
+                         },
+                         &member, true, true, true);
+    } else {
+        // keys are atomic strings, so the sequence is identified by their addresses
+        size_t keysHash = memberCount;
+        for (size_t i = base; i < m_stack.size(); i += 2) {
+            keysHash = keysHash * 31 + (reinterpret_cast<size_t>(m_stack[i].asString()) >> 3);
+        }
+
+        obj = createObjectWithCachedStructure(base, memberCount, keysHash);
+        if (!obj) {
+            obj = new Object(state);
+            for (size_t i = base; i < m_stack.size(); i += 2) {
+                ASSERT(m_stack[i].isString());
+                obj->defineOwnProperty(state, ObjectPropertyName(AtomicString(state, m_stack[i].asString())),
+                                       ObjectPropertyDescriptor(m_stack[i + 1], ObjectPropertyDescriptor::AllPresent));
+            }
+            // structures out of transition mode belong to one object. duplicate keys leave fewer properties than members
+            if (obj->structure()->inTransitionMode() && obj->structure()->propertyCount() == memberCount) {
+                m_structureCache[keysHash] = obj->structure();
+            }
+        }
+    }
+    m_stack.resizeWithUninitializedValues(base);
+    m_stack.pushBack(obj);
+    return true;
+}
+
+bool JSONValueBuilder::EndArray(unsigned elementCount)
+{
+    ExecutionState& state = *m_state;
+    size_t base = m_stack.size() - elementCount;
+    ArrayObject* arr = new ArrayObject(state, elementCount, false);
+    for (size_t i = 0; i < elementCount; i++) {
+        arr->defineOwnIndexedPropertyWithoutExpanding(state, i, m_stack[base + i]);
+    }
+    m_stack.resizeWithUninitializedValues(base);
+    m_stack.pushBack(arr);
+    return true;
+}
+
+// values are built directly from the parse events, without an intermediate document
+template <typename CharType>
+static Value parseJSON(ExecutionState& state, const CharType* data, size_t length)
+{
+    auto strings = &state.context()->staticStrings();
+    typedef rapidjson::UTF16<char16_t> JSONEncoding;
+    rapidjson::GenericReader<JSONEncoding, JSONEncoding> reader;
+    JSONStringStream<JSONEncoding, CharType> stringStream(data, length);
+    JSONValueBuilder builder(&state);
+
+    reader.Parse<rapidjson::kParseDefaultFlags | rapidjson::kParseIterativeFlag>(stringStream, builder);
+    if (reader.HasParseError()) {
+        ErrorObject::throwBuiltinError(state, ErrorCode::SyntaxError, strings->JSON.string(), true, strings->parse.string(), rapidjson::GetParseError_En(reader.GetParseErrorCode()));
+    }
+
+    return builder.result();
+}
+
+JSONParser::JSONParser()
+    : m_expect(Expect::Value)
+    , m_tokenType(TokenType::None)
+    , m_escaped(false)
+{
+}
+
+static bool isJSONWhiteSpace(char c)
+{
+    return c == ' ' || c == '\t' || c == '\n' || c == '\r';
+}
+
+static bool isJSONDigit(char c)
+{
+    return c >= '0' && c <= '9';
+}
+
+static bool isJSONNumberChar(char c)
+{
+    return isJSONDigit(c) || c == '-' || c == '+' || c == '.' || c == 'e' || c == 'E';
+}
+
+static bool isJSONLiteralChar(char c)
+{
+    return c >= 'a' && c <= 'z';
+}
+
+static bool isValidJSONNumber(const char* src, size_t length)
+{
+    size_t i = 0;
+    if (src[i] == '-') {
+        i++;
+    }
+    if (i < length && src[i] == '0') {
+        i++;
+    } else if (i < length && isJSONDigit(src[i])) {
+        while (i < length && isJSONDigit(src[i])) {
+            i++;
+        }
+    } else {
+        return false;
+    }
+    if (i < length && src[i] == '.') {
+        size_t digitStart = ++i;
+        while (i < length && isJSONDigit(src[i])) {
+            i++;
+        }
+        if (i == digitStart) {
+            return false;
+        }
+    }
+    if (i < length && (src[i] == 'e' || src[i] == 'E')) {
+        i++;
+        if (i < length && (src[i] == '+' || src[i] == '-')) {
+            i++;
+        }
+        size_t digitStart = i;
+        while (i < length && isJSONDigit(src[i])) {
+            i++;
+        }
+        if (i == digitStart) {
+            return false;
+        }
+    }
+    return i == length;
+}
+
+void JSONParser::parseChunk(ExecutionState& state, const char* src, size_t length)
+{
+    m_builder.setState(&state);
+    size_t i = 0;
+    while (i < length) {
+        char c = src[i];
+        if (m_tokenType == TokenType::String || m_tokenType == TokenType::Key) {
+            while (i < length) {
+                c = src[i];
+                if (m_escaped) {
+                    m_escaped = false;
+                } else if (c == '\\') {
+                    m_escaped = true;
+                } else if (c == '"') {
+                    break;
+                }
+                m_token.pushBack(c);
+                i++;
+            }
+            if (i == length) {
+                // the string continues in the next chunk
+                break;
+            }
+            i++;
+            endToken(state);
+            continue;
+        }
+
+        if (m_tokenType == TokenType::Number || m_tokenType == TokenType::Literal) {
+            if (m_tokenType == TokenType::Number ? isJSONNumberChar(c) : isJSONLiteralChar(c)) {
+                m_token.pushBack(c);
+                i++;
+                continue;
+            }
+            endToken(state);
+        }
+
+        i++;
+        if (isJSONWhiteSpace(c)) {
+            continue;
+        }
+
+        switch (m_expect) {
+        case Expect::Value:
+            startValue(state, c);
+            break;
+        case Expect::ValueOrArrayEnd:
+            if (c == ']') {
+                endContainer(state, c);
             } else {
-                return new UTF16String(chars, len);
+                startValue(state, c);
             }
-        } else {
-            const char* valueAsString = (const char*)value.GetString();
-            size_t len = strlen(valueAsString);
-            if (isAllASCII(valueAsString, len)) {
-                return String::fromASCII(valueAsString, len);
+            break;
+        case Expect::KeyOrObjectEnd:
+            if (c == '}') {
+                endContainer(state, c);
+                break;
+            }
+            FALLTHROUGH;
+        case Expect::Key:
+            if (c != '"') {
+                throwSyntaxError(state, "Missing a name for object member.");
+            }
+            m_tokenType = TokenType::Key;
+            break;
+        case Expect::Colon:
+            if (c != ':') {
+                throwSyntaxError(state, "Missing a colon after a name of object member.");
+            }
+            m_expect = Expect::Value;
+            break;
+        case Expect::CommaOrEnd:
+            if (c == ',') {
+                m_expect = m_containers.back() == '{' ? Expect::Key : Expect::Value;
             } else {
-                return new UTF16String(utf8StringToUTF16String(valueAsString, len));
+                endContainer(state, c);
             }
+            break;
+        case Expect::End:
+            throwSyntaxError(state, "The document root must not be followed by other values.");
+            break;
         }
-    } else if (value.IsArray()) {
-        ArrayObject* arr = new ArrayObject(state, value.Size(), false);
-        for (size_t i = 0; i < value.Size(); i++) {
-            arr->defineOwnIndexedPropertyWithoutExpanding(state, i, parseJSONWorker<CharType, JSONCharType>(state, value[i]));
-        }
-        return arr;
-    } else if (value.IsObject()) {
-        Object* obj;
-        auto memberCount = value.MemberCount();
-        if (!ObjectStructure::isTransitionModeAvailable(memberCount)) {
-            typedef typename rapidjson::GenericValue<JSONCharType>::MemberIterator JSONIter;
-            JSONIter iter = value.MemberBegin();
-            obj = new Object(state, memberCount,
-                             [](ExecutionState& state, void* data) -> std::pair<Value, Value> {
-                                 JSONIter& iter = *((JSONIter*)data);
-                                 Value propertyName = parseJSONWorker<CharType, JSONCharType>(state, iter->name);
-                                 Value value = parseJSONWorker<CharType, JSONCharType>(state, iter->value);
-                                 iter++;
-                                 return std::make_pair(propertyName, value);
-                             },
-                             &iter, true, true, true);
-            ASSERT(iter == value.MemberEnd());
+    }
+}
+
+Value JSONParser::finish(ExecutionState& state)
+{
+    m_builder.setState(&state);
+    if (m_tokenType == TokenType::String || m_tokenType == TokenType::Key) {
+        throwSyntaxError(state, "Missing a closing quotation mark in string.");
+    }
+    if (m_tokenType != TokenType::None) {
+        endToken(state);
+    }
+    if (m_expect != Expect::End) {
+        throwSyntaxError(state, m_expect == Expect::Value && m_containers.empty() ? "The document is empty." : "Unexpected end of input.");
+    }
+
+    Value result = m_builder.result();
+    reset();
+    return result;
+}
+
+void JSONParser::startValue(ExecutionState& state, char c)
+{
+    switch (c) {
+    case '{':
+        m_builder.StartObject();
+        m_containers.pushBack(c);
+        m_memberCounts.pushBack(0);
+        m_expect = Expect::KeyOrObjectEnd;
+        break;
+    case '[':
+        m_builder.StartArray();
+        m_containers.pushBack(c);
+        m_memberCounts.pushBack(0);
+        m_expect = Expect::ValueOrArrayEnd;
+        break;
+    case '"':
+        m_tokenType = TokenType::String;
+        break;
+    default:
+        if (c == '-' || isJSONDigit(c)) {
+            m_tokenType = TokenType::Number;
+        } else if (isJSONLiteralChar(c)) {
+            m_tokenType = TokenType::Literal;
         } else {
-            obj = new Object(state);
-            auto iter = value.MemberBegin();
-            while (iter != value.MemberEnd()) {
-                Value propertyName = parseJSONWorker<CharType, JSONCharType>(state, iter->name);
-                ASSERT(propertyName.isString());
-                obj->defineOwnProperty(state, ObjectPropertyName(AtomicString(state, propertyName.toString(state))),
-                                       ObjectPropertyDescriptor(parseJSONWorker<CharType, JSONCharType>(state, iter->value), ObjectPropertyDescriptor::AllPresent));
-                iter++;
-            }
+            throwSyntaxError(state, "Invalid value.");
         }
-        return obj;
+        m_token.pushBack(c);
+        break;
+    }
+}
+
+void JSONParser::endValue()
+{
+    if (m_containers.size()) {
+        m_memberCounts.back()++;
+        m_expect = Expect::CommaOrEnd;
     } else {
-        RELEASE_ASSERT_NOT_REACHED();
+        m_expect = Expect::End;
     }
 }
 
-template <typename CharType, typename JSONCharType>
-static Value parseJSON(ExecutionState& state, const CharType* data, size_t length)
+void JSONParser::endContainer(ExecutionState& state, char c)
 {
-    auto strings = &state.context()->staticStrings();
-    rapidjson::GenericDocument<JSONCharType> jsonDocument;
+    char open = m_containers.back();
+    if (open == '{' && c != '}') {
+        throwSyntaxError(state, "Missing a comma or '}' after an object member.");
+    } else if (open == '[' && c != ']') {
+        throwSyntaxError(state, "Missing a comma or ']' after an array element.");
+    }
 
-    JSONStringStream<JSONCharType> stringStream(data, length);
-    jsonDocument.ParseStream(stringStream);
-    if (jsonDocument.HasParseError()) {
-        ErrorObject::throwBuiltinError(state, ErrorCode::SyntaxError, strings->JSON.string(), true, strings->parse.string(), rapidjson::GetParseError_En(jsonDocument.GetParseError()));
+    size_t count = m_memberCounts.back();
+    m_containers.pop_back();
+    m_memberCounts.pop_back();
+    if (open == '{') {
+        m_builder.EndObject(count);
+    } else {
+        m_builder.EndArray(count);
     }
+    endValue();
+}
+
+void JSONParser::endToken(ExecutionState& state)
+{
+    TokenType type = m_tokenType;
+    m_tokenType = TokenType::None;
 
-    return parseJSONWorker<CharType, JSONCharType>(state, jsonDocument);
+    const char* src = m_token.data();
+    size_t length = m_token.size();
+    switch (type) {
+    case TokenType::String:
+    case TokenType::Key:
+        endStringToken(state, type == TokenType::Key);
+        break;
+    case TokenType::Number: {
+        if (!isValidJSONNumber(src, length)) {
+            throwSyntaxError(state, "Invalid value.");
+        }
+        double_conversion::StringToDoubleConverter converter(double_conversion::StringToDoubleConverter::NO_FLAGS,
+                                                             0.0, std::numeric_limits<double>::quiet_NaN(), nullptr, nullptr);
+        int processed;
+        m_builder.Double(converter.StringToDouble(src, length, &processed));
+        endValue();
+        break;
+    }
+    case TokenType::Literal:
+        if (length == 4 && !memcmp(src, "null", 4)) {
+            m_builder.Null();
+        } else if (length == 4 && !memcmp(src, "true", 4)) {
+            m_builder.Bool(true);
+        } else if (length == 5 && !memcmp(src, "false", 5)) {
+            m_builder.Bool(false);
+        } else {
+            throwSyntaxError(state, "Invalid value.");
+        }
+        endValue();
+        break;
+    default:
+        ASSERT_NOT_REACHED();
+    }
+    m_token.clear();
 }
 
-static void codePointTo4digitString(int codepoint, std::basic_string<char16_t>& ss)
+static int parseJSONHexDigit(char c)
+{
+    if (c >= '0' && c <= '9') {
+        return c - '0';
+    } else if (c >= 'a' && c <= 'f') {
+        return c - 'a' + 10;
+    } else if (c >= 'A' && c <= 'F') {
+        return c - 'A' + 10;
+    }
+    return -1;
+}
+
+void JSONParser::endStringToken(ExecutionState& state, bool isKey)
+{
+    const char* src = m_token.data();
+    size_t length = m_token.size();
+    UTF16StringData result;
+    size_t runStart = 0;
+    auto appendRun = [&](size_t end) {
+        if (end > runStart) {
+            UTF16StringData run = utf8StringToUTF16String(src + runStart, end - runStart);
+            result.append(run.data(), run.length());
+        }
+    };
+
+    for (size_t i = 0; i < length; i++) {
+        unsigned char c = src[i];
+        if (c < 0x20) {
+            throwSyntaxError(state, "Invalid encoding in string.");
+        }
+        if (c != '\\') {
+            continue;
+        }
+        appendRun(i);
+        // an unescaped quotation mark ends the token, so an escape always has a next character
+        ASSERT(i + 1 < length);
+        char16_t ch;
+        switch (src[++i]) {
+        case '"':
+        case '\\':
+        case '/':
+            ch = src[i];
+            break;
+        case 'b':
+            ch = '\b';
+            break;
+        case 'f':
+            ch = '\f';
+            break;
+        case 'n':
+            ch = '\n';
+            break;
+        case 'r':
+            ch = '\r';
+            break;
+        case 't':
+            ch = '\t';
+            break;
+        case 'u': {
+            if (i + 4 >= length) {
+                throwSyntaxError(state, "Incorrect hex digit after \\u escape in string.");
+            }
+            int codeUnit = 0;
+            for (size_t j = 1; j <= 4; j++) {
+                int digit = parseJSONHexDigit(src[i + j]);
+                if (digit < 0) {
+                    throwSyntaxError(state, "Incorrect hex digit after \\u escape in string.");
+                }
+                codeUnit = codeUnit * 16 + digit;
+            }
+            ch = codeUnit;
+            i += 4;
+            break;
+        }
+        default:
+            throwSyntaxError(state, "Invalid escape character in string.");
+        }
+        result.append(&ch, 1);
+        runStart = i + 1;
+    }
+    appendRun(length);
+
+    if (isKey) {
+        m_builder.Key(result.data(), result.length(), true);
+        m_expect = Expect::Colon;
+    } else {
+        m_builder.String(result.data(), result.length(), true);
+        endValue();
+    }
+}
+
+void JSONParser::reset()
+{
+    m_builder.clear();
+    m_containers.clear();
+    m_memberCounts.clear();
+    m_token.clear();
+    m_expect = Expect::Value;
+    m_tokenType = TokenType::None;
+    m_escaped = false;
+}
+
+void JSONParser::throwSyntaxError(ExecutionState& state, const char* message)
+{
+    auto strings = &state.context()->staticStrings();
+    ErrorObject::throwBuiltinError(state, ErrorCode::SyntaxError, strings->JSON.string(), true, strings->parse.string(), message);
+}
+
+static void codePointTo4digitString(int codepoint, ChunkedStringBuilder& ss)
 {
     int d = 16 * 16 * 16;
     for (int i = 0; i < 4; ++i) {
@@ -185,9 +591,9 @@ static void codePointTo4digitString(int codepoint, std::basic_string<char16_t>&
                 c = (codepoint / d) - 10 + 'a';
             }
             codepoint %= d;
-            ss.push_back(c);
+            ss.appendChar(c);
         } else {
-            ss.push_back(u'0');
+            ss.appendChar(u'0');
         }
         d >>= 4;
     }
@@ -202,16 +608,9 @@ Value JSON::parse(ExecutionState& state, Value text, Value reviver)
     Value unfiltered;
 
     if (JText->has8BitContent()) {
-        size_t len = JText->length();
-        char16_t* char16Buf = new char16_t[len];
-        std::unique_ptr<char16_t[]> buf(char16Buf);
-        const LChar* srcBuf = JText->characters8();
-        for (size_t i = 0; i < len; i++) {
-            char16Buf[i] = srcBuf[i];
-        }
-        unfiltered = parseJSON<char16_t, rapidjson::UTF16<char16_t>>(state, buf.get(), JText->length());
+        unfiltered = parseJSON<LChar>(state, JText->characters8(), JText->length());
     } else {
-        unfiltered = parseJSON<char16_t, rapidjson::UTF16<char16_t>>(state, JText->characters16(), JText->length());
+        unfiltered = parseJSON<char16_t>(state, JText->characters16(), JText->length());
     }
 
     // 4
@@ -313,27 +712,23 @@ static void builtinJSONArrayReplacerHelper(ExecutionState& state, ValueVectorWit
     propertyList.push_back(Value(item));
 }
 
-static bool builtinJSONStringifyStr(ExecutionState& state, Value key, Object* holder,
-                                    StaticStrings* strings, Value replacerFunc, ValueVectorWithInlineStorage& stack, String* indent,
-                                    String* gap, bool propertyListTouched, ValueVectorWithInlineStorage& propertyList,
-                                    LargeStringBuilder& product);
+static void builtinJSONStringifyValue(ExecutionState& state, Value value,
+                                      StaticStrings* strings, Value replacerFunc, ValueVectorWithInlineStorage& stack, String* indent,
+                                      String* gap, bool propertyListTouched, ValueVectorWithInlineStorage& propertyList,
+                                      ChunkedStringBuilder& product);
 static void builtinJSONStringifyJA(ExecutionState& state, Object* obj,
                                    StaticStrings* strings, Value replacerFunc, ValueVectorWithInlineStorage& stack, String* indent,
                                    String* gap, bool propertyListTouched, ValueVectorWithInlineStorage& propertyList,
-                                   LargeStringBuilder& product);
+                                   ChunkedStringBuilder& product);
 static void builtinJSONStringifyJO(ExecutionState& state, Object* value,
                                    StaticStrings* strings, Value replacerFunc, ValueVectorWithInlineStorage& stack, String* indent,
                                    String* gap, bool propertyListTouched, ValueVectorWithInlineStorage& propertyList,
-                                   LargeStringBuilder& product);
-static void builtinJSONStringifyQuote(ExecutionState& state, Value value, LargeStringBuilder& product);
+                                   ChunkedStringBuilder& product);
+static void builtinJSONStringifyQuote(ExecutionState& state, Value value, ChunkedStringBuilder& product);
 
-// https://www.ecma-international.org/ecma-262/6.0/#sec-serializejsonproperty
-static bool builtinJSONStringifyStr(ExecutionState& state, Value key, Object* holder,
-                                    StaticStrings* strings, Value replacerFunc, ValueVectorWithInlineStorage& stack,
-                                    String* indent, String* gap, bool propertyListTouched, ValueVectorWithInlineStorage& propertyList,
-                                    LargeStringBuilder& product)
+// steps 2 ~ 4 of SerializeJSONProperty for a value already read from holder
+static Value builtinJSONStringifyResolveValue(ExecutionState& state, Value key, Object* holder, Value value, StaticStrings* strings, Value replacerFunc)
 {
-    Value value = holder->get(state, ObjectPropertyName(state, key)).value(state, holder);
     if (value.isObject() || value.isBigInt()) {
         Value toJson = Object::getV(state, value, ObjectPropertyName(state, strings->toJSON));
         if (toJson.isCallable()) {
@@ -358,47 +753,62 @@ static bool builtinJSONStringifyStr(ExecutionState& state, Value key, Object* ho
             value = Value(value.asObject()->asBigIntObject()->primitiveValue());
         }
     }
+
+    return value;
+}
+
+// https://www.ecma-international.org/ecma-262/6.0/#sec-serializejsonproperty
+// steps 1 ~ 4 of SerializeJSONProperty. the value is resolved before anything is written,
+// so callers can write the property key and then the value straight into the product
+static Value builtinJSONStringifyPropertyValue(ExecutionState& state, Value key, Object* holder, StaticStrings* strings, Value replacerFunc)
+{
+    Value value = holder->get(state, ObjectPropertyName(state, key)).value(state, holder);
+    return builtinJSONStringifyResolveValue(state, key, holder, value, strings, replacerFunc);
+}
+
+// SerializeJSONProperty returns undefined for these values
+static bool builtinJSONStringifyIsSerializable(const Value& value)
+{
+    return !value.isUndefined() && !value.isSymbol() && !value.isCallable();
+}
+
+// steps 5 ~ 12 of SerializeJSONProperty
+static void builtinJSONStringifyValue(ExecutionState& state, Value value,
+                                      StaticStrings* strings, Value replacerFunc, ValueVectorWithInlineStorage& stack,
+                                      String* indent, String* gap, bool propertyListTouched, ValueVectorWithInlineStorage& propertyList,
+                                      ChunkedStringBuilder& product)
+{
+    ASSERT(builtinJSONStringifyIsSerializable(value));
     if (value.isNull()) {
         product.appendString(strings->null.string());
-        return true;
-    }
-    if (value.isBoolean()) {
+    } else if (value.isBoolean()) {
         product.appendString(value.asBoolean() ? strings->stringTrue.string() : strings->stringFalse.string());
-        return true;
-    }
-    if (value.isString()) {
+    } else if (value.isString()) {
         builtinJSONStringifyQuote(state, value.asString(), product);
-        return true;
-    }
-    if (value.isNumber()) {
+    } else if (value.isNumber()) {
         double d = value.toNumber(state);
         if (std::isfinite(d)) {
             product.appendString(value.toString(state));
-            return true;
+        } else {
+            product.appendString(strings->null.string());
         }
-        product.appendString(strings->null.string());
-        return true;
-    }
-    if (value.isBigInt()) {
+    } else if (value.isBigInt()) {
         ErrorObject::throwBuiltinError(state, ErrorCode::TypeError, "Could not serialize a BigInt");
-    }
-    if (value.isObject() && !value.isCallable()) {
+    } else {
+        ASSERT(value.isObject());
         if (value.asObject()->isArray(state)) {
             builtinJSONStringifyJA(state, value.asObject(), strings, replacerFunc, stack, indent, gap, propertyListTouched, propertyList, product);
         } else {
             builtinJSONStringifyJO(state, value.asObject(), strings, replacerFunc, stack, indent, gap, propertyListTouched, propertyList, product);
         }
-        return true;
     }
-
-    return false;
 }
 
 // https://www.ecma-international.org/ecma-262/6.0/#sec-serializejsonarray
 static void builtinJSONStringifyJA(ExecutionState& state, Object* obj,
                                    StaticStrings* strings, Value replacerFunc, ValueVectorWithInlineStorage& stack,
                                    String* indent, String* gap, bool propertyListTouched, ValueVectorWithInlineStorage& propertyList,
-                                   LargeStringBuilder& product)
+                                   ChunkedStringBuilder& product)
 {
     // 1
     for (size_t i = 0; i < stack.size(); i++) {
@@ -447,8 +857,19 @@ static void builtinJSONStringifyJA(ExecutionState& state, Object* obj,
             product.appendString(seperator);
         }
 
-        bool strP = builtinJSONStringifyStr(state, Value(index), obj, strings, replacerFunc, stack, indent, gap, propertyListTouched, propertyList, product);
-        if (!strP) {
+        Value element;
+        if (obj->isArrayObject()) {
+            // reads elements of fast mode arrays without [[Get]]
+            element = obj->getIndexedProperty(state, Value(index)).value(state, obj);
+            if (UNLIKELY(element.isObject() || element.isBigInt() || !replacerFunc.isUndefined())) {
+                element = builtinJSONStringifyResolveValue(state, Value(index), obj, element, strings, replacerFunc);
+            }
+        } else {
+            element = builtinJSONStringifyPropertyValue(state, Value(index), obj, strings, replacerFunc);
+        }
+        if (builtinJSONStringifyIsSerializable(element)) {
+            builtinJSONStringifyValue(state, element, strings, replacerFunc, stack, indent, gap, propertyListTouched, propertyList, product);
+        } else {
             product.appendString(strings->null.string());
         }
         index++;
@@ -470,7 +891,7 @@ static void builtinJSONStringifyJA(ExecutionState& state, Object* obj,
 // https://www.ecma-international.org/ecma-262/6.0/#sec-serializejsonobject
 static void builtinJSONStringifyJO(ExecutionState& state, Object* value,
                                    StaticStrings* strings, Value replacerFunc, ValueVectorWithInlineStorage& stack, String* indent,
-                                   String* gap, bool propertyListTouched, ValueVectorWithInlineStorage& propertyList, LargeStringBuilder& product)
+                                   String* gap, bool propertyListTouched, ValueVectorWithInlineStorage& propertyList, ChunkedStringBuilder& product)
 {
     // 1
     for (size_t i = 0; i < stack.size(); i++) {
@@ -487,46 +908,77 @@ static void builtinJSONStringifyJO(ExecutionState& state, Object* value,
     newIndent.appendString(indent);
     newIndent.appendString(gap);
     indent = newIndent.finalize(&state);
-    // 5, 6
-    ValueVectorWithInlineStorage k;
-    if (propertyListTouched) {
-        k = propertyList;
-    } else {
-        k = Object::enumerableOwnProperties(state, value, EnumerableOwnPropertiesType::Key);
-    }
-
     // 7 ~ 9
     bool first = true;
-    size_t len = k.size();
     String* seperator = strings->asciiTable[(size_t)','].string();
+    auto appendSeperator = [&]() {
+        if (first) {
+            if (gap->length()) {
+                product.appendChar('\n');
+                product.appendString(indent);
+                StringBuilder seperatorBuilder;
+                seperatorBuilder.appendChar(',');
+                seperatorBuilder.appendChar('\n');
+                seperatorBuilder.appendString(indent);
+                seperator = seperatorBuilder.finalize(&state);
+            }
+            first = false;
+        } else {
+            product.appendString(seperator);
+        }
+    };
 
     product.appendChar('{');
-    LargeStringBuilder subProduct;
-    for (size_t i = 0; i < len; i++) {
-        auto strP = builtinJSONStringifyStr(state, k[i], value, strings, replacerFunc, stack, indent, gap, propertyListTouched, propertyList, subProduct);
-        if (strP) {
-            if (first) {
-                if (gap->length()) {
-                    product.appendChar('\n');
-                    product.appendString(indent);
-                    StringBuilder seperatorBuilder;
-                    seperatorBuilder.appendChar(',');
-                    seperatorBuilder.appendChar('\n');
-                    seperatorBuilder.appendString(indent);
-                    seperator = seperatorBuilder.finalize(&state);
+
+    JSONStringifyShape* shape = nullptr;
+    if (!propertyListTouched && replacerFunc.isUndefined()) {
+        shape = state.context()->vmInstance()->jsonStringifyShapeCache()->shape(state, value);
+    }
+
+    if (shape) {
+        // plain object. keys and pre-quoted keys come from the shape and values are read from the slots directly
+        for (size_t i = 0; i < shape->m_properties.size(); i++) {
+            const JSONStringifyShape::Property& property = shape->m_properties[i];
+            Value propertyValue;
+            if (LIKELY(JSONStringifyShapeCache::hasShape(value, shape))) {
+                propertyValue = value->uncheckedGetOwnDataProperty(property.m_index);
+                if (UNLIKELY(propertyValue.isObject() || propertyValue.isBigInt())) {
+                    propertyValue = builtinJSONStringifyResolveValue(state, property.m_key, value, propertyValue, strings, replacerFunc);
                 }
-                first = false;
             } else {
-                product.appendString(seperator);
+                // toJSON of a previous value modified the object
+                propertyValue = builtinJSONStringifyPropertyValue(state, property.m_key, value, strings, replacerFunc);
+            }
+            if (builtinJSONStringifyIsSerializable(propertyValue)) {
+                appendSeperator();
+                product.appendString(property.m_quotedKey);
+                if (gap->length() != 0) {
+                    product.appendChar(' ');
+                }
+                builtinJSONStringifyValue(state, propertyValue, strings, replacerFunc, stack, indent, gap, propertyListTouched, propertyList, product);
             }
+        }
+    } else {
+        // 5, 6
+        ValueVectorWithInlineStorage k;
+        if (propertyListTouched) {
+            k = propertyList;
+        } else {
+            k = Object::enumerableOwnProperties(state, value, EnumerableOwnPropertiesType::Key);
+        }
 
-            builtinJSONStringifyQuote(state, k[i], product);
-            product.appendChar(':');
-            if (gap->length() != 0) {
-                product.appendChar(' ');
+        size_t len = k.size();
+        for (size_t i = 0; i < len; i++) {
+            Value propertyValue = builtinJSONStringifyPropertyValue(state, k[i], value, strings, replacerFunc);
+            if (builtinJSONStringifyIsSerializable(propertyValue)) {
+                appendSeperator();
+                builtinJSONStringifyQuote(state, k[i], product);
+                product.appendChar(':');
+                if (gap->length() != 0) {
+                    product.appendChar(' ');
+                }
+                builtinJSONStringifyValue(state, propertyValue, strings, replacerFunc, stack, indent, gap, propertyListTouched, propertyList, product);
             }
-            product.appendStringBuilder(subProduct);
-            subProduct.clear();
         }
     }
 
@@ -544,7 +996,7 @@ static void builtinJSONStringifyJO(ExecutionState& state, Object* value,
 }
 
 // https://www.ecma-international.org/ecma-262/6.0/#sec-quotejsonstring
-static void builtinJSONStringifyQuote(ExecutionState& state, String* value, LargeStringBuilder& product)
+static void builtinJSONStringifyQuote(ExecutionState& state, String* value, ChunkedStringBuilder& product)
 {
     bool allNormalChar = true;
     auto bad = value->bufferAccessData();
@@ -602,37 +1054,34 @@ static void builtinJSONStringifyQuote(ExecutionState& state, String* value, Larg
         return;
     }
 
-    bool allLatin1 = true;
-    std::basic_string<char16_t> buffer;
-    buffer.reserve(bad.length);
-    buffer.push_back(u'"');
+    product.appendChar(u'"');
     for (size_t i = 0; i < bad.length; ++i) {
         char16_t c = bad.charAt(i);
         switch (c) {
         case u'\"':
         case u'\\':
-            buffer.push_back(u'\\');
-            buffer.push_back(c);
+            product.appendChar(u'\\');
+            product.appendChar(c);
             break;
         case u'\b':
-            buffer.push_back(u'\\');
-            buffer.push_back(u'b');
+            product.appendChar(u'\\');
+            product.appendChar(u'b');
             break;
         case u'\f':
-            buffer.push_back(u'\\');
-            buffer.push_back(u'f');
+            product.appendChar(u'\\');
+            product.appendChar(u'f');
             break;
         case u'\n':
-            buffer.push_back(u'\\');
-            buffer.push_back(u'n');
+            product.appendChar(u'\\');
+            product.appendChar(u'n');
             break;
         case u'\r':
-            buffer.push_back(u'\\');
-            buffer.push_back(u'r');
+            product.appendChar(u'\\');
+            product.appendChar(u'r');
             break;
         case u'\t':
-            buffer.push_back(u'\\');
-            buffer.push_back(u't');
+            product.appendChar(u'\\');
+            product.appendChar(u't');
             break;
         case 0:
         case 1:
@@ -661,32 +1110,73 @@ static void builtinJSONStringifyQuote(ExecutionState& state, String* value, Larg
         case 29:
         case 30:
         case 31:
-            buffer.push_back(u'\\');
-            buffer.push_back(u'u');
-            codePointTo4digitString(c, buffer);
+            product.appendChar(u'\\');
+            product.appendChar(u'u');
+            codePointTo4digitString(c, product);
             break;
         default:
-            if (c > 255) {
-                allLatin1 = false;
-            }
-            buffer.push_back(c);
+            product.appendChar(c);
         }
     }
-    buffer.push_back(u'"');
-    if (allLatin1) {
-        product.appendString(String::fromLatin1(buffer.data(), buffer.length()));
-    } else {
-        product.appendString(new UTF16String(buffer.data(), buffer.length()));
-    }
+    product.appendChar(u'"');
 }
 
-static void builtinJSONStringifyQuote(ExecutionState& state, Value value, LargeStringBuilder& product)
+static void builtinJSONStringifyQuote(ExecutionState& state, Value value, ChunkedStringBuilder& product)
 {
     String* str = value.toString(state);
     builtinJSONStringifyQuote(state, str, product);
 }
 
-Value JSON::stringify(ExecutionState& state, Value value, Value replacer, Value space)
+JSONStringifyShape* JSONStringifyShapeCache::shape(ExecutionState& state, Object* obj)
+{
+    if (obj->hasOwnEnumeration() || !obj->isInlineCacheable()) {
+        return nullptr;
+    }
+
+    ObjectStructure* structure = obj->structure();
+    Entry& e = entry(structure);
+    if (LIKELY(e.m_structure == structure)) {
+        return e.m_shape;
+    }
+
+    e.m_shape = createShape(state, structure);
+    e.m_structure = structure;
+    return e.m_shape;
+}
+
+bool JSONStringifyShapeCache::hasShape(Object* obj, JSONStringifyShape* shape)
+{
+    return obj->structure() == shape->m_structure;
+}
+
+JSONStringifyShape* JSONStringifyShapeCache::createShape(ExecutionState& state, ObjectStructure* structure)
+{
+    // index keys are serialized before other keys in ascending order, not in the order of the structure
+    if (structure->hasIndexPropertyName()) {
+        return nullptr;
+    }
+
+    JSONStringifyShape* shape = new JSONStringifyShape(structure);
+    size_t count = structure->propertyCount();
+    for (size_t i = 0; i < count; i++) {
+        const ObjectStructureItem& item = structure->readProperty(i);
+        if (item.m_propertyName.isSymbol() || !item.m_descriptor.isEnumerable()) {
+            continue;
+        }
+        if (!item.m_descriptor.isPlainDataProperty()) {
+            return nullptr;
+        }
+
+        String* key = item.m_propertyName.plainString();
+        ChunkedStringBuilder quotedKey;
+        builtinJSONStringifyQuote(state, key, quotedKey);
+        quotedKey.appendChar(':');
+        shape->m_properties.pushBack(JSONStringifyShape::Property({ i, key, quotedKey.finalize(&state) }));
+    }
+    return shape;
+}
+
+static bool builtinJSONStringify(ExecutionState& state, Value value, Value replacer, Value space, ChunkedStringBuilder& product)
 {
     auto strings = &state.context()->staticStrings();
 
@@ -767,11 +1257,31 @@ Value JSON::stringify(ExecutionState& state, Value value, Value replacer, Value
     Object* wrapper = new Object(state);
     // 10
     wrapper->defineOwnProperty(state, ObjectPropertyName(state, String::emptyString), ObjectPropertyDescriptor(value, ObjectPropertyDescriptor::AllPresent));
-    LargeStringBuilder product;
-    auto ret = builtinJSONStringifyStr(state, String::emptyString, wrapper, strings, replacerFunc, stack, indent, gap, propertyListTouched, propertyList, product);
-    if (ret) {
+    value = builtinJSONStringifyPropertyValue(state, String::emptyString, wrapper, strings, replacerFunc);
+    if (!builtinJSONStringifyIsSerializable(value)) {
+        return false;
+    }
+    builtinJSONStringifyValue(state, value, strings, replacerFunc, stack, indent, gap, propertyListTouched, propertyList, product);
+    return true;
+}
+
+Value JSON::stringify(ExecutionState& state, Value value, Value replacer, Value space)
+{
+    ChunkedStringBuilder product;
+    if (builtinJSONStringify(state, value, replacer, space, product)) {
         return product.finalize(&state);
     }
     return Value();
 }
+
+bool JSON::stringify(ExecutionState& state, Value value, Value replacer, Value space, StringifySink sink, void* data)
+{
+    ChunkedStringBuilder product;
+    product.setSegmentSink(sink, data);
+    if (builtinJSONStringify(state, value, replacer, space, product)) {
+        product.finalize();
+        return true;
+    }
+    return false;
+}
 } // namespace Escargot
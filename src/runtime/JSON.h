@@ -25,6 +25,225 @@
 namespace Escargot {
 
 class ExecutionState;
+class String;
+class Object;
+class ObjectStructure;
+
+// builds values from the events of a JSON parser (rapidjson SAX handler interface)
+// values of unfinished objects and arrays are kept on a stack, object members as key, value pairs
+// keys are atomized, and the structure built for a key sequence is reused for later objects with the same keys
+class JSONValueBuilder {
+public:
+    explicit JSONValueBuilder(ExecutionState* state = nullptr)
+        : m_state(state)
+    {
+    }
+
+    void setState(ExecutionState* state)
+    {
+        m_state = state;
+    }
+
+    bool Null()
+    {
+        m_stack.pushBack(Value(Value::Null));
+        return true;
+    }
+
+    bool Bool(bool b)
+    {
+        m_stack.pushBack(Value(b));
+        return true;
+    }
+
+    bool Int(int i)
+    {
+        m_stack.pushBack(Value(i));
+        return true;
+    }
+
+    bool Uint(unsigned i)
+    {
+        m_stack.pushBack(Value(i));
+        return true;
+    }
+
+    bool Int64(int64_t i)
+    {
+        m_stack.pushBack(Value(i));
+        return true;
+    }
+
+    bool Uint64(uint64_t i)
+    {
+        m_stack.pushBack(Value(i));
+        return true;
+    }
+
+    bool Double(double d)
+    {
+        m_stack.pushBack(Value(Value::DoubleToIntConvertibleTestNeeds, d));
+        return true;
+    }
+
+    bool RawNumber(const char16_t* str, unsigned length, bool copy)
+    {
+        RELEASE_ASSERT_NOT_REACHED();
+        return false;
+    }
+
+    bool String(const char16_t* str, unsigned length, bool copy);
+
+    bool Key(const char16_t* str, unsigned length, bool copy);
+
+    bool StartObject()
+    {
+        return true;
+    }
+
+    bool EndObject(unsigned memberCount);
+
+    bool StartArray()
+    {
+        return true;
+    }
+
+    bool EndArray(unsigned elementCount);
+
+    Value result() const
+    {
+        ASSERT(m_stack.size() == 1);
+        return m_stack[0];
+    }
+
+    void clear()
+    {
+        m_stack.clear();
+        m_structureCache.clear();
+    }
+
+private:
+    Object* createObjectWithCachedStructure(size_t base, unsigned memberCount, size_t keysHash);
+
+    typedef HashMap<size_t, ObjectStructure*, std::hash<size_t>, std::equal_to<size_t>,
+                    GCUtil::gc_malloc_allocator<std::pair<size_t const, ObjectStructure*>>>
+        StructureCache;
+
+    ExecutionState* m_state;
+    ValueVector m_stack;
+    // hash of key sequence -> structure of an object built from those keys
+    StructureCache m_structureCache;
+};
+
+// parses JSON text given in chunks of UTF-8 bytes
+// each chunk is parsed when it is given, values are built as soon as their tokens are complete
+// and only an unfinished token is kept between chunks
+// the parser must not be used after it threw an error
+class JSONParser : public gc {
+public:
+    JSONParser();
+
+    void parseChunk(ExecutionState& state, const char* src, size_t length);
+    // parses the unfinished token if any and returns the parsed value
+    // the parser can be used for the next text after this
+    Value finish(ExecutionState& state);
+
+private:
+    enum class Expect : uint8_t {
+        Value,
+        ValueOrArrayEnd,
+        KeyOrObjectEnd,
+        Key,
+        Colon,
+        CommaOrEnd,
+        End,
+    };
+
+    enum class TokenType : uint8_t {
+        None,
+        String,
+        Key,
+        Number,
+        Literal,
+    };
+
+    void startValue(ExecutionState& state, char c);
+    void endValue();
+    void endContainer(ExecutionState& state, char c);
+    void endToken(ExecutionState& state);
+    void endStringToken(ExecutionState& state, bool isKey);
+    void reset();
+    void throwSyntaxError(ExecutionState& state, const char* message);
+
+    JSONValueBuilder m_builder;
+    Vector<char, GCUtil::gc_malloc_atomic_allocator<char>> m_containers;
+    Vector<size_t, GCUtil::gc_malloc_atomic_allocator<size_t>> m_memberCounts;
+    Vector<char, GCUtil::gc_malloc_atomic_allocator<char>> m_token;
+    Expect m_expect;
+    TokenType m_tokenType;
+    bool m_escaped;
+};
+
+// layout of plain objects of one ObjectStructure that JSON.stringify can serialize without [[Get]]
+// every enumerable string keyed property is a plain data property, and keys are kept in the order of serialization
+struct JSONStringifyShape : public gc {
+    struct Property {
+        size_t m_index;
+        String* m_key;
+        // "key": with the key quoted and escaped
+        String* m_quotedKey;
+    };
+
+    explicit JSONStringifyShape(ObjectStructure* structure)
+        : m_structure(structure)
+    {
+    }
+
+    ObjectStructure* m_structure;
+    Vector<Property, GCUtil::gc_malloc_allocator<Property>> m_properties;
+};
+
+// VM-wide cache of JSONStringifyShape indexed by ObjectStructure
+// entries do not keep structures or shapes alive. the cache is cleared at the end of every GC
+class JSONStringifyShapeCache {
+public:
+    enum : size_t { CacheSize = 256 };
+
+    JSONStringifyShapeCache()
+    {
+        clear();
+    }
+
+    // returns nullptr if obj is not a plain object that the fast path can serialize
+    JSONStringifyShape* shape(ExecutionState& state, Object* obj);
+    // false when obj was modified after shape was taken
+    static bool hasShape(Object* obj, JSONStringifyShape* shape);
+
+    void clear()
+    {
+        for (size_t i = 0; i < CacheSize; i++) {
+            m_entries[i].m_structure = nullptr;
+        }
+    }
+
+private:
+    struct Entry {
+        ObjectStructure* m_structure;
+        // nullptr if objects of the structure cannot use the fast path
+        JSONStringifyShape* m_shape;
+    };
+
+    Entry& entry(ObjectStructure* structure)
+    {
+        size_t h = reinterpret_cast<size_t>(structure) >> 3;
+        h ^= h >> 11;
+        return m_entries[h & (CacheSize - 1)];
+    }
+
+    static JSONStringifyShape* createShape(ExecutionState& state, ObjectStructure* structure);
+
+    Entry m_entries[CacheSize];
+};
 
 class JSON {
 public:
@@ -32,6 +251,11 @@ public:
 
     static Value parse(ExecutionState& state, Value text, Value reviver);
     static Value stringify(ExecutionState& state, Value value, Value replacer, Value space);
+
+    // passes the result to sink in segments instead of building the whole string
+    // returns false if value is not serializable (JSON.stringify returns undefined)
+    typedef void (*StringifySink)(String* segment, void* data);
+    static bool stringify(ExecutionState& state, Value value, Value replacer, Value space, StringifySink sink, void* data);
 };
 } // namespace Escargot
 #endif
@@ -41,7 +41,7 @@ void* MapObject::operator new(size_t size)
     if (!typeInited) {
         GC_word obj_bitmap[GC_BITMAP_SIZE(MapObject)] = { 0 };
         Object::fillGCDescriptor(obj_bitmap);
-        GC_set_bit(obj_bitmap, GC_WORD_OFFSET(MapObject, m_storage));
+        MapObjectData::fillGCDescriptor(obj_bitmap, GC_WORD_OFFSET(MapObject, m_storage));
         descr = GC_make_descriptor(obj_bitmap, GC_WORD_LEN(MapObject));
         typeInited = true;
     }
@@ -50,85 +50,51 @@ void* MapObject::operator new(size_t size)
 
 void MapObject::clear(ExecutionState& state)
 {
-    for (size_t i = 0; i < m_storage.size(); i++) {
-        m_storage[i] = std::make_pair(Value(Value::EmptyValue), Value(Value::EmptyValue));
-    }
+    m_storage.clear();
 }
 
 size_t MapObject::size(ExecutionState& state)
 {
-    size_t siz = 0;
-    for (size_t i = 0; i < m_storage.size(); i++) {
-        Value existingKey = m_storage[i].first;
-        if (existingKey.isEmpty()) {
-            continue;
-        }
-        siz++;
-    }
-    return siz;
+    return m_storage.liveCount();
 }
 
 bool MapObject::deleteOperation(ExecutionState& state, const Value& key)
 {
-    for (size_t i = 0; i < m_storage.size(); i++) {
-        Value existingKey = m_storage[i].first;
-        if (existingKey.isEmpty()) {
-            continue;
-        }
-        if (existingKey.equalsToByTheSameValueZeroAlgorithm(state, key)) {
-            m_storage[i] = std::make_pair(Value(Value::EmptyValue), Value(Value::EmptyValue));
-            return true;
-        }
+    uint32_t idx = m_storage.find(state, key);
+    if (idx != MapObjectData::NotFound) {
+        m_storage.remove(idx);
+        return true;
     }
     return false;
 }
 
 Value MapObject::get(ExecutionState& state, const Value& key)
 {
-    for (size_t i = 0; i < m_storage.size(); i++) {
-        Value existingKey = m_storage[i].first;
-        if (existingKey.isEmpty()) {
-            continue;
-        }
-        if (existingKey.equalsToByTheSameValueZeroAlgorithm(state, key)) {
-            return m_storage[i].second;
-        }
+    uint32_t idx = m_storage.find(state, key);
+    if (idx != MapObjectData::NotFound) {
+        return m_storage[idx].second;
     }
     return Value();
 }
 
 bool MapObject::has(ExecutionState& state, const Value& key)
 {
-    for (size_t i = 0; i < m_storage.size(); i++) {
-        Value existingKey = m_storage[i].first;
-        if (existingKey.isEmpty()) {
-            continue;
-        }
-        if (existingKey.equalsToByTheSameValueZeroAlgorithm(state, key)) {
-            return true;
-        }
-    }
-    return false;
+    return m_storage.find(state, key) != MapObjectData::NotFound;
 }
 
 void MapObject::set(ExecutionState& state, const Value& key, const Value& value)
 {
-    for (size_t i = 0; i < m_storage.size(); i++) {
-        Value existingKey = m_storage[i].first;
-        if (existingKey.isEmpty()) {
-            continue;
-        }
-        if (existingKey.equalsToByTheSameValueZeroAlgorithm(state, key)) {
-            m_storage[i].second = value;
-            return;
-        }
+    uint32_t idx = m_storage.find(state, key);
+    if (idx != MapObjectData::NotFound) {
+        m_storage[idx].second = value;
+        return;
     }
 
     // If key is -0, let key be +0.
     if (key.isNumber() && key.asNumber() == 0 && std::signbit(key.asNumber())) {
-        m_storage.pushBack(std::make_pair(Value(0), value));
+        m_storage.add(std::make_pair(Value(0), value));
     } else {
-        m_storage.pushBack(std::make_pair(key, value));
+        m_storage.add(std::make_pair(key, value));
     }
 }
 
@@ -150,7 +116,7 @@ IteratorObject* MapObject::entries(ExecutionState& state)
 MapIteratorObject::MapIteratorObject(ExecutionState& state, MapObject* map, Type type)
     : IteratorObject(state, state.context()->globalObject()->mapIteratorPrototype())
     , m_map(map)
-    , m_iteratorIndex(0)
+    , m_cursor(map->m_storage.cursor())
     , m_type(type)
 {
 }
@@ -163,6 +129,7 @@ void* MapIteratorObject::operator new(size_t size)
         GC_word obj_bitmap[GC_BITMAP_SIZE(MapIteratorObject)] = { 0 };
         Object::fillGCDescriptor(obj_bitmap);
         GC_set_bit(obj_bitmap, GC_WORD_OFFSET(MapIteratorObject, m_map));
+        GC_set_bit(obj_bitmap, GC_WORD_OFFSET(MapIteratorObject, m_cursor) + (offsetof(OrderedHashTableCursor, m_transition) / sizeof(GC_word)));
         descr = GC_make_descriptor(obj_bitmap, GC_WORD_LEN(MapIteratorObject));
         typeInited = true;
     }
@@ -175,7 +142,6 @@ std::pair<Value, bool> MapIteratorObject::advance(ExecutionState& state)
     // Let index be the value of the [[MapNextIndex]] internal slot of O.
     // Let itemKind be the value of the [[MapIterationKind]] internal slot of O.
     MapObject* m = m_map;
-    size_t index = m_iteratorIndex;
     Type itemKind = m_type;
 
     // If m is undefined, return CreateIterResultObject(undefined, true).
@@ -185,13 +151,13 @@ std::pair<Value, bool> MapIteratorObject::advance(ExecutionState& state)
 
     // Let entries be the List that is the value of the [[MapData]] internal slot of m.
     // Repeat while index is less than the total number of elements of entries. The number of elements must be redetermined each time this method is evaluated.
-    while (index < m->m_storage.size()) {
+    // (entries may have been compacted since last call. synchronizeCursor relocates index into the current layout)
+    while (m->m_storage.synchronizeCursor(m_cursor)) {
         // Let e be the Record {[[Key]], [[Value]]} that is the value of entries[index].
-        auto e = m->m_storage[index];
+        auto e = m->m_storage[m_cursor.m_index];
         // Set index to index+1.
-        index++;
         // Set the [[MapNextIndex]] internal slot of O to index.
-        m_iteratorIndex = index;
+        m_cursor.m_index++;
 
         if (e.first.isEmpty()) {
             continue;
@@ -219,6 +185,7 @@ std::pair<Value, bool> MapIteratorObject::advance(ExecutionState& state)
 
     // Set the [[Map]] internal slot of O to undefined.
     m_map = nullptr;
+    m_cursor = OrderedHashTableCursor();
     // Return CreateIterResultObject(undefined, true).
     return std::make_pair(Value(), true);
 }
@@ -776,6 +776,9 @@ class Object : public PointerValue {
     friend struct ObjectRareData;
     friend class Template;
     friend class ObjectTemplate;
+    friend class JSONStringifyShapeCache;
+    friend class JSONValueBuilder;
+    friend class HeapSnapshot;
 
 public:
     explicit Object(ExecutionState& state);
@@ -1342,9 +1345,6 @@ protected:
     void markAsNonInlineCachable();
 
     void tryToShrinkFinalizers();
-
-    // redefine function used only for builtin installation
-    void redefineOwnProperty(ExecutionState& state, const ObjectPropertyName& P, const ObjectPropertyDescriptor& desc);
 };
 
 class DerivedObject : public Object {
@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) 2024-present Samsung Electronics Co., Ltd
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+ *  USA
+ */
+
+#include "Escargot.h"
+#include "runtime/OrderedHashTable.h"
+#include "runtime/BigInt.h"
+
+namespace Escargot {
+
+size_t OrderedHashTableTransition::adjustIndex(size_t index) const
+{
+    if (m_cleared) {
+        return 0;
+    }
+    // every removed entry placed before the cursor pulls it one slot forward
+    const uint32_t* begin = m_removedIndexes;
+    const uint32_t* end = begin + m_removedIndexCount;
+    return index - (std::lower_bound(begin, end, static_cast<uint32_t>(index)) - begin);
+}
+
+static ALWAYS_INLINE size_t mixHash(uint64_t h)
+{
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdULL;
+    h ^= h >> 33;
+    return static_cast<size_t>(h);
+}
+
+static size_t hashDoubleBySameValueZero(double d)
+{
+    if (std::isnan(d)) {
+        return 0;
+    }
+    // -0 and +0 are same key
+    if (d == 0) {
+        d = 0;
+    }
+    uint64_t bits;
+    memcpy(&bits, &d, sizeof(double));
+    return mixHash(bits);
+}
+
+size_t hashValueBySameValueZero(const Value& key)
+{
+    if (key.isNumber()) {
+        // int32 and double encoding of same number should be in same bucket
+        return hashDoubleBySameValueZero(key.asNumber());
+    }
+    if (key.isPointerValue()) {
+        PointerValue* p = key.asPointerValue();
+        if (p->isString()) {
+            return p->asString()->hashValue();
+        } else if (UNLIKELY(p->isBigInt())) {
+            return hashDoubleBySameValueZero(p->asBigInt()->toNumber());
+        }
+        return mixHash(reinterpret_cast<uintptr_t>(p));
+    }
+    return mixHash(static_cast<uint64_t>(key.payload()));
+}
+
+} // namespace Escargot
@@ -0,0 +1,277 @@
+/*
+ * Copyright (c) 2024-present Samsung Electronics Co., Ltd
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+ *  USA
+ */
+
+#ifndef __EscargotOrderedHashTable__
+#define __EscargotOrderedHashTable__
+
+#include "runtime/Value.h"
+
+namespace Escargot {
+
+// Records how entry indexes moved when an OrderedHashTable was compacted.
+// Cursors (iterators, forEach loops) keep a pointer to the transition that was current
+// when they last touched the table and replay every later compaction before reading
+// so that they keep visiting entries in insertion order.
+class OrderedHashTableTransition : public gc {
+public:
+    OrderedHashTableTransition()
+        : m_next(nullptr)
+        , m_removedIndexes(nullptr)
+        , m_removedIndexCount(0)
+        , m_cleared(false)
+    {
+    }
+
+    OrderedHashTableTransition* next() const
+    {
+        return m_next;
+    }
+
+    size_t adjustIndex(size_t index) const;
+
+private:
+    template <typename Entry, typename KeyAccessor>
+    friend class OrderedHashTable;
+
+    OrderedHashTableTransition* m_next;
+    // sorted positions (in the old layout) of entries removed by the compaction
+    uint32_t* m_removedIndexes;
+    size_t m_removedIndexCount;
+    bool m_cleared;
+};
+
+struct OrderedHashTableCursor {
+    OrderedHashTableCursor()
+        : m_index(0)
+        , m_transition(nullptr)
+    {
+    }
+
+    size_t m_index;
+    OrderedHashTableTransition* m_transition;
+};
+
+size_t hashValueBySameValueZero(const Value& key);
+
+// Insertion-ordered hash table used by Map and Set
+// Entries are kept in an array in insertion order and are chained into buckets by
+// the SameValueZero hash of their key. Deleted entries are left as tombstones
+// (empty key) and squeezed out when the table is rehashed.
+template <typename Entry, typename KeyAccessor>
+class OrderedHashTable {
+public:
+    enum : uint32_t { NotFound = std::numeric_limits<uint32_t>::max() };
+    enum : uint32_t { MinimumCapacity = 8 };
+
+    OrderedHashTable()
+        : m_entries(nullptr)
+        , m_index(nullptr)
+        , m_transition(nullptr)
+        , m_usedCount(0)
+        , m_liveCount(0)
+        , m_capacity(0)
+    {
+    }
+
+    static void fillGCDescriptor(GC_word* desc, size_t wordOffset)
+    {
+        GC_set_bit(desc, wordOffset + (offsetof(OrderedHashTable, m_entries) / sizeof(GC_word)));
+        GC_set_bit(desc, wordOffset + (offsetof(OrderedHashTable, m_index) / sizeof(GC_word)));
+        GC_set_bit(desc, wordOffset + (offsetof(OrderedHashTable, m_transition) / sizeof(GC_word)));
+    }
+
+    // number of used entry slots including tombstones
+    size_t size() const
+    {
+        return m_usedCount;
+    }
+
+    size_t liveCount() const
+    {
+        return m_liveCount;
+    }
+
+    Entry& operator[](const size_t idx)
+    {
+        ASSERT(idx < m_usedCount);
+        return m_entries[idx];
+    }
+
+    const Entry& operator[](const size_t idx) const
+    {
+        ASSERT(idx < m_usedCount);
+        return m_entries[idx];
+    }
+
+    uint32_t find(ExecutionState& state, const Value& key) const
+    {
+        if (!m_capacity) {
+            return NotFound;
+        }
+        uint32_t* heads = m_index;
+        uint32_t* chain = m_index + m_capacity;
+        uint32_t idx = heads[hashValueBySameValueZero(key) & (m_capacity - 1)];
+        while (idx != NotFound) {
+            Value existingKey = KeyAccessor::key(m_entries[idx]);
+            if (!existingKey.isEmpty() && existingKey.equalsToByTheSameValueZeroAlgorithm(state, key)) {
+                return idx;
+            }
+            idx = chain[idx];
+        }
+        return NotFound;
+    }
+
+    // caller should check there is no entry with same key
+    void add(const Entry& entry)
+    {
+        if (m_usedCount == m_capacity) {
+            // reuse the space of tombstones if they take up more than a half of the table
+            size_t newCapacity = m_capacity ? m_capacity : MinimumCapacity;
+            if (m_liveCount >= m_capacity / 2) {
+                newCapacity *= 2;
+            }
+            rehash(newCapacity);
+        }
+
+        uint32_t idx = m_usedCount++;
+        m_entries[idx] = entry;
+        link(idx);
+        m_liveCount++;
+    }
+
+    void remove(uint32_t idx)
+    {
+        ASSERT(idx < m_usedCount);
+        ASSERT(!Value(KeyAccessor::key(m_entries[idx])).isEmpty());
+        KeyAccessor::clear(m_entries[idx]);
+        m_liveCount--;
+
+        if (m_liveCount < m_capacity / 4 && m_capacity > MinimumCapacity) {
+            rehash(m_capacity / 2);
+        }
+    }
+
+    void clear()
+    {
+        if (m_transition && m_usedCount) {
+            m_transition->m_cleared = true;
+            m_transition = m_transition->m_next = new OrderedHashTableTransition();
+        }
+        if (m_entries) {
+            GCUtil::gc_malloc_allocator<Entry>().deallocate(m_entries, m_capacity);
+            GCUtil::gc_malloc_atomic_allocator<uint32_t>().deallocate(m_index, m_capacity * 2);
+        }
+        m_entries = nullptr;
+        m_index = nullptr;
+        m_usedCount = m_liveCount = m_capacity = 0;
+    }
+
+    OrderedHashTableCursor cursor()
+    {
+        OrderedHashTableCursor c;
+        if (!m_transition) {
+            m_transition = new OrderedHashTableTransition();
+        }
+        c.m_transition = m_transition;
+        return c;
+    }
+
+    // replays compactions made after the cursor has been synchronized last
+    // and returns whether cursor points a valid slot (may be a tombstone)
+    bool synchronizeCursor(OrderedHashTableCursor& c) const
+    {
+        while (UNLIKELY(c.m_transition->next() != nullptr)) {
+            c.m_index = c.m_transition->adjustIndex(c.m_index);
+            c.m_transition = c.m_transition->next();
+        }
+        return c.m_index < m_usedCount;
+    }
+
+private:
+    void link(uint32_t idx)
+    {
+        uint32_t* heads = m_index;
+        uint32_t* chain = m_index + m_capacity;
+        size_t bucket = hashValueBySameValueZero(KeyAccessor::key(m_entries[idx])) & (m_capacity - 1);
+        chain[idx] = heads[bucket];
+        heads[bucket] = idx;
+    }
+
+    void rehash(size_t newCapacity)
+    {
+        ASSERT(newCapacity >= m_liveCount);
+        ASSERT((newCapacity & (newCapacity - 1)) == 0);
+        RELEASE_ASSERT(newCapacity < NotFound);
+
+        Entry* oldEntries = m_entries;
+        uint32_t* oldIndex = m_index;
+        size_t oldCapacity = m_capacity;
+        size_t oldUsedCount = m_usedCount;
+
+        OrderedHashTableTransition* transition = nullptr;
+        size_t removedCount = oldUsedCount - m_liveCount;
+        if (m_transition && removedCount) {
+            transition = m_transition;
+            transition->m_removedIndexes = GCUtil::gc_malloc_atomic_allocator<uint32_t>().allocate(removedCount);
+            transition->m_removedIndexCount = removedCount;
+        }
+
+        m_entries = GCUtil::gc_malloc_allocator<Entry>().allocate(newCapacity);
+        m_index = GCUtil::gc_malloc_atomic_allocator<uint32_t>().allocate(newCapacity * 2);
+        m_capacity = newCapacity;
+        m_usedCount = 0;
+        std::fill(m_index, m_index + newCapacity, (uint32_t)NotFound);
+
+        size_t removedIndex = 0;
+        for (size_t i = 0; i < oldUsedCount; i++) {
+            if (Value(KeyAccessor::key(oldEntries[i])).isEmpty()) {
+                if (transition) {
+                    transition->m_removedIndexes[removedIndex++] = i;
+                }
+                continue;
+            }
+            uint32_t idx = m_usedCount++;
+            m_entries[idx] = oldEntries[i];
+            link(idx);
+        }
+        ASSERT(m_usedCount == m_liveCount);
+
+        if (transition) {
+            m_transition = transition->m_next = new OrderedHashTableTransition();
+        }
+
+        if (oldEntries) {
+            GCUtil::gc_malloc_allocator<Entry>().deallocate(oldEntries, oldCapacity);
+            GCUtil::gc_malloc_atomic_allocator<uint32_t>().deallocate(oldIndex, oldCapacity * 2);
+        }
+    }
+
+    Entry* m_entries;
+    // bucket heads followed by the chain links of each entry
+    uint32_t* m_index;
+    // null until the first cursor is created
+    OrderedHashTableTransition* m_transition;
+    uint32_t m_usedCount;
+    uint32_t m_liveCount;
+    uint32_t m_capacity;
+};
+
+} // namespace Escargot
+
+#endif
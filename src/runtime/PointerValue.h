@@ -160,6 +160,7 @@ class PointerValue : public gc {
     friend class Interpreter;
     friend class InterpreterSlowPath;
     friend class EncodedValue;
+    friend class HeapSnapshot;
 
 public:
     virtual ~PointerValue() {}
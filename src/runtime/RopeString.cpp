@@ -42,7 +42,15 @@ void* RopeString::operator new(size_t size, bool is8Bit)
     return GC_MALLOC_EXPLICITLY_TYPED(size, descr);
 }
 
-String* RopeString::createRopeString(String* lstr, String* rstr, ExecutionState* state)
+static RopeString* unflattenedRopeString(String* str)
+{
+    if (str->isRopeString() && !str->asRopeString()->wasFlattened()) {
+        return str->asRopeString();
+    }
+    return nullptr;
+}
+
+String* RopeString::concat(String* lstr, String* rstr)
 {
     size_t llen = lstr->length();
     if (llen == 0) {
@@ -71,10 +79,6 @@ String* RopeString::createRopeString(String* lstr, String* rstr, ExecutionState*
         }
     }
 
-    if (state && UNLIKELY((llen + rlen) > STRING_MAXIMUM_LENGTH)) {
-        ErrorObject::throwBuiltinError(*state, ErrorCode::RangeError, ErrorObject::Messages::String_InvalidStringLength);
-    }
-
     bool l8bit = lstr->has8BitContent();
     bool r8bit = rstr->has8BitContent();
     bool result8Bit = l8bit & r8bit;
@@ -83,9 +87,110 @@ String* RopeString::createRopeString(String* lstr, String* rstr, ExecutionState*
     rope->m_left = lstr;
     rope->m_bufferData.buffer = rstr;
     rope->m_bufferData.has8BitContent = result8Bit;
+
+    RopeString* lrope = unflattenedRopeString(lstr);
+    RopeString* rrope = unflattenedRopeString(rstr);
+    rope->m_depth = std::max(lrope ? lrope->m_depth : 0, rrope ? rrope->m_depth : 0) + 1;
     return rope;
 }
 
+String* RopeString::createRopeString(String* lstr, String* rstr, ExecutionState* state)
+{
+    if (state && UNLIKELY((lstr->length() + rstr->length()) > STRING_MAXIMUM_LENGTH)) {
+        ErrorObject::throwBuiltinError(*state, ErrorCode::RangeError, ErrorObject::Messages::String_InvalidStringLength);
+    }
+
+    String* result = concat(lstr, rstr);
+    RopeString* rope = unflattenedRopeString(result);
+    if (UNLIKELY(rope && rope->m_depth > ROPE_STRING_MAX_DEPTH)) {
+        return rope->rebalance();
+    }
+    return result;
+}
+
+// rope of depth n is balanced if its length is not less than Fibonacci(n + 2)
+struct BalancedRopeStringMinLength {
+    BalancedRopeStringMinLength()
+    {
+        value[0] = 1;
+        value[1] = 2;
+        for (size_t i = 2; i < ROPE_STRING_MAX_DEPTH + 2; i++) {
+            value[i] = value[i - 1] + value[i - 2];
+        }
+    }
+
+    uint64_t value[ROPE_STRING_MAX_DEPTH + 2];
+};
+
+static const BalancedRopeStringMinLength g_balancedRopeStringMinLength;
+
+static bool isBalancedRopeString(RopeString* rope)
+{
+    return rope->depth() <= ROPE_STRING_MAX_DEPTH && rope->length() >= g_balancedRopeStringMinLength.value[rope->depth()];
+}
+
+// forest[i] holds a balanced rope whose length is in [MinLength(i), MinLength(i + 1))
+// and ropes with higher index come first in the string
+void RopeString::addLeafToForest(String* str, String** forest)
+{
+    const uint64_t* minLength = g_balancedRopeStringMinLength.value;
+    String* tooShort = nullptr;
+    size_t i = 0;
+    size_t length = str->length();
+    for (; i < ROPE_STRING_MAX_DEPTH && length >= minLength[i + 1]; i++) {
+        if (forest[i]) {
+            tooShort = tooShort ? concat(forest[i], tooShort) : forest[i];
+            forest[i] = nullptr;
+        }
+    }
+
+    String* insertee = tooShort ? concat(tooShort, str) : str;
+    for (;; i++) {
+        if (forest[i]) {
+            insertee = concat(forest[i], insertee);
+            forest[i] = nullptr;
+        }
+        if (i == ROPE_STRING_MAX_DEPTH || insertee->length() < minLength[i + 1]) {
+            forest[i] = insertee;
+            return;
+        }
+    }
+}
+
+void RopeString::addToForest(String* str, String** forest)
+{
+    RopeString* rope = unflattenedRopeString(str);
+    if (rope && !isBalancedRopeString(rope)) {
+        addToForest(rope->left(), forest);
+        addToForest(rope->right(), forest);
+    } else {
+        addLeafToForest(str, forest);
+    }
+}
+
+// Fibonacci forest rebalancing from "Ropes: an Alternative to Strings" (Boehm et al.)
+// balanced subtrees are reused as they are, so a rope grown by appending
+// only pays for its unbalanced spine
+String* RopeString::rebalance()
+{
+    String* forest[ROPE_STRING_MAX_DEPTH + 1] = {};
+    addToForest(left(), forest);
+    addToForest(right(), forest);
+
+    String* result = nullptr;
+    for (size_t i = 0; i <= ROPE_STRING_MAX_DEPTH; i++) {
+        if (forest[i]) {
+            result = result ? concat(forest[i], result) : forest[i];
+        }
+    }
+
+    RopeString* rope = unflattenedRopeString(result);
+    if (UNLIKELY(rope && rope->m_depth > ROPE_STRING_MAX_DEPTH)) {
+        rope->flattenRopeString();
+    }
+    return result;
+}
+
 template <typename ResultType>
 void RopeString::flattenRopeStringWorker()
 {
@@ -140,38 +245,11 @@ void RopeString::flattenRopeString()
     }
 }
 
-static MAY_THREAD_LOCAL const RopeString* g_lastUsedString;
-static MAY_THREAD_LOCAL bool g_headOfCharAt = true;
-class RopeStringUsageChecker {
-public:
-    RopeStringUsageChecker()
-    {
-        m_headOfCharAt = g_headOfCharAt;
-        g_headOfCharAt = false;
-    }
-
-    ~RopeStringUsageChecker()
-    {
-        g_headOfCharAt = m_headOfCharAt;
-    }
-
-    bool isOftenUsed(const RopeString* rs)
-    {
-        auto old = g_lastUsedString;
-        if (m_headOfCharAt) {
-            g_lastUsedString = rs;
-        }
-        return rs == old;
-    }
-
-private:
-    bool m_headOfCharAt;
-};
-
 // worker for preventing too many recursive calls with RopeString
-static char16_t charAtWorker(size_t idx, const RopeString* self)
+static char16_t charAtWorker(size_t idx, const RopeString* self, size_t& walkCount)
 {
     while (true) {
+        walkCount++;
         size_t leftLength = self->left()->length();
         if (idx < leftLength) {
             if (self->left()->isRopeString() && !self->left()->asRopeString()->wasFlattened()) {
@@ -190,19 +268,150 @@ static char16_t charAtWorker(size_t idx, const RopeString* self)
     }
 }
 
+static MAY_THREAD_LOCAL const RopeString* g_lastReadRopeString;
+static MAY_THREAD_LOCAL size_t g_lastReadRopeStringWalkCount;
+
 char16_t RopeString::charAt(const size_t idx) const
 {
     if (wasFlattened()) {
         return bufferAccessData().charAt(idx);
     }
 
-    RopeStringUsageChecker checker;
+    if (g_lastReadRopeString != this) {
+        g_lastReadRopeString = this;
+        g_lastReadRopeStringWalkCount = 0;
+    }
+
+    size_t walkCount = 0;
+    char16_t result = charAtWorker(idx, this, walkCount);
 
-    if (checker.isOftenUsed(this)) {
-        return bufferAccessData().charAt(idx);
+    // flatten the rope once repeated reads on it have walked
+    // as many nodes as flattening would copy characters
+    g_lastReadRopeStringWalkCount += walkCount;
+    if (UNLIKELY(g_lastReadRopeStringWalkCount > length())) {
+        bufferAccessData();
+    }
+
+    return result;
+}
+
+static size_t findInLeaf(const StringBufferAccessData& leafData, size_t from, const StringBufferAccessData& needleData)
+{
+    if (leafData.length - from < needleData.length) {
+        return SIZE_MAX;
+    }
+
+    size_t result;
+    if (leafData.has8BitContent) {
+        const LChar* buffer = (const LChar*)leafData.bufferAs8Bit + from;
+        if (needleData.has8BitContent) {
+            result = StringKernels::find(buffer, leafData.length - from, (const LChar*)needleData.bufferAs8Bit, needleData.length);
+        } else {
+            result = StringKernels::find(buffer, leafData.length - from, needleData.bufferAs16Bit, needleData.length);
+        }
+    } else {
+        const char16_t* buffer = leafData.bufferAs16Bit + from;
+        if (needleData.has8BitContent) {
+            result = StringKernels::find(buffer, leafData.length - from, (const LChar*)needleData.bufferAs8Bit, needleData.length);
+        } else {
+            result = StringKernels::find(buffer, leafData.length - from, needleData.bufferAs16Bit, needleData.length);
+        }
+    }
+    return result == SIZE_MAX ? SIZE_MAX : result + from;
+}
+
+size_t RopeString::findWithoutFlattening(String* str, size_t pos) const
+{
+    ASSERT(!wasFlattened());
+    const size_t needleLength = str->length();
+    ASSERT(needleLength && pos < length() && needleLength <= length() - pos);
+
+    const auto& needleData = str->bufferAccessData();
+    const char16_t needleFirst = needleData.charAt(0);
+    const size_t lastStart = length() - needleLength;
+    for (RopeStringLeafCursor cursor(const_cast<RopeString*>(this), pos); !cursor.isAtEnd() && cursor.leafStart() <= lastStart; cursor.next()) {
+        const size_t leafStart = cursor.leafStart();
+        const auto& leafData = cursor.leaf()->bufferAccessData();
+        const size_t from = std::max(pos, leafStart) - leafStart;
+
+        size_t result = findInLeaf(leafData, from, needleData);
+        if (result != SIZE_MAX) {
+            return leafStart + result;
+        }
+
+        // matches crossing the end of this leaf
+        size_t i = leafData.length >= needleLength ? leafData.length - needleLength + 1 : 0;
+        for (i = std::max(i, from); i < leafData.length && leafStart + i <= lastStart; i++) {
+            if (leafData.charAt(i) == needleFirst && hasSubstringAtWithoutFlattening(str, leafStart + i)) {
+                return leafStart + i;
+            }
+        }
+    }
+
+    return SIZE_MAX;
+}
+
+bool RopeString::hasSubstringAtWithoutFlattening(String* str, size_t pos) const
+{
+    ASSERT(!wasFlattened());
+    const size_t len = str->length();
+    ASSERT(pos <= length() && len <= length() - pos);
+
+    const auto& data = str->bufferAccessData();
+    size_t compared = 0;
+    for (RopeStringLeafCursor cursor(const_cast<RopeString*>(this), pos); compared < len; cursor.next()) {
+        ASSERT(!cursor.isAtEnd());
+        const auto& leafData = cursor.leaf()->bufferAccessData();
+        size_t offset = pos + compared - cursor.leafStart();
+        size_t count = std::min(leafData.length - offset, len - compared);
+        if (!leafData.equalsSubstring(offset, data, compared, count)) {
+            return false;
+        }
+        compared += count;
     }
 
-    return charAtWorker(idx, this);
+    return true;
+}
+
+RopeStringLeafCursor::RopeStringLeafCursor(String* str, size_t index)
+    : m_leaf(nullptr)
+    , m_leafStart(0)
+    , m_pendingCount(0)
+{
+    while (RopeString* rope = unflattenedRopeString(str)) {
+        size_t leftLength = rope->left()->length();
+        if (index < leftLength) {
+            ASSERT(m_pendingCount <= ROPE_STRING_MAX_DEPTH);
+            m_pending[m_pendingCount++] = rope->right();
+            str = rope->left();
+        } else {
+            m_leafStart += leftLength;
+            index -= leftLength;
+            str = rope->right();
+        }
+    }
+    m_leaf = str;
+}
+
+void RopeStringLeafCursor::next()
+{
+    ASSERT(!isAtEnd());
+    m_leafStart += m_leaf->length();
+    if (!m_pendingCount) {
+        m_leaf = nullptr;
+        return;
+    }
+    descendToFirstLeaf(m_pending[--m_pendingCount]);
+}
+
+void RopeStringLeafCursor::descendToFirstLeaf(String* node)
+{
+    while (RopeString* rope = unflattenedRopeString(node)) {
+        ASSERT(m_pendingCount <= ROPE_STRING_MAX_DEPTH);
+        m_pending[m_pendingCount++] = rope->right();
+        node = rope->left();
+    }
+    m_leaf = node;
 }
 
 UTF8StringDataNonGCStd RopeString::toNonGCUTF8StringData(int options) const
@@ -32,6 +32,7 @@ public:
         : String()
     {
         m_left = String::emptyString;
+        m_depth = 0;
         m_bufferData.has8BitContent = true;
         m_bufferData.hasSpecialImpl = true;
         m_bufferData.length = 0;
@@ -42,6 +43,7 @@ public:
     // if (l+r).length() < ROPE_STRING_MIN_LENGTH
     // then create just normalString
     // provide ExecutionState if you need limit of string length(exception can be thrown only in ExecutionState area)
+    // the result is rebalanced when its depth exceeds ROPE_STRING_MAX_DEPTH
     static String* createRopeString(String* lstr, String* rstr, ExecutionState* state = nullptr);
 
     virtual UTF16StringData toUTF16StringData() const override;
@@ -80,8 +82,20 @@ public:
         return (String*)m_bufferData.buffer;
     }
 
+    // upper bound of the number of rope nodes above any leaf
+    size_t depth() const
+    {
+        ASSERT(!wasFlattened());
+        return m_depth;
+    }
+
     virtual char16_t charAt(const size_t idx) const override;
 
+    // String::find and String::hasSubstringAt for ropes
+    // these walk the leaves without flattening the rope
+    size_t findWithoutFlattening(String* str, size_t pos) const;
+    bool hasSubstringAtWithoutFlattening(String* str, size_t pos) const;
+
     void* operator new(size_t size, bool is8Bit);
     void* operator new[](size_t size) = delete;
 
@@ -100,8 +114,51 @@ protected:
     void flattenRopeString();
 
 private:
+    static String* concat(String* lstr, String* rstr);
+    static void addToForest(String* str, String** forest);
+    static void addLeafToForest(String* str, String** forest);
+    String* rebalance();
+
     String* m_left;
     // String* m_right; // Right String is stored in m_bufferAccessData.buffer if string is not flattened
+    size_t m_depth;
+};
+
+// Walks the leaves of a string in order, starting from the leaf which contains the given index
+// leaves are non-rope strings or flattened RopeStrings
+class RopeStringLeafCursor {
+    MAKE_STACK_ALLOCATED();
+
+public:
+    RopeStringLeafCursor(String* str, size_t index);
+
+    bool isAtEnd() const
+    {
+        return !m_leaf;
+    }
+
+    String* leaf() const
+    {
+        ASSERT(!isAtEnd());
+        return m_leaf;
+    }
+
+    // index of the first character of the current leaf
+    size_t leafStart() const
+    {
+        return m_leafStart;
+    }
+
+    void next();
+
+private:
+    void descendToFirstLeaf(String* node);
+
+    String* m_leaf;
+    size_t m_leafStart;
+    size_t m_pendingCount;
+    // right subtrees not visited yet
+    String* m_pending[ROPE_STRING_MAX_DEPTH + 1];
 };
 } // namespace Escargot
 
@@ -0,0 +1,349 @@
+/*
+ * Copyright (c) 2024-present Samsung Electronics Co., Ltd
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+ *  USA
+ */
+
+#include "Escargot.h"
+#include "SamplingProfiler.h"
+#include "runtime/Context.h"
+#include "runtime/VMInstance.h"
+#include "runtime/SandBox.h"
+#include "runtime/FunctionObject.h"
+#include "parser/Script.h"
+#include "parser/CodeBlock.h"
+#include "interpreter/ByteCode.h"
+
+namespace Escargot {
+
+MAY_THREAD_LOCAL size_t SamplingProfiler::g_safepointCountdown = SIZE_MAX;
+MAY_THREAD_LOCAL size_t SamplingProfiler::g_runningProfilerCount;
+
+SamplingProfiler::SamplingProfiler(uint32_t samplingIntervalInMicroseconds)
+    : m_samplingInterval(samplingIntervalInMicroseconds ? samplingIntervalInMicroseconds : (uint32_t)DefaultSamplingIntervalInMicroseconds)
+    , m_isRunning(false)
+    , m_sampleAtNextTick(false)
+    , m_safepointCountdownReload(64)
+    , m_startTime(0)
+    , m_endTime(0)
+    , m_lastCheckTime(0)
+    , m_lastSampleTime(0)
+    , m_root(nullptr)
+{
+    m_root = new Node(nullptr, 1, nullptr, String::fromASCII("(root)"), String::emptyString, nullptr);
+    m_nodes.pushBack(m_root);
+}
+
+void SamplingProfiler::start()
+{
+    ASSERT(!m_isRunning);
+    m_isRunning = true;
+    m_startTime = m_lastCheckTime = m_lastSampleTime = longTickCount();
+    g_runningProfilerCount++;
+    // let the next safepoint initialize the countdown and take the first sample
+    g_safepointCountdown = 1;
+    m_sampleAtNextTick = true;
+}
+
+void SamplingProfiler::stop()
+{
+    ASSERT(m_isRunning);
+    m_isRunning = false;
+    m_endTime = longTickCount();
+    ASSERT(g_runningProfilerCount);
+    g_runningProfilerCount--;
+}
+
+void SamplingProfiler::safepointReached(ExecutionState& state)
+{
+    SamplingProfiler* profiler = state.context()->vmInstance()->samplingProfiler();
+    if (profiler) {
+        profiler->tick(state);
+    } else {
+        // another VMInstance may be profiled on this thread
+        g_safepointCountdown = g_runningProfilerCount ? MaxSafepointCountdown : SIZE_MAX;
+    }
+}
+
+void SamplingProfiler::tick(ExecutionState& state)
+{
+    uint64_t now = longTickCount();
+    uint64_t elapsed = now - m_lastCheckTime;
+    m_lastCheckTime = now;
+
+    // aim at reading the clock about 4 times per interval
+    if (elapsed < m_samplingInterval / 4 && m_safepointCountdownReload < MaxSafepointCountdown) {
+        m_safepointCountdownReload *= 2;
+    } else if (elapsed > m_samplingInterval && m_safepointCountdownReload > 1) {
+        m_safepointCountdownReload /= 2;
+    }
+    g_safepointCountdown = m_safepointCountdownReload;
+
+    if (m_sampleAtNextTick || now - m_lastSampleTime >= m_samplingInterval) {
+        m_sampleAtNextTick = false;
+        takeSample(state, now);
+    }
+}
+
+void SamplingProfiler::takeSample(ExecutionState& state, uint64_t now)
+{
+    StackTraceDataOnStackVector frames;
+    SandBox::createStackTrace(frames, state);
+
+    Node* node = m_root;
+    ByteCodeBlock* leafBlock = nullptr;
+    size_t leafPosition = SIZE_MAX;
+    // frames are ordered from the innermost one
+    for (size_t i = frames.size(); i > 0; i--) {
+        StackTraceDataOnStack& frame = frames[i - 1];
+        if ((size_t)frame.loc.index == SIZE_MAX && (size_t)frame.loc.actualCodeBlock != SIZE_MAX) {
+            ByteCodeBlock* block = frame.loc.actualCodeBlock;
+            InterpretedCodeBlock* codeBlock = block->m_codeBlock;
+            node = findOrCreateChild(node, codeBlock, codeBlock->functionName().string(), codeBlock->script()->srcName(), state.context());
+            leafBlock = block;
+            leafPosition = frame.loc.byteCodePosition;
+        } else if (frame.callee) {
+            CodeBlock* codeBlock = frame.callee.value()->codeBlock();
+            String* url = codeBlock->isInterpretedCodeBlock() ? codeBlock->asInterpretedCodeBlock()->script()->srcName() : String::emptyString;
+            node = findOrCreateChild(node, codeBlock, frame.functionName, url, state.context());
+            leafBlock = nullptr;
+        }
+    }
+
+    node->m_hitCount++;
+    if (leafBlock) {
+        bool found = false;
+        for (size_t i = 0; i < node->m_positionTicks.size(); i++) {
+            PositionTick& tick = node->m_positionTicks[i];
+            if (tick.m_byteCodeBlock == leafBlock && tick.m_byteCodePosition == leafPosition) {
+                tick.m_count++;
+                found = true;
+                break;
+            }
+        }
+        if (!found) {
+            node->m_positionTicks.pushBack(PositionTick({ leafBlock, leafPosition, 1 }));
+        }
+    }
+
+    m_samples.pushBack(node->m_id);
+    m_timeDeltas.pushBack(static_cast<uint32_t>(now - m_lastSampleTime));
+    m_lastSampleTime = now;
+}
+
+SamplingProfiler::Node* SamplingProfiler::findOrCreateChild(Node* parent, CodeBlock* codeBlock, String* functionName, String* url, Context* context)
+{
+    for (size_t i = 0; i < parent->m_children.size(); i++) {
+        Node* child = parent->m_children[i];
+        if (child->m_codeBlock == codeBlock) {
+            return child;
+        }
+    }
+
+    Node* child = new Node(parent, m_nodes.size() + 1, codeBlock, functionName, url, context);
+    parent->m_children.pushBack(child);
+    m_nodes.pushBack(child);
+    return child;
+}
+
+static void appendJSONString(std::string& out, const std::string& str)
+{
+    out += '"';
+    for (size_t i = 0; i < str.length(); i++) {
+        unsigned char c = str[i];
+        if (c == '"' || c == '\\') {
+            out += '\\';
+            out += c;
+        } else if (c < 0x20) {
+            char buf[8];
+            snprintf(buf, sizeof(buf), "\\u%04x", c);
+            out += buf;
+        } else {
+            out += c;
+        }
+    }
+    out += '"';
+}
+
+static std::string functionNameForOutput(String* name)
+{
+    if (!name->length()) {
+        return "(anonymous)";
+    }
+    return name->toNonGCUTF8StringData();
+}
+
+// returns 1-based line and 0-based column of function start
+static ExtendedNodeLOC functionStartLOC(CodeBlock* codeBlock)
+{
+    if (!codeBlock || !codeBlock->isInterpretedCodeBlock()) {
+        return ExtendedNodeLOC(0, SIZE_MAX, 0);
+    }
+    InterpretedCodeBlock* cb = codeBlock->asInterpretedCodeBlock();
+    if (cb->isGlobalCodeBlock()) {
+        // script and eval code start at the first character of the source
+        return ExtendedNodeLOC(1, 0, 0);
+    }
+    ExtendedNodeLOC loc = cb->functionStart();
+    loc.line -= cb->script()->originSourceLineOffset();
+    return loc;
+}
+
+void SamplingProfiler::outputChromeCPUProfile(std::string& out)
+{
+    ByteCodeLOCDataMap locMap;
+    // DevTools tells sources apart by scriptId
+    // scriptId 0 is for nodes without script (root and native functions)
+    std::unordered_map<Script*, size_t> scriptIds;
+
+    out += "{\"nodes\":[";
+    for (size_t i = 0; i < m_nodes.size(); i++) {
+        Node* node = m_nodes[i];
+        ExtendedNodeLOC loc = functionStartLOC(node->m_codeBlock);
+        if (i) {
+            out += ',';
+        }
+        out += "{\"id\":" + std::to_string(node->m_id);
+        out += ",\"callFrame\":{\"functionName\":";
+        appendJSONString(out, functionNameForOutput(node->m_functionName));
+        size_t scriptId = 0;
+        if (node->m_codeBlock && node->m_codeBlock->isInterpretedCodeBlock()) {
+            Script* script = node->m_codeBlock->asInterpretedCodeBlock()->script();
+            auto iter = scriptIds.find(script);
+            if (iter == scriptIds.end()) {
+                scriptId = scriptIds.size() + 1;
+                scriptIds.insert(std::make_pair(script, scriptId));
+            } else {
+                scriptId = iter->second;
+            }
+        }
+        out += ",\"scriptId\":\"" + std::to_string(scriptId) + "\",\"url\":";
+        appendJSONString(out, node->m_url->toNonGCUTF8StringData());
+        // callFrame location is 0-based
+        out += ",\"lineNumber\":" + std::to_string((int64_t)loc.line - 1);
+        out += ",\"columnNumber\":" + std::to_string((int64_t)loc.column);
+        out += "},\"hitCount\":" + std::to_string(node->m_hitCount);
+
+        if (node->m_children.size()) {
+            out += ",\"children\":[";
+            for (size_t j = 0; j < node->m_children.size(); j++) {
+                if (j) {
+                    out += ',';
+                }
+                out += std::to_string(node->m_children[j]->m_id);
+            }
+            out += ']';
+        }
+
+        if (node->m_positionTicks.size()) {
+            // merge ticks of bytecode positions on the same line
+            std::map<size_t, size_t> lineTicks;
+            for (size_t j = 0; j < node->m_positionTicks.size(); j++) {
+                PositionTick& tick = node->m_positionTicks[j];
+                ByteCodeBlock* block = tick.m_byteCodeBlock;
+                ByteCodeLOCData* locData;
+                auto iter = locMap.find(block);
+                if (iter == locMap.end()) {
+                    locData = new ByteCodeLOCData();
+                    locMap.insert(std::make_pair(block, locData));
+                } else {
+                    locData = iter->second;
+                }
+                ExtendedNodeLOC tickLoc = block->computeNodeLOCFromByteCode(node->m_context, tick.m_byteCodePosition, block->m_codeBlock, locData);
+                if (tickLoc.line != SIZE_MAX) {
+                    lineTicks[tickLoc.line] += tick.m_count;
+                }
+            }
+
+            out += ",\"positionTicks\":[";
+            for (auto iter = lineTicks.begin(); iter != lineTicks.end(); iter++) {
+                if (iter != lineTicks.begin()) {
+                    out += ',';
+                }
+                out += "{\"line\":" + std::to_string(iter->first) + ",\"ticks\":" + std::to_string(iter->second) + "}";
+            }
+            out += ']';
+        }
+        out += '}';
+    }
+
+    out += "],\"startTime\":" + std::to_string(m_startTime);
+    out += ",\"endTime\":" + std::to_string(m_endTime);
+    out += ",\"samples\":[";
+    for (size_t i = 0; i < m_samples.size(); i++) {
+        if (i) {
+            out += ',';
+        }
+        out += std::to_string(m_samples[i]);
+    }
+    out += "],\"timeDeltas\":[";
+    for (size_t i = 0; i < m_timeDeltas.size(); i++) {
+        if (i) {
+            out += ',';
+        }
+        out += std::to_string(m_timeDeltas[i]);
+    }
+    out += "]}";
+
+    for (auto iter = locMap.begin(); iter != locMap.end(); iter++) {
+        delete iter->second;
+    }
+}
+
+void SamplingProfiler::outputFoldedStacks(std::string& out)
+{
+    std::vector<Node*> path;
+    for (size_t i = 0; i < m_nodes.size(); i++) {
+        Node* node = m_nodes[i];
+        if (!node->m_hitCount || node == m_root) {
+            continue;
+        }
+
+        path.clear();
+        for (Node* n = node; n != m_root; n = n->m_parent) {
+            path.push_back(n);
+        }
+
+        // function (url:line:column);...;leaf count
+        for (size_t j = path.size(); j > 0; j--) {
+            Node* n = path[j - 1];
+            out += functionNameForOutput(n->m_functionName);
+            if (n->m_url->length()) {
+                ExtendedNodeLOC loc = functionStartLOC(n->m_codeBlock);
+                out += " (" + n->m_url->toNonGCUTF8StringData() + ":" + std::to_string(loc.line) + ":" + std::to_string(loc.column + 1) + ")";
+            } else {
+                out += " [native]";
+            }
+            out += j > 1 ? ';' : ' ';
+        }
+        out += std::to_string(node->m_hitCount);
+        out += '\n';
+    }
+}
+
+std::string SamplingProfiler::output(OutputFormat format)
+{
+    std::string out;
+    if (format == ChromeCPUProfile) {
+        outputChromeCPUProfile(out);
+    } else {
+        ASSERT(format == FoldedStacks);
+        outputFoldedStacks(out);
+    }
+    return out;
+}
+
+} // namespace Escargot
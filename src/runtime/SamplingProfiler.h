@@ -0,0 +1,132 @@
+/*
+ * Copyright (c) 2024-present Samsung Electronics Co., Ltd
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+ *  USA
+ */
+
+#ifndef __EscargotSamplingProfiler__
+#define __EscargotSamplingProfiler__
+
+#include "util/Vector.h"
+
+namespace Escargot {
+
+class ByteCodeBlock;
+class CodeBlock;
+class Context;
+class ExecutionState;
+class String;
+
+// Sampling cpu profiler of a VMInstance
+// The interpreter counts down a thread-local counter at every safepoint (function entry and jump).
+// When it reaches zero, the profiler reads the clock and records the current ExecutionState chain
+// if the sampling interval has elapsed. The reload value of the counter is adjusted so that
+// the clock is read only a few times per interval.
+// The first safepoint after start is always sampled, so even a run shorter than the interval has a sample.
+// Samples are merged into a call tree and exported as Chrome .cpuprofile or folded stacks
+class SamplingProfiler : public gc {
+public:
+    enum OutputFormat {
+        ChromeCPUProfile,
+        FoldedStacks,
+    };
+
+    enum : uint32_t { DefaultSamplingIntervalInMicroseconds = 1000 };
+    enum : size_t { MaxSafepointCountdown = 1 << 16 };
+
+    explicit SamplingProfiler(uint32_t samplingIntervalInMicroseconds);
+
+    static ALWAYS_INLINE bool countDownSafepoint()
+    {
+        return UNLIKELY(--g_safepointCountdown == 0);
+    }
+    static NEVER_INLINE void safepointReached(ExecutionState& state);
+
+    void start();
+    void stop();
+
+    bool isRunning() const
+    {
+        return m_isRunning;
+    }
+
+    size_t sampleCount() const
+    {
+        return m_samples.size();
+    }
+
+    std::string output(OutputFormat format);
+
+private:
+    struct PositionTick {
+        ByteCodeBlock* m_byteCodeBlock;
+        size_t m_byteCodePosition;
+        size_t m_count;
+    };
+
+    struct Node : public gc {
+        Node(Node* parent, uint32_t id, CodeBlock* codeBlock, String* functionName, String* url, Context* context)
+            : m_parent(parent)
+            , m_codeBlock(codeBlock)
+            , m_functionName(functionName)
+            , m_url(url)
+            , m_context(context)
+            , m_id(id)
+            , m_hitCount(0)
+        {
+        }
+
+        Node* m_parent;
+        CodeBlock* m_codeBlock;
+        String* m_functionName;
+        String* m_url;
+        Context* m_context;
+        uint32_t m_id;
+        size_t m_hitCount;
+        Vector<Node*, GCUtil::gc_malloc_allocator<Node*>> m_children;
+        // self samples by bytecode position. mapped to source lines on output
+        Vector<PositionTick, GCUtil::gc_malloc_allocator<PositionTick>> m_positionTicks;
+    };
+
+    void tick(ExecutionState& state);
+    void takeSample(ExecutionState& state, uint64_t now);
+    Node* findOrCreateChild(Node* parent, CodeBlock* codeBlock, String* functionName, String* url, Context* context);
+
+    void outputChromeCPUProfile(std::string& out);
+    void outputFoldedStacks(std::string& out);
+
+    static MAY_THREAD_LOCAL size_t g_safepointCountdown;
+    // number of profilers running on this thread
+    static MAY_THREAD_LOCAL size_t g_runningProfilerCount;
+
+    uint32_t m_samplingInterval;
+    bool m_isRunning;
+    bool m_sampleAtNextTick;
+    size_t m_safepointCountdownReload;
+    uint64_t m_startTime;
+    uint64_t m_endTime;
+    uint64_t m_lastCheckTime;
+    uint64_t m_lastSampleTime;
+    Node* m_root;
+    Vector<Node*, GCUtil::gc_malloc_allocator<Node*>> m_nodes;
+    // node id and time delta of each sample
+    Vector<uint32_t, GCUtil::gc_malloc_atomic_allocator<uint32_t>> m_samples;
+    Vector<uint32_t, GCUtil::gc_malloc_atomic_allocator<uint32_t>> m_timeDeltas;
+};
+
+} // namespace Escargot
+
+#endif
@@ -72,6 +72,11 @@ NEVER_INLINE void ScriptFunctionObject::generateByteCodeBlock(ExecutionState& st
     currentCodeSizeTotal += interpretedCodeBlock()->byteCodeBlock()->memoryAllocatedSize();
     auto cb = m_codeBlock->asInterpretedCodeBlock();
 
+    if (UNLIKELY(cb->isByteCodeBlockEvicted())) {
+        cb->setByteCodeBlockEvicted(false);
+        state.context()->vmInstance()->regeneratedByteCodeBlockCount()++;
+    }
+
     if (hasVTag(g_scriptFunctionObjectTag) && !cb->byteCodeBlock()->needsExtendedExecutionState()) {
         auto byteCb = cb->byteCodeBlock();
         size_t registerFileSize = byteCb->m_requiredTotalRegisterNumber;
@@ -41,7 +41,7 @@ void* SetObject::operator new(size_t size)
     if (!typeInited) {
         GC_word obj_bitmap[GC_BITMAP_SIZE(SetObject)] = { 0 };
         Object::fillGCDescriptor(obj_bitmap);
-        GC_set_bit(obj_bitmap, GC_WORD_OFFSET(SetObject, m_storage));
+        SetObjectData::fillGCDescriptor(obj_bitmap, GC_WORD_OFFSET(SetObject, m_storage));
         descr = GC_make_descriptor(obj_bitmap, GC_WORD_LEN(SetObject));
         typeInited = true;
     }
@@ -50,71 +50,41 @@ void* SetObject::operator new(size_t size)
 
 void SetObject::clear(ExecutionState& state)
 {
-    for (size_t i = 0; i < m_storage.size(); i++) {
-        m_storage[i] = Value(Value::EmptyValue);
-    }
+    m_storage.clear();
 }
 
 bool SetObject::deleteOperation(ExecutionState& state, const Value& key)
 {
-    for (size_t i = 0; i < m_storage.size(); i++) {
-        Value existingKey = m_storage[i];
-        if (existingKey.isEmpty()) {
-            continue;
-        }
-        if (existingKey.equalsToByTheSameValueZeroAlgorithm(state, key)) {
-            m_storage[i] = Value(Value::EmptyValue);
-            return true;
-        }
+    uint32_t idx = m_storage.find(state, key);
+    if (idx != SetObjectData::NotFound) {
+        m_storage.remove(idx);
+        return true;
     }
     return false;
 }
 
 void SetObject::add(ExecutionState& state, const Value& key)
 {
-    for (size_t i = 0; i < m_storage.size(); i++) {
-        Value existingKey = m_storage[i];
-        if (existingKey.isEmpty()) {
-            continue;
-        }
-        if (existingKey.equalsToByTheSameValueZeroAlgorithm(state, key)) {
-            return;
-        }
+    if (m_storage.find(state, key) != SetObjectData::NotFound) {
+        return;
     }
 
     // If key is -0, let key be +0.
     if (key.isNumber() && key.asNumber() == 0 && std::signbit(key.asNumber())) {
-        m_storage.pushBack(Value(0));
+        m_storage.add(Value(0));
     } else {
-        m_storage.pushBack(key);
+        m_storage.add(key);
     }
 }
 
 bool SetObject::has(ExecutionState& state, const Value& key)
 {
-    for (size_t i = 0; i < m_storage.size(); i++) {
-        Value existingKey = m_storage[i];
-        if (existingKey.isEmpty()) {
-            continue;
-        }
-        if (existingKey.equalsToByTheSameValueZeroAlgorithm(state, key)) {
-            return true;
-        }
-    }
-    return false;
+    return m_storage.find(state, key) != SetObjectData::NotFound;
 }
 
 size_t SetObject::size(ExecutionState& state)
 {
-    size_t siz = 0;
-    for (size_t i = 0; i < m_storage.size(); i++) {
-        Value existingKey = m_storage[i];
-        if (existingKey.isEmpty()) {
-            continue;
-        }
-        siz++;
-    }
-    return siz;
+    return m_storage.liveCount();
 }
 
 IteratorObject* SetObject::values(ExecutionState& state)
@@ -135,7 +105,7 @@ IteratorObject* SetObject::entries(ExecutionState& state)
 SetIteratorObject::SetIteratorObject(ExecutionState& state, SetObject* set, Type type)
     : IteratorObject(state, state.context()->globalObject()->setIteratorPrototype())
     , m_set(set)
-    , m_iteratorIndex(0)
+    , m_cursor(set->m_storage.cursor())
     , m_type(type)
 {
 }
@@ -148,6 +118,7 @@ void* SetIteratorObject::operator new(size_t size)
         GC_word obj_bitmap[GC_BITMAP_SIZE(SetIteratorObject)] = { 0 };
         Object::fillGCDescriptor(obj_bitmap);
         GC_set_bit(obj_bitmap, GC_WORD_OFFSET(SetIteratorObject, m_set));
+        GC_set_bit(obj_bitmap, GC_WORD_OFFSET(SetIteratorObject, m_cursor) + (offsetof(OrderedHashTableCursor, m_transition) / sizeof(GC_word)));
         descr = GC_make_descriptor(obj_bitmap, GC_WORD_LEN(SetIteratorObject));
         typeInited = true;
     }
@@ -160,7 +131,6 @@ std::pair<Value, bool> SetIteratorObject::advance(ExecutionState& state)
     // Let index be the value of the [[SetNextIndex]] internal slot of O.
     // Let itemKind be the value of the [[SetIterationKind]] internal slot of O.
     SetObject* s = m_set;
-    size_t index = m_iteratorIndex;
     Type itemKind = m_type;
 
     // If s is undefined, return CreateIterResultObject(undefined, true).
@@ -170,13 +140,13 @@ std::pair<Value, bool> SetIteratorObject::advance(ExecutionState& state)
 
     // Let entries be the List that is the value of the [[SetData]] internal slot of s.
     // Repeat while index is less than the total number of elements of entries. The number of elements must be redetermined each time this method is evaluated.
-    while (index < s->m_storage.size()) {
+    // (entries may have been compacted since last call. synchronizeCursor relocates index into the current layout)
+    while (s->m_storage.synchronizeCursor(m_cursor)) {
         // Let e be entries[index].
-        Value e = s->m_storage[index];
+        Value e = s->m_storage[m_cursor.m_index];
         // Set index to index+1.
-        index++;
         // Set the [[SetNextIndex]] internal slot of O to index.
-        m_iteratorIndex = index;
+        m_cursor.m_index++;
 
         if (e.isEmpty()) {
             continue;
@@ -197,6 +167,7 @@ std::pair<Value, bool> SetIteratorObject::advance(ExecutionState& state)
 
     // Set the [[IteratedSet]] internal slot of O to undefined.
     m_set = nullptr;
+    m_cursor = OrderedHashTableCursor();
     // Return CreateIterResultObject(undefined, true).
     return std::make_pair(Value(), true);
 }
@@ -34,121 +34,10 @@ void StaticStrings::initStaticStrings()
     FOR_EACH_STATIC_THREADING_STRING(INIT_STATIC_STRING)
 #undef INIT_STATIC_STRING
 
-#define INIT_STATIC_STRING(atomicString, name) atomicString.initStaticString(atomicStringMap, new ASCIIStringFromExternalMemory(name, sizeof(name) - 1))
-
-    INIT_STATIC_STRING(stringBreak, "break");
-    INIT_STATIC_STRING(stringCase, "case");
-    INIT_STATIC_STRING(stringCatch, "catch");
-    INIT_STATIC_STRING(stringClass, "class");
-    INIT_STATIC_STRING(stringConst, "const");
-    INIT_STATIC_STRING(stringContinue, "continue");
-    INIT_STATIC_STRING(stringDefault, "default");
-    INIT_STATIC_STRING(stringDelete, "delete");
-    INIT_STATIC_STRING(stringDo, "do");
-    INIT_STATIC_STRING(stringElse, "else");
-    INIT_STATIC_STRING(stringEnum, "enum");
-    INIT_STATIC_STRING(stringExport, "export");
-    INIT_STATIC_STRING(stringFalse, "false");
-    INIT_STATIC_STRING(stringFor, "for");
-    INIT_STATIC_STRING(stringIf, "if");
-    INIT_STATIC_STRING(stringImport, "import");
-    INIT_STATIC_STRING(stringIn, "in");
-    INIT_STATIC_STRING(stringMutable, "mutable");
-    INIT_STATIC_STRING(stringNew, "new");
-    INIT_STATIC_STRING(stringPrivate, "private");
-    INIT_STATIC_STRING(stringProtected, "protected");
-    INIT_STATIC_STRING(stringPublic, "public");
-    INIT_STATIC_STRING(stringRegister, "register");
-    INIT_STATIC_STRING(stringReturn, "return");
-    INIT_STATIC_STRING(stringStarDefaultStar, "*default*");
-    INIT_STATIC_STRING(stringStarNamespaceStar, "*namespace*");
-    INIT_STATIC_STRING(stringStatic, "static");
-    INIT_STATIC_STRING(stringSwitch, "switch");
-    INIT_STATIC_STRING(stringThis, "this");
-    INIT_STATIC_STRING(stringThrow, "throw");
-    INIT_STATIC_STRING(stringTrue, "true");
-    INIT_STATIC_STRING(stringTry, "try");
-    INIT_STATIC_STRING(stringTypeof, "typeof");
-    INIT_STATIC_STRING(stringVoid, "void");
-    INIT_STATIC_STRING(stringWhile, "while");
-#if defined(ENABLE_THREADING)
-    INIT_STATIC_STRING(stringAnd, "and");
-    INIT_STATIC_STRING(stringOr, "or");
-    INIT_STATIC_STRING(stringXor, "xor");
-#endif
-
-    INIT_STATIC_STRING($Ampersand, "$&");
-    INIT_STATIC_STRING($Apostrophe, "$'");
-    INIT_STATIC_STRING($GraveAccent, "$`");
-    INIT_STATIC_STRING($PlusSign, "$+");
-
-    INIT_STATIC_STRING(NegativeInfinity, "-Infinity");
-    INIT_STATIC_STRING(defaultRegExpString, "(?:)");
-    INIT_STATIC_STRING(getBaseName, "get baseName");
-    INIT_STATIC_STRING(getBuffer, "get buffer");
-    INIT_STATIC_STRING(getCalendar, "get calendar");
-    INIT_STATIC_STRING(getCalendars, "get calendars");
-    INIT_STATIC_STRING(getCaseFirst, "get caseFirst");
-    INIT_STATIC_STRING(getCollation, "get collation");
-    INIT_STATIC_STRING(getCollations, "get collations");
-    INIT_STATIC_STRING(getCompare, "get compare");
-    INIT_STATIC_STRING(getDetached, "get detached");
-    INIT_STATIC_STRING(getDescription, "get description");
-    INIT_STATIC_STRING(getDotAll, "get dotAll");
-    INIT_STATIC_STRING(getFlags, "get flags");
-    INIT_STATIC_STRING(getFormat, "get format");
-    INIT_STATIC_STRING(getGlobal, "get global");
-    INIT_STATIC_STRING(getHasIndices, "get hasIndices");
-    INIT_STATIC_STRING(getHourCycle, "get hourCycle");
-    INIT_STATIC_STRING(getHourCycles, "get hourCycles");
-    INIT_STATIC_STRING(getIgnoreCase, "get ignoreCase");
-    INIT_STATIC_STRING(getLanguage, "get language");
-    INIT_STATIC_STRING(getLength, "get length");
-    INIT_STATIC_STRING(getMultiline, "get multiline");
-    INIT_STATIC_STRING(getNumberingSystem, "get numberingSystem");
-    INIT_STATIC_STRING(getNumberingSystems, "get numberingSystems");
-    INIT_STATIC_STRING(getNumeric, "get numeric");
-    INIT_STATIC_STRING(getRegion, "get region");
-    INIT_STATIC_STRING(getScript, "get script");
-    INIT_STATIC_STRING(getSize, "get size");
-    INIT_STATIC_STRING(getSource, "get source");
-    INIT_STATIC_STRING(getSticky, "get sticky");
-    INIT_STATIC_STRING(getSymbolSpecies, "get [Symbol.species]");
-    INIT_STATIC_STRING(getSymbolToStringTag, "get [Symbol.toStringTag]");
-    INIT_STATIC_STRING(getTextInfo, "get textInfo");
-    INIT_STATIC_STRING(getTimeZones, "get timeZones");
-    INIT_STATIC_STRING(getUnicode, "get unicode");
-    INIT_STATIC_STRING(getUnicodeSets, "get unicodeSets");
-    INIT_STATIC_STRING(getWeekInfo, "get weekInfo");
-    INIT_STATIC_STRING(get__proto__, "get __proto__");
-    INIT_STATIC_STRING(getbyteLength, "get byteLength");
-    INIT_STATIC_STRING(getbyteOffset, "get byteOffset");
-    INIT_STATIC_STRING(getgrowable, "get growable");
-    INIT_STATIC_STRING(getmaxByteLength, "get maxByteLength");
-    INIT_STATIC_STRING(getresizable, "get resizable");
-    INIT_STATIC_STRING(intlDotCollator, "Intl.Collator");
-    INIT_STATIC_STRING(intlDotDisplayNames, "Intl.DisplayNames");
-    INIT_STATIC_STRING(intlDotListFormat, "Intl.ListFormat");
-    INIT_STATIC_STRING(intlDotLocale, "Intl.Locale");
-    INIT_STATIC_STRING(intlDotPluralRules, "Intl.PluralRules");
-    INIT_STATIC_STRING(intlDotRelativeTimeFormat, "Intl.RelativeTimeFormat");
-    INIT_STATIC_STRING(set__proto__, "set __proto__");
-    INIT_STATIC_STRING(symbolMatch, "[Symbol.match]");
-    INIT_STATIC_STRING(symbolMatchAll, "[Symbol.matchAll]");
-    INIT_STATIC_STRING(symbolReplace, "[Symbol.replace]");
-    INIT_STATIC_STRING(symbolSearch, "[Symbol.search]");
-    INIT_STATIC_STRING(symbolSplit, "[Symbol.split]");
-
-#if defined(ENABLE_WASM)
-    INIT_STATIC_STRING(getExports, "get exports");
-    INIT_STATIC_STRING(getValue, "get value");
-    INIT_STATIC_STRING(setValue, "set value");
-    INIT_STATIC_STRING(WebAssemblyDotGlobal, "WebAssembly.Global");
-    INIT_STATIC_STRING(WebAssemblyDotInstance, "WebAssembly.Instance");
-    INIT_STATIC_STRING(WebAssemblyDotMemory, "WebAssembly.Memory");
-    INIT_STATIC_STRING(WebAssemblyDotModule, "WebAssembly.Module");
-    INIT_STATIC_STRING(WebAssemblyDotTable, "WebAssembly.Table");
-#endif
+#define INIT_STATIC_STRING(atomicString, name) atomicString.initStaticString(atomicStringMap, new ASCIIStringFromExternalMemory(name, sizeof(name) - 1));
+    FOR_EACH_STATIC_NAMED_STRING(INIT_STATIC_STRING)
+    FOR_EACH_STATIC_NAMED_WASM_STRING(INIT_STATIC_STRING)
+    FOR_EACH_STATIC_NAMED_THREADING_STRING(INIT_STATIC_STRING)
 #undef INIT_STATIC_STRING
 
 #define INIT_STATIC_NUMBER(num) numbers[num].initStaticString(atomicStringMap, new ASCIIString(#num, sizeof(#num) - 1));
@@ -175,6 +64,63 @@ void StaticStrings::initStaticStrings()
 #undef DECLARE_LAZY_STATIC_STRING
 }
 
+// initialized static strings of the current thread
+// allocated as uncollectable memory so that the strings outlive the VMInstance which built them
+struct StaticStringsImage {
+    StaticStringsImage()
+        : m_staticStrings(&m_atomicStringMap)
+    {
+        m_staticStrings.initStaticStrings();
+    }
+
+    AtomicStringMap m_atomicStringMap;
+    StaticStrings m_staticStrings;
+};
+
+static MAY_THREAD_LOCAL StaticStringsImage* g_staticStringsImage;
+
+void StaticStrings::initStaticStringsFromImage()
+{
+    if (UNLIKELY(!g_staticStringsImage)) {
+        g_staticStringsImage = new (GC_MALLOC_UNCOLLECTABLE(sizeof(StaticStringsImage))) StaticStringsImage();
+    }
+
+    // copying the table keeps the stored hashes, so no string is hashed again
+    *m_atomicStringMap = g_staticStringsImage->m_atomicStringMap;
+    const StaticStrings& image = g_staticStringsImage->m_staticStrings;
+
+#define COPY_STATIC_STRING(name) name = image.name;
+    FOR_EACH_STATIC_STRING(COPY_STATIC_STRING)
+    FOR_EACH_STATIC_WASM_STRING(COPY_STATIC_STRING)
+    FOR_EACH_STATIC_THREADING_STRING(COPY_STATIC_STRING)
+#undef COPY_STATIC_STRING
+
+#define COPY_STATIC_STRING(name, unused) name = image.name;
+    FOR_EACH_STATIC_NAMED_STRING(COPY_STATIC_STRING)
+    FOR_EACH_STATIC_NAMED_WASM_STRING(COPY_STATIC_STRING)
+    FOR_EACH_STATIC_NAMED_THREADING_STRING(COPY_STATIC_STRING)
+#undef COPY_STATIC_STRING
+
+    std::copy(image.numbers, image.numbers + ESCARGOT_STRINGS_NUMBERS_MAX, numbers);
+    std::copy(image.asciiTable, image.asciiTable + ESCARGOT_ASCII_TABLE_MAX, asciiTable);
+
+#define DECLARE_LAZY_STATIC_STRING(Name, unused) m_lazy##Name = AtomicString();
+    FOR_EACH_LAZY_STATIC_STRING(DECLARE_LAZY_STATIC_STRING);
+    FOR_EACH_LAZY_INTL_STATIC_STRING(DECLARE_LAZY_STATIC_STRING);
+    FOR_EACH_LAZY_TEMPORAL_STATIC_STRING(DECLARE_LAZY_STATIC_STRING);
+    FOR_EACH_LAZY_THREADING_STATIC_STRING(DECLARE_LAZY_STATIC_STRING);
+#undef DECLARE_LAZY_STATIC_STRING
+}
+
+void StaticStrings::finalizeImage()
+{
+    if (g_staticStringsImage) {
+        g_staticStringsImage->~StaticStringsImage();
+        GC_FREE(g_staticStringsImage);
+        g_staticStringsImage = nullptr;
+    }
+}
+
 #define DECLARE_LAZY_STATIC_STRING(Name, stringContent)                                                                                 \
     AtomicString StaticStrings::lazy##Name()                                                                                            \
     {                                                                                                                                   \
@@ -547,6 +547,127 @@ namespace Escargot {
 #define FOR_EACH_STATIC_THREADING_STRING(F)
 #endif
 
+// static strings whose name differs from their content
+#define FOR_EACH_STATIC_NAMED_STRING(F)                     \
+    F(stringBreak, "break")                                 \
+    F(stringCase, "case")                                   \
+    F(stringCatch, "catch")                                 \
+    F(stringClass, "class")                                 \
+    F(stringConst, "const")                                 \
+    F(stringContinue, "continue")                           \
+    F(stringDefault, "default")                             \
+    F(stringDelete, "delete")                               \
+    F(stringDo, "do")                                       \
+    F(stringElse, "else")                                   \
+    F(stringEnum, "enum")                                   \
+    F(stringExport, "export")                               \
+    F(stringFalse, "false")                                 \
+    F(stringFor, "for")                                     \
+    F(stringIf, "if")                                       \
+    F(stringImport, "import")                               \
+    F(stringIn, "in")                                       \
+    F(stringMutable, "mutable")                             \
+    F(stringNew, "new")                                     \
+    F(stringPrivate, "private")                             \
+    F(stringProtected, "protected")                         \
+    F(stringPublic, "public")                               \
+    F(stringRegister, "register")                           \
+    F(stringReturn, "return")                               \
+    F(stringStarDefaultStar, "*default*")                   \
+    F(stringStarNamespaceStar, "*namespace*")               \
+    F(stringStatic, "static")                               \
+    F(stringSwitch, "switch")                               \
+    F(stringThis, "this")                                   \
+    F(stringThrow, "throw")                                 \
+    F(stringTrue, "true")                                   \
+    F(stringTry, "try")                                     \
+    F(stringTypeof, "typeof")                               \
+    F(stringVoid, "void")                                   \
+    F(stringWhile, "while")                                 \
+    F($Ampersand, "$&")                                     \
+    F($Apostrophe, "$'")                                    \
+    F($GraveAccent, "$`")                                   \
+    F($PlusSign, "$+")                                      \
+    F(NegativeInfinity, "-Infinity")                        \
+    F(defaultRegExpString, "(?:)")                          \
+    F(getBaseName, "get baseName")                          \
+    F(getBuffer, "get buffer")                              \
+    F(getCalendar, "get calendar")                          \
+    F(getCalendars, "get calendars")                        \
+    F(getCaseFirst, "get caseFirst")                        \
+    F(getCollation, "get collation")                        \
+    F(getCollations, "get collations")                      \
+    F(getCompare, "get compare")                            \
+    F(getDetached, "get detached")                          \
+    F(getDescription, "get description")                    \
+    F(getDotAll, "get dotAll")                              \
+    F(getFlags, "get flags")                                \
+    F(getFormat, "get format")                              \
+    F(getGlobal, "get global")                              \
+    F(getHasIndices, "get hasIndices")                      \
+    F(getHourCycle, "get hourCycle")                        \
+    F(getHourCycles, "get hourCycles")                      \
+    F(getIgnoreCase, "get ignoreCase")                      \
+    F(getLanguage, "get language")                          \
+    F(getLength, "get length")                              \
+    F(getMultiline, "get multiline")                        \
+    F(getNumberingSystem, "get numberingSystem")            \
+    F(getNumberingSystems, "get numberingSystems")          \
+    F(getNumeric, "get numeric")                            \
+    F(getRegion, "get region")                              \
+    F(getScript, "get script")                              \
+    F(getSize, "get size")                                  \
+    F(getSource, "get source")                              \
+    F(getSticky, "get sticky")                              \
+    F(getSymbolSpecies, "get [Symbol.species]")             \
+    F(getSymbolToStringTag, "get [Symbol.toStringTag]")     \
+    F(getTextInfo, "get textInfo")                          \
+    F(getTimeZones, "get timeZones")                        \
+    F(getUnicode, "get unicode")                            \
+    F(getUnicodeSets, "get unicodeSets")                    \
+    F(getWeekInfo, "get weekInfo")                          \
+    F(get__proto__, "get __proto__")                        \
+    F(getbyteLength, "get byteLength")                      \
+    F(getbyteOffset, "get byteOffset")                      \
+    F(getgrowable, "get growable")                          \
+    F(getmaxByteLength, "get maxByteLength")                \
+    F(getresizable, "get resizable")                        \
+    F(intlDotCollator, "Intl.Collator")                     \
+    F(intlDotDisplayNames, "Intl.DisplayNames")             \
+    F(intlDotListFormat, "Intl.ListFormat")                 \
+    F(intlDotLocale, "Intl.Locale")                         \
+    F(intlDotPluralRules, "Intl.PluralRules")               \
+    F(intlDotRelativeTimeFormat, "Intl.RelativeTimeFormat") \
+    F(set__proto__, "set __proto__")                        \
+    F(symbolMatch, "[Symbol.match]")                        \
+    F(symbolMatchAll, "[Symbol.matchAll]")                  \
+    F(symbolReplace, "[Symbol.replace]")                    \
+    F(symbolSearch, "[Symbol.search]")                      \
+    F(symbolSplit, "[Symbol.split]")
+
+#if defined(ENABLE_WASM)
+#define FOR_EACH_STATIC_NAMED_WASM_STRING(F)          \
+    F(getExports, "get exports")                      \
+    F(getValue, "get value")                          \
+    F(setValue, "set value")                          \
+    F(WebAssemblyDotGlobal, "WebAssembly.Global")     \
+    F(WebAssemblyDotInstance, "WebAssembly.Instance") \
+    F(WebAssemblyDotMemory, "WebAssembly.Memory")     \
+    F(WebAssemblyDotModule, "WebAssembly.Module")     \
+    F(WebAssemblyDotTable, "WebAssembly.Table")
+#else
+#define FOR_EACH_STATIC_NAMED_WASM_STRING(F)
+#endif
+
+#if defined(ENABLE_THREADING)
+#define FOR_EACH_STATIC_NAMED_THREADING_STRING(F) \
+    F(stringAnd, "and")                           \
+    F(stringOr, "or")                             \
+    F(stringXor, "xor")
+#else
+#define FOR_EACH_STATIC_NAMED_THREADING_STRING(F)
+#endif
+
 #define FOR_EACH_STATIC_NUMBER(F) \
     F(0)                          \
     F(1)                          \
@@ -878,121 +999,11 @@ public:
         return String::fromCharCode(ch);
     }
 
-    // keyword string
-    AtomicString stringBreak;
-    AtomicString stringCase;
-    AtomicString stringCatch;
-    AtomicString stringClass;
-    AtomicString stringConst;
-    AtomicString stringContinue;
-    AtomicString stringDefault;
-    AtomicString stringDelete;
-    AtomicString stringDo;
-    AtomicString stringElse;
-    AtomicString stringEnum;
-    AtomicString stringExport;
-    AtomicString stringFalse;
-    AtomicString stringFor;
-    AtomicString stringIf;
-    AtomicString stringImport;
-    AtomicString stringIn;
-    AtomicString stringMutable;
-    AtomicString stringNew;
-    AtomicString stringPrivate;
-    AtomicString stringProtected;
-    AtomicString stringPublic;
-    AtomicString stringRegister;
-    AtomicString stringReturn;
-    AtomicString stringStarDefaultStar;
-    AtomicString stringStarNamespaceStar;
-    AtomicString stringStatic;
-    AtomicString stringSwitch;
-    AtomicString stringThis;
-    AtomicString stringThrow;
-    AtomicString stringTrue;
-    AtomicString stringTry;
-    AtomicString stringTypeof;
-    AtomicString stringVoid;
-    AtomicString stringWhile;
-#if defined(ENABLE_THREADING)
-    AtomicString stringAnd;
-    AtomicString stringOr;
-    AtomicString stringXor;
-#endif
-
-    AtomicString $Ampersand;
-    AtomicString $Apostrophe;
-    AtomicString $GraveAccent;
-    AtomicString $PlusSign;
-
-    AtomicString NegativeInfinity;
-    AtomicString defaultRegExpString;
-    AtomicString getBaseName;
-    AtomicString getBuffer;
-    AtomicString getCalendar;
-    AtomicString getCalendars;
-    AtomicString getCaseFirst;
-    AtomicString getCollation;
-    AtomicString getCollations;
-    AtomicString getCompare;
-    AtomicString getDescription;
-    AtomicString getDetached;
-    AtomicString getDotAll;
-    AtomicString getFlags;
-    AtomicString getFormat;
-    AtomicString getGlobal;
-    AtomicString getHasIndices;
-    AtomicString getHourCycle;
-    AtomicString getHourCycles;
-    AtomicString getIgnoreCase;
-    AtomicString getLanguage;
-    AtomicString getLength;
-    AtomicString getMultiline;
-    AtomicString getNumberingSystem;
-    AtomicString getNumberingSystems;
-    AtomicString getNumeric;
-    AtomicString getRegion;
-    AtomicString getScript;
-    AtomicString getSize;
-    AtomicString getSource;
-    AtomicString getSticky;
-    AtomicString getSymbolSpecies;
-    AtomicString getSymbolToStringTag;
-    AtomicString getTextInfo;
-    AtomicString getTimeZones;
-    AtomicString getUnicode;
-    AtomicString getUnicodeSets;
-    AtomicString getWeekInfo;
-    AtomicString get__proto__;
-    AtomicString getbyteLength;
-    AtomicString getbyteOffset;
-    AtomicString getgrowable;
-    AtomicString getmaxByteLength;
-    AtomicString getresizable;
-    AtomicString intlDotCollator;
-    AtomicString intlDotDisplayNames;
-    AtomicString intlDotListFormat;
-    AtomicString intlDotLocale;
-    AtomicString intlDotPluralRules;
-    AtomicString intlDotRelativeTimeFormat;
-    AtomicString set__proto__;
-    AtomicString symbolMatch;
-    AtomicString symbolMatchAll;
-    AtomicString symbolReplace;
-    AtomicString symbolSearch;
-    AtomicString symbolSplit;
-
-#if defined(ENABLE_WASM)
-    AtomicString getExports;
-    AtomicString getValue;
-    AtomicString setValue;
-    AtomicString WebAssemblyDotGlobal;
-    AtomicString WebAssemblyDotInstance;
-    AtomicString WebAssemblyDotMemory;
-    AtomicString WebAssemblyDotModule;
-    AtomicString WebAssemblyDotTable;
-#endif
-
+#define DECLARE_STATIC_NAMED_STRING(name, unused) AtomicString name;
+    FOR_EACH_STATIC_NAMED_STRING(DECLARE_STATIC_NAMED_STRING);
+    FOR_EACH_STATIC_NAMED_WASM_STRING(DECLARE_STATIC_NAMED_STRING);
+    FOR_EACH_STATIC_NAMED_THREADING_STRING(DECLARE_STATIC_NAMED_STRING);
+#undef DECLARE_STATIC_NAMED_STRING
 
     AtomicString* asciiTable;
     AtomicString* numbers;
@@ -1011,6 +1022,10 @@ public:
 #undef DECLARE_LAZY_STATIC_STRING
 
     void initStaticStrings();
+    // copies the static strings and the atomic string table of this thread's image
+    // instead of allocating and hashing every string again. the image is built on the first call in each thread
+    void initStaticStringsFromImage();
+    static void finalizeImage();
 
     const size_t dtoaCacheSize; // 5;
     mutable Vector<std::pair<double, ::Escargot::String*>, GCUtil::gc_malloc_allocator<std::pair<double, ::Escargot::String*>>> dtoaCache;
@@ -46,6 +46,7 @@
 #include "Escargot.h"
 #include "String.h"
 #include "CompressibleString.h"
+#include "RopeString.h"
 #include "Value.h"
 
 #include "parser/Lexer.h"
@@ -120,32 +121,17 @@ bool isAllSpecialCharacters(const std::string& s, bool (*fn)(char))
 
 bool isAllASCII(const char* buf, const size_t len)
 {
-    for (unsigned i = 0; i < len; i++) {
-        if ((buf[i] & 0x80) != 0) {
-            return false;
-        }
-    }
-    return true;
+    return StringKernels::isAllASCII((const LChar*)buf, len);
 }
 
 bool isAllASCII(const char16_t* buf, const size_t len)
 {
-    for (unsigned i = 0; i < len; i++) {
-        if (buf[i] >= 128) {
-            return false;
-        }
-    }
-    return true;
+    return StringKernels::isAllASCII(buf, len);
 }
 
 bool isAllLatin1(const char16_t* buf, const size_t len)
 {
-    for (unsigned i = 0; i < len; i++) {
-        if (buf[i] >= 256) {
-            return false;
-        }
-    }
-    return true;
+    return StringKernels::isAllLatin1(buf, len);
 }
 
 bool isIndexString(String* str)
@@ -228,10 +214,23 @@ char32_t readUTF8Sequence(const char*& sequence, bool& valid, int& charlen)
 UTF16StringDataNonGCStd utf8StringToUTF16StringNonGC(const char* buf, const size_t len)
 {
     UTF16StringDataNonGCStd str;
+    str.reserve(len);
     const char* source = buf;
     int charlen;
     bool valid;
     while (source < buf + len) {
+        // widen a run of ASCII characters at once
+        size_t asciiLength = StringKernels::asciiLength((const LChar*)source, buf + len - source);
+        if (asciiLength) {
+            size_t oldLength = str.length();
+            str.resize(oldLength + asciiLength);
+            StringKernels::widen((const LChar*)source, asciiLength, &str[oldLength]);
+            source += asciiLength;
+            if (source == buf + len) {
+                break;
+            }
+        }
+
         char32_t ch = readUTF8Sequence(source, valid, charlen);
         if (!valid) { // Invalid sequence
             str += 0xFFFD;
@@ -264,10 +263,8 @@ ASCIIStringData utf16StringToASCIIString(const char16_t* buf, const size_t len)
 {
     ASCIIStringData str;
     str.resizeWithUninitializedValues(len);
-    for (unsigned i = 0; i < len; i++) {
-        ASSERT(buf[i] < 128);
-        str[i] = buf[i];
-    }
+    ASSERT(isAllASCII(buf, len));
+    StringKernels::narrow(buf, len, (LChar*)str.data());
     return ASCIIStringData(std::move(str));
 }
 
@@ -385,14 +382,7 @@ bool isWellFormed(const char16_t*& utf16, const char16_t* bufferEnd)
 
 bool StringBufferAccessData::equals16Bit(const char16_t* c1, const char* c2, size_t len)
 {
-    while (len > 0) {
-        if (*c1++ != *c2++) {
-            return false;
-        }
-        len--;
-    }
-
-    return true;
+    return StringKernels::equals(c1, (const LChar*)c2, len);
 }
 
 UTF16StringData ASCIIString::toUTF16StringData() const
@@ -400,9 +390,7 @@ UTF16StringData ASCIIString::toUTF16StringData() const
     UTF16StringData ret;
     size_t len = length();
     ret.resizeWithUninitializedValues(len);
-    for (size_t i = 0; i < len; i++) {
-        ret[i] = charAt(i);
-    }
+    StringKernels::widen(ASCIIString::characters8(), len, ret.data());
     return ret;
 }
 
@@ -421,44 +409,19 @@ UTF16StringData Latin1String::toUTF16StringData() const
     UTF16StringData ret;
     size_t len = length();
     ret.resizeWithUninitializedValues(len);
-    for (size_t i = 0; i < len; i++) {
-        ret[i] = charAt(i);
-    }
+    StringKernels::widen(Latin1String::characters8(), len, ret.data());
     return ret;
 }
 
 UTF8StringData Latin1String::toUTF8StringData() const
 {
-    UTF8StringData ret;
-    size_t len = length();
-    for (size_t i = 0; i < len; i++) {
-        uint8_t ch = m_bufferData.uncheckedCharAtFor8Bit(i); /* assume that code points above 0xff are impossible since latin-1 is 8-bit */
-        if (ch < 0x80) {
-            ret.append((char*)&ch, 1);
-        } else {
-            char buf[8];
-            auto len = utf32ToUtf8(ch, buf);
-            ret.append(buf, len);
-        }
-    }
-    return ret;
+    // code points above 0xff are impossible since latin-1 is 8-bit
+    return bufferAccessData().toUTF8String<UTF8StringData, UTF8StringDataNonGCStd>();
 }
 
 UTF8StringDataNonGCStd Latin1String::toNonGCUTF8StringData(int options) const
 {
-    UTF8StringDataNonGCStd ret;
-    size_t len = length();
-    for (size_t i = 0; i < len; i++) {
-        uint8_t ch = m_bufferData.uncheckedCharAtFor8Bit(i); /* assume that code points above 0xff are impossible since latin-1 is 8-bit */
-        if (ch < 0x80) {
-            ret.append((char*)&ch, 1);
-        } else {
-            char buf[8];
-            auto len = utf32ToUtf8(ch, buf);
-            ret.append(buf, len);
-        }
-    }
-    return ret;
+    return bufferAccessData().toUTF8String<UTF8StringDataNonGCStd>(options);
 }
 
 UTF16StringData UTF16String::toUTF16StringData() const
@@ -715,10 +678,7 @@ String* String::fromLatin1(const char16_t* src, size_t len)
 {
     if (len <= LATIN1_LARGE_INLINE_BUFFER_MAX_SIZE) {
         LChar* dest = static_cast<LChar*>(alloca(len));
-        for (size_t i = 0; i < len; i++) {
-            ASSERT(src[i] < 256);
-            dest[i] = src[i];
-        }
+        StringKernels::narrow(src, len, dest);
         return String::fromLatin1(dest, len);
     } else {
         return new Latin1String(src, len);
@@ -915,40 +875,33 @@ size_t String::find(String* str, size_t pos) const
     if (srcStrLen == 0)
         return pos <= size ? pos : SIZE_MAX;
 
-    if (srcStrLen <= size) {
-        char32_t src0 = str->charAt(0);
-        const auto& data = bufferAccessData();
-        if (data.has8BitContent) {
-            for (; pos <= size - srcStrLen; ++pos) {
-                if (((const LChar*)data.buffer)[pos] == src0) {
-                    bool same = true;
-                    for (size_t k = 1; k < srcStrLen; k++) {
-                        if (((const LChar*)data.buffer)[pos + k] != str->charAt(k)) {
-                            same = false;
-                            break;
-                        }
-                    }
-                    if (same)
-                        return pos;
-                }
-            }
+    if (pos >= size || srcStrLen > size - pos) {
+        return SIZE_MAX;
+    }
+
+    if (UNLIKELY(m_bufferData.hasSpecialImpl) && const_cast<String*>(this)->isRopeString()) {
+        return static_cast<const RopeString*>(this)->findWithoutFlattening(str, pos);
+    }
+
+    const auto& data = bufferAccessData();
+    const auto& srcData = str->bufferAccessData();
+    size_t result;
+    if (data.has8BitContent) {
+        const LChar* buffer = (const LChar*)data.bufferAs8Bit + pos;
+        if (srcData.has8BitContent) {
+            result = StringKernels::find(buffer, size - pos, (const LChar*)srcData.bufferAs8Bit, srcStrLen);
         } else {
-            for (; pos <= size - srcStrLen; ++pos) {
-                if (((const char16_t*)data.buffer)[pos] == src0) {
-                    bool same = true;
-                    for (size_t k = 1; k < srcStrLen; k++) {
-                        if (((const char16_t*)data.buffer)[pos + k] != str->charAt(k)) {
-                            same = false;
-                            break;
-                        }
-                    }
-                    if (same)
-                        return pos;
-                }
-            }
+            result = StringKernels::find(buffer, size - pos, srcData.bufferAs16Bit, srcStrLen);
+        }
+    } else {
+        const char16_t* buffer = data.bufferAs16Bit + pos;
+        if (srcData.has8BitContent) {
+            result = StringKernels::find(buffer, size - pos, (const LChar*)srcData.bufferAs8Bit, srcStrLen);
+        } else {
+            result = StringKernels::find(buffer, size - pos, srcData.bufferAs16Bit, srcStrLen);
         }
     }
-    return SIZE_MAX;
+    return result == SIZE_MAX ? SIZE_MAX : result + pos;
 }
 
 size_t String::find(const char* str, size_t srcStrLen, size_t pos) const
@@ -958,39 +911,55 @@ size_t String::find(const char* str, size_t srcStrLen, size_t pos) const
     if (srcStrLen == 0)
         return pos <= size ? pos : SIZE_MAX;
 
-    if (srcStrLen <= size) {
-        char32_t src0 = str[0];
-        const auto& data = bufferAccessData();
-        if (data.has8BitContent) {
-            for (; pos <= size - srcStrLen; ++pos) {
-                if (((const LChar*)data.buffer)[pos] == src0) {
-                    bool same = true;
-                    for (size_t k = 1; k < srcStrLen; k++) {
-                        if (((const LChar*)data.buffer)[pos + k] != str[k]) {
-                            same = false;
-                            break;
-                        }
-                    }
-                    if (same)
-                        return pos;
-                }
-            }
-        } else {
-            for (; pos <= size - srcStrLen; ++pos) {
-                if (((const char16_t*)data.buffer)[pos] == src0) {
-                    bool same = true;
-                    for (size_t k = 1; k < srcStrLen; k++) {
-                        if (((const char16_t*)data.buffer)[pos + k] != str[k]) {
-                            same = false;
-                            break;
-                        }
-                    }
-                    if (same)
-                        return pos;
-                }
+    if (pos >= size || srcStrLen > size - pos) {
+        return SIZE_MAX;
+    }
+
+    const auto& data = bufferAccessData();
+    size_t result;
+    if (data.has8BitContent) {
+        result = StringKernels::find((const LChar*)data.bufferAs8Bit + pos, size - pos, (const LChar*)str, srcStrLen);
+    } else {
+        result = StringKernels::find(data.bufferAs16Bit + pos, size - pos, (const LChar*)str, srcStrLen);
+    }
+    return result == SIZE_MAX ? SIZE_MAX : result + pos;
+}
+
+bool String::hasSubstringAt(String* str, size_t pos) const
+{
+    const size_t srcStrLen = str->length();
+    const size_t size = length();
+
+    if (pos > size || srcStrLen > size - pos) {
+        return false;
+    }
+
+    if (UNLIKELY(m_bufferData.hasSpecialImpl) && const_cast<String*>(this)->isRopeString()) {
+        return static_cast<const RopeString*>(this)->hasSubstringAtWithoutFlattening(str, pos);
+    }
+
+    const auto& data = bufferAccessData();
+    const auto& srcData = str->bufferAccessData();
+    return data.equalsSubstring(pos, srcData, 0, srcStrLen);
+}
+
+template <typename HaystackType, typename NeedleType>
+static size_t rfindInBuffer(const HaystackType* haystack, size_t size, const NeedleType* needle, size_t needleLength, size_t pos)
+{
+    if (pos > size - needleLength) {
+        pos = size - needleLength;
+    }
+    do {
+        bool same = true;
+        for (size_t k = 0; k < needleLength; k++) {
+            if (haystack[pos + k] != needle[k]) {
+                same = false;
+                break;
             }
         }
-    }
+        if (same)
+            return pos;
+    } while (pos-- > 0);
     return SIZE_MAX;
 }
 
@@ -1001,20 +970,19 @@ size_t String::rfind(String* str, size_t pos)
     if (srcStrLen == 0)
         return pos <= size ? pos : -1;
     if (srcStrLen <= size) {
-        do {
-            bool same = true;
-            if (pos >= size) {
-                continue;
+        const auto& data = bufferAccessData();
+        const auto& srcData = str->bufferAccessData();
+        if (data.has8BitContent) {
+            if (srcData.has8BitContent) {
+                return rfindInBuffer((const LChar*)data.bufferAs8Bit, size, (const LChar*)srcData.bufferAs8Bit, srcStrLen, pos);
             }
-            for (size_t k = 0; k < srcStrLen; k++) {
-                if (charAt(pos + k) != str->charAt(k)) {
-                    same = false;
-                    break;
-                }
+            return rfindInBuffer((const LChar*)data.bufferAs8Bit, size, srcData.bufferAs16Bit, srcStrLen, pos);
+        } else {
+            if (srcData.has8BitContent) {
+                return rfindInBuffer(data.bufferAs16Bit, size, (const LChar*)srcData.bufferAs8Bit, srcStrLen, pos);
             }
-            if (same)
-                return pos;
-        } while (pos-- > 0);
+            return rfindInBuffer(data.bufferAs16Bit, size, srcData.bufferAs16Bit, srcStrLen, pos);
+        }
     }
     return SIZE_MAX;
 }
@@ -1022,8 +990,7 @@ size_t String::rfind(String* str, size_t pos)
 String* String::substring(size_t from, size_t to)
 {
     if (to - from > STRING_SUB_STRING_MIN_VIEW_LENGTH) {
-        StringView* str = new StringView(this, from, to);
-        return str;
+        return StringView::createSubString(this, from, to);
     }
     StringBuilder builder;
     builder.appendSubString(this, from, to);
@@ -1128,7 +1095,7 @@ String* String::trim(String::StringTrimWhere where)
     if (s == 0 && e == stringLength - 1) {
         return this;
     }
-    return new StringView(this, s, e + 1);
+    return StringView::createSubString(this, s, e + 1);
 }
 
 
@@ -22,6 +22,7 @@
 
 #include "runtime/PointerValue.h"
 #include "util/BasicString.h"
+#include "util/StringKernels.h"
 #include "util/Vector.h"
 #include <string>
 
@@ -177,6 +178,20 @@ struct StringBufferAccessData {
         }
     }
 
+    // compares [start, start + len) of this with [otherStart, otherStart + len) of other
+    bool equalsSubstring(size_t start, const StringBufferAccessData& other, size_t otherStart, size_t len) const
+    {
+        ASSERT(start + len <= length && otherStart + len <= other.length);
+        if (has8BitContent == other.has8BitContent) {
+            size_t charSize = has8BitContent ? 1 : 2;
+            return memcmp((const char*)buffer + start * charSize, (const char*)other.buffer + otherStart * charSize, len * charSize) == 0;
+        } else if (has8BitContent) {
+            return StringKernels::equals(other.bufferAs16Bit + otherStart, (const LChar*)bufferAs8Bit + start, len);
+        } else {
+            return StringKernels::equals(bufferAs16Bit + start, (const LChar*)other.bufferAs8Bit + otherStart, len);
+        }
+    }
+
     template <typename OutputType, typename ComputingType>
     OutputType toUTF8String() const
     {
@@ -190,39 +205,56 @@ struct StringBufferAccessData {
         OutputType ret;
         const bool replaceInvalidUtf8 = options == StringWriteOption::ReplaceInvalidUtf8;
         const auto& accessData = *this;
-        for (size_t i = 0; i < accessData.length; i++) {
-            char32_t ch = (uint16_t)accessData.charAt(i);
-            if (ch < 0x80) {
-                ret.append((char*)&ch, 1);
+        size_t i = 0;
+        while (true) {
+            // copy a run of ASCII characters at once
+            size_t asciiLength;
+            if (accessData.has8BitContent) {
+                asciiLength = StringKernels::asciiLength((const LChar*)accessData.bufferAs8Bit + i, accessData.length - i);
+                ret.append(accessData.bufferAs8Bit + i, asciiLength);
             } else {
-                char32_t finalCh;
-                if (U16_IS_LEAD(ch)) {
-                    if (i + 1 == accessData.length) {
-                        if (replaceInvalidUtf8) {
-                            finalCh = 0xFFFD;
-                        } else {
-                            finalCh = ch;
-                        }
+                asciiLength = StringKernels::asciiLength(accessData.bufferAs16Bit + i, accessData.length - i);
+                LChar buf[256];
+                for (size_t j = 0; j < asciiLength; j += sizeof(buf)) {
+                    size_t chunkLength = std::min(asciiLength - j, sizeof(buf));
+                    StringKernels::narrow(accessData.bufferAs16Bit + i + j, chunkLength, buf);
+                    ret.append((const char*)buf, chunkLength);
+                }
+            }
+            i += asciiLength;
+            if (i >= accessData.length) {
+                break;
+            }
+
+            char32_t ch = (uint16_t)accessData.charAt(i);
+            char32_t finalCh;
+            if (U16_IS_LEAD(ch)) {
+                if (i + 1 == accessData.length) {
+                    if (replaceInvalidUtf8) {
+                        finalCh = 0xFFFD;
                     } else {
-                        char16_t c2 = accessData.charAt(i + 1);
                         finalCh = ch;
-                        if (U16_IS_TRAIL(c2)) {
-                            finalCh = U16_GET_SUPPLEMENTARY(ch, c2);
-                            i++;
-                        } else if (replaceInvalidUtf8) {
-                            finalCh = 0xFFFD;
-                        }
                     }
-                } else if (replaceInvalidUtf8 && U16_IS_TRAIL(ch)) {
-                    finalCh = 0xFFFD;
                 } else {
+                    char16_t c2 = accessData.charAt(i + 1);
                     finalCh = ch;
+                    if (U16_IS_TRAIL(c2)) {
+                        finalCh = U16_GET_SUPPLEMENTARY(ch, c2);
+                        i++;
+                    } else if (replaceInvalidUtf8) {
+                        finalCh = 0xFFFD;
+                    }
                 }
-
-                char buf[8];
-                auto len = utf32ToUtf8(finalCh, buf);
-                ret.append(buf, len);
+            } else if (replaceInvalidUtf8 && U16_IS_TRAIL(ch)) {
+                finalCh = 0xFFFD;
+            } else {
+                finalCh = ch;
             }
+
+            char buf[8];
+            auto len = utf32ToUtf8(finalCh, buf);
+            ret.append(buf, len);
+            i++;
         }
         return ret;
     }
@@ -448,6 +480,9 @@ public:
 
     size_t rfind(String* str, size_t pos);
 
+    // returns true if str appears in this string at pos
+    bool hasSubstringAt(String* str, size_t pos) const;
+
     String* substring(size_t from, size_t to);
 
     template <typename T>
@@ -599,12 +634,7 @@ protected:
 
     static ALWAYS_INLINE bool stringEqual(const char16_t* s, const LChar* s1, const size_t len)
     {
-        for (size_t i = 0; i < len; i++) {
-            if (s[i] != s1[i]) {
-                return false;
-            }
-        }
-        return true;
+        return StringKernels::equals(s, s1, len);
     }
 };
 
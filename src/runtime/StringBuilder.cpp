@@ -21,6 +21,8 @@
 #include "StringBuilder.h"
 #include "ExecutionState.h"
 #include "ErrorObject.h"
+#include "RopeString.h"
+#include "util/StringKernels.h"
 
 namespace Escargot {
 
@@ -179,4 +181,184 @@ String* StringBuilderBase::finalizeBase(StringBuilderPiece* piecesInlineStorage,
     }
 }
 
+void ChunkedStringBuilder::appendSubString(String* str, size_t s, size_t e)
+{
+    if (s == e) {
+        return;
+    }
+    const auto& data = str->bufferAccessData();
+    if (data.has8BitContent) {
+        appendLatin1((const LChar*)data.bufferAs8Bit + s, e - s);
+    } else {
+        append16Bit(data.bufferAs16Bit + s, e - s);
+    }
+}
+
+void ChunkedStringBuilder::appendLatin1(const LChar* src, size_t len)
+{
+    m_contentLength += len;
+    while (len) {
+        if (m_segmentLength == m_segmentCapacity) {
+            growSegment();
+        }
+        size_t count = std::min(len, m_segmentCapacity - m_segmentLength);
+        if (m_segmentIs8Bit) {
+            memcpy(m_latin1Segment.data() + m_segmentLength, src, count);
+        } else {
+            StringKernels::widen(src, count, m_utf16Segment.data() + m_segmentLength);
+        }
+        m_segmentLength += count;
+        src += count;
+        len -= count;
+    }
+}
+
+void ChunkedStringBuilder::append16Bit(const char16_t* src, size_t len)
+{
+    m_contentLength += len;
+    while (len) {
+        if (m_segmentLength == m_segmentCapacity) {
+            growSegment();
+        }
+        size_t count = std::min(len, m_segmentCapacity - m_segmentLength);
+        if (m_segmentIs8Bit) {
+            if (StringKernels::isAllLatin1(src, count)) {
+                StringKernels::narrow(src, count, m_latin1Segment.data() + m_segmentLength);
+            } else {
+                widenSegment();
+                memcpy(m_utf16Segment.data() + m_segmentLength, src, count * sizeof(char16_t));
+            }
+        } else {
+            memcpy(m_utf16Segment.data() + m_segmentLength, src, count * sizeof(char16_t));
+        }
+        m_segmentLength += count;
+        src += count;
+        len -= count;
+    }
+}
+
+void ChunkedStringBuilder::growSegment()
+{
+    ASSERT(m_segmentLength == m_segmentCapacity);
+    size_t newCapacity;
+    if (m_segmentCapacity < m_segmentSize) {
+        newCapacity = std::min(std::max(m_segmentCapacity * 2, (size_t)InitialSegmentCapacity), m_segmentSize);
+    } else {
+        // a surrogate pair is not split into two segments
+        // because a sink may convert each segment to UTF-8 separately
+        char16_t leadSurrogate = 0;
+        if (!m_segmentIs8Bit && m_segmentLength > 1 && U16_IS_LEAD(m_utf16Segment.data()[m_segmentLength - 1])) {
+            leadSurrogate = m_utf16Segment.data()[m_segmentLength - 1];
+            m_segmentLength--;
+        }
+        finishSegment();
+        newCapacity = m_segmentSize;
+
+        if (leadSurrogate) {
+            m_utf16Segment.resizeWithUninitializedValues(newCapacity);
+            m_utf16Segment.data()[0] = leadSurrogate;
+            m_segmentIs8Bit = false;
+            m_segmentLength = 1;
+            m_segmentCapacity = newCapacity;
+            return;
+        }
+    }
+
+    if (m_segmentIs8Bit) {
+        m_latin1Segment.resizeWithUninitializedValues(newCapacity);
+    } else {
+        m_utf16Segment.resizeWithUninitializedValues(newCapacity);
+    }
+    m_segmentCapacity = newCapacity;
+}
+
+void ChunkedStringBuilder::widenSegment()
+{
+    ASSERT(m_segmentIs8Bit);
+    m_utf16Segment.resizeWithUninitializedValues(m_segmentCapacity);
+    StringKernels::widen(m_latin1Segment.data(), m_segmentLength, m_utf16Segment.data());
+    m_latin1Segment.clear();
+    m_segmentIs8Bit = false;
+}
+
+void ChunkedStringBuilder::finishSegment()
+{
+    ASSERT(m_segmentLength);
+    String* segment;
+    if (m_segmentIs8Bit) {
+        if (m_segmentLength == m_latin1Segment.size()) {
+            segment = new Latin1String(std::move(m_latin1Segment));
+        } else {
+            segment = String::fromLatin1(m_latin1Segment.data(), m_segmentLength);
+            m_latin1Segment.clear();
+        }
+    } else {
+        if (m_segmentLength == m_utf16Segment.size()) {
+            segment = new UTF16String(std::move(m_utf16Segment));
+        } else {
+            segment = new UTF16String(m_utf16Segment.data(), m_segmentLength);
+        }
+        m_utf16Segment.clear();
+    }
+
+    m_segmentLength = 0;
+    m_segmentCapacity = 0;
+    m_segmentIs8Bit = true;
+
+    if (m_sink) {
+        m_sink(segment, m_sinkData);
+    } else {
+        m_segments.pushBack(segment);
+    }
+}
+
+String* ChunkedStringBuilder::joinSegments(size_t start, size_t end, ExecutionState* state)
+{
+    if (end - start == 1) {
+        return m_segments[start];
+    }
+    size_t mid = start + (end - start) / 2;
+    String* left = joinSegments(start, mid, state);
+    String* right = joinSegments(mid, end, state);
+    return RopeString::createRopeString(left, right, state);
+}
+
+String* ChunkedStringBuilder::finalize(ExecutionState* state)
+{
+    if (m_sink) {
+        if (m_segmentLength) {
+            finishSegment();
+        }
+        clear();
+        return String::emptyString;
+    }
+
+    if (!m_contentLength) {
+        clear();
+        return String::emptyString;
+    }
+
+    if (state && UNLIKELY(m_contentLength > STRING_MAXIMUM_LENGTH)) {
+        ErrorObject::throwBuiltinError(*state, ErrorCode::RangeError, ErrorObject::Messages::String_InvalidStringLength);
+    }
+
+    if (m_segmentLength) {
+        finishSegment();
+    }
+    String* result = joinSegments(0, m_segments.size(), state);
+    clear();
+    return result;
+}
+
+void ChunkedStringBuilder::clear()
+{
+    m_contentLength = 0;
+    m_segmentLength = 0;
+    m_segmentCapacity = 0;
+    m_segmentIs8Bit = true;
+    m_latin1Segment.clear();
+    m_utf16Segment.clear();
+    m_segments.clear();
+}
+
 } // namespace Escargot
@@ -240,7 +240,109 @@ private:
 };
 
 using StringBuilder = StringBuilderImpl<STRING_BUILDER_INLINE_STORAGE_DEFAULT>;
-using LargeStringBuilder = StringBuilderImpl<STRING_BUILDER_INLINE_STORAGE_DEFAULT * 4>;
+
+// ChunkedStringBuilder copies appended characters into segments of up to segmentSize characters
+// instead of keeping pieces until finalize, so large content never exists twice.
+// finalize returns a flat string for content of one segment, or a rope of the segments.
+// if a sink is set, each finished segment is passed to the sink and not kept.
+class ChunkedStringBuilder {
+    MAKE_STACK_ALLOCATED();
+
+public:
+    typedef void (*SegmentSink)(String* segment, void* data);
+
+    explicit ChunkedStringBuilder(size_t segmentSize = STRING_BUILDER_SEGMENT_SIZE)
+        : m_segmentSize(segmentSize)
+        , m_contentLength(0)
+        , m_segmentLength(0)
+        , m_segmentCapacity(0)
+        , m_segmentIs8Bit(true)
+        , m_sink(nullptr)
+        , m_sinkData(nullptr)
+    {
+    }
+
+    void setSegmentSink(SegmentSink sink, void* data)
+    {
+        m_sink = sink;
+        m_sinkData = data;
+    }
+
+    size_t contentLength() const { return m_contentLength; }
+
+    void appendChar(char16_t ch)
+    {
+        if (UNLIKELY(m_segmentLength == m_segmentCapacity)) {
+            growSegment();
+        }
+        if (m_segmentIs8Bit) {
+            if (LIKELY(ch < 256)) {
+                m_latin1Segment.data()[m_segmentLength++] = (LChar)ch;
+                m_contentLength++;
+                return;
+            }
+            widenSegment();
+        }
+        m_utf16Segment.data()[m_segmentLength++] = ch;
+        m_contentLength++;
+    }
+
+    void appendChar(char ch)
+    {
+        appendChar((char16_t)(LChar)ch);
+    }
+
+    void appendChar(char32_t ch)
+    {
+        char16_t buf[2];
+        auto c = utf32ToUtf16(ch, buf);
+        appendChar(buf[0]);
+        if (c == 2) {
+            appendChar(buf[1]);
+        }
+    }
+
+    void appendString(const char* str)
+    {
+        appendLatin1((const LChar*)str, strlen(str));
+    }
+
+    void appendString(String* str)
+    {
+        appendSubString(str, 0, str->length());
+    }
+
+    void appendSubString(String* str, size_t s, size_t e);
+
+    // provide ExecutionState if you need limit of string length(exception can be thrown only in ExecutionState area)
+    // returns an empty string if a sink is set
+    String* finalize(ExecutionState* state = nullptr);
+
+    void clear();
+
+private:
+    enum : size_t {
+        InitialSegmentCapacity = 256,
+    };
+
+    void appendLatin1(const LChar* src, size_t len);
+    void append16Bit(const char16_t* src, size_t len);
+    void growSegment();
+    void widenSegment();
+    void finishSegment();
+    String* joinSegments(size_t start, size_t end, ExecutionState* state);
+
+    size_t m_segmentSize;
+    size_t m_contentLength;
+    size_t m_segmentLength;
+    size_t m_segmentCapacity;
+    bool m_segmentIs8Bit;
+    Latin1StringData m_latin1Segment;
+    UTF16StringData m_utf16Segment;
+    SegmentSink m_sink;
+    void* m_sinkData;
+    Vector<String*, GCUtil::gc_malloc_allocator<String*>> m_segments;
+};
 
 } // namespace Escargot
 
@@ -34,4 +34,69 @@ void* StringView::operator new(size_t size)
     }
     return GC_MALLOC_EXPLICITLY_TYPED(size, descr);
 }
+
+String* StringView::createSubString(String* str, size_t start, size_t end)
+{
+    if (str->isStringView()) {
+        StringView* view = (StringView*)str;
+        start += view->m_start;
+        end += view->m_start;
+        str = view->m_bufferData.bufferAsString;
+    }
+
+    if (!ThreadLocal::stringViewRetentionTracker()->shouldShareBuffer(str, start, end)) {
+        StringBuilder builder;
+        builder.appendSubString(str, start, end);
+        return builder.finalize();
+    }
+    return new StringView(str, start, end);
+}
+
+StringViewRetentionTracker::StringViewRetentionTracker()
+    : m_createdCount(0)
+    , m_sharedBytes(0)
+    , m_copiedCount(0)
+    , m_copiedBytes(0)
+{
+    resetParents();
+}
+
+void StringViewRetentionTracker::resetParents()
+{
+    memset(m_parents, 0, sizeof(m_parents));
+}
+
+bool StringViewRetentionTracker::shouldShareBuffer(String* parent, size_t start, size_t end)
+{
+    ASSERT(start <= end);
+    const size_t parentLength = parent->length();
+    const size_t byteLength = (end - start) * (parent->has8BitContent() ? 1 : 2);
+    bool share = true;
+    if (parentLength >= STRING_VIEW_RETENTION_MIN_PARENT_LENGTH) {
+        size_t address = reinterpret_cast<size_t>(parent);
+        ParentEntry& entry = m_parents[(address / sizeof(void*)) % ParentCacheSize];
+        if (entry.m_parentAddress != address) {
+            entry.m_parentAddress = address;
+            entry.m_coveredEnd = 0;
+            entry.m_coveredLength = 0;
+        }
+        // only the part beyond every previous substring is newly covered
+        // so taking the same or overlapping ranges again does not add up
+        if (end > entry.m_coveredEnd) {
+            entry.m_coveredLength += end - std::max(start, entry.m_coveredEnd);
+            entry.m_coveredEnd = end;
+        }
+        share = entry.m_coveredLength >= parentLength / STRING_VIEW_RETENTION_RATIO;
+    }
+
+    if (share) {
+        m_createdCount++;
+        m_sharedBytes += byteLength;
+    } else {
+        m_copiedCount++;
+        m_copiedBytes += byteLength;
+    }
+    return share;
+}
+
 } // namespace Escargot
@@ -56,6 +56,11 @@ public:
         initBufferAccessData(String::emptyString, 0, 0);
     }
 
+    // creates a heap StringView sharing the buffer of str
+    // a view on another view shares the buffer of the original string instead
+    // returns a copy if StringViewRetentionTracker decides that the view would retain str for little benefit
+    static String* createSubString(String* str, size_t start, size_t end);
+
     bool operator==(const char* src) const
     {
         size_t srcLen = strlen(src);
@@ -65,20 +70,10 @@ public:
 
         const auto& data = bufferAccessData();
         if (data.has8BitContent) {
-            for (size_t i = 0; i < srcLen; i++) {
-                if (src[i] != ((const LChar*)data.buffer)[i]) {
-                    return false;
-                }
-            }
+            return memcmp(src, data.buffer, srcLen) == 0;
         } else {
-            for (size_t i = 0; i < srcLen; i++) {
-                if (src[i] != ((const char16_t*)data.buffer)[i]) {
-                    return false;
-                }
-            }
+            return StringKernels::equals((const char16_t*)data.buffer, (const LChar*)src, srcLen);
         }
-
-        return true;
     }
 
     bool operator!=(const char* src) const
@@ -98,14 +93,14 @@ public:
 
     virtual UTF16StringData toUTF16StringData() const override
     {
-        UTF16StringData ret;
-        size_t len = length();
-        ret.resizeWithUninitializedValues(len);
-
-        for (size_t i = 0; i < len; i++) {
-            ret[i] = charAt(i);
+        const auto& data = bufferAccessData();
+        if (!data.has8BitContent) {
+            return UTF16StringData(data.bufferAs16Bit, data.length);
         }
 
+        UTF16StringData ret;
+        ret.resizeWithUninitializedValues(data.length);
+        StringKernels::widen((const LChar*)data.bufferAs8Bit, data.length, ret.data());
         return ret;
     }
 
@@ -167,6 +162,61 @@ protected:
 private:
     size_t m_start;
 };
+
+// StringViewRetentionTracker decides whether a substring of a much longer string shares its buffer
+// a view is never changed after creation because native code may hold its buffer pointer,
+// so the decision is made when the substring is created:
+// a substring is copied until the substrings taken from the same parent cover 1/STRING_VIEW_RETENTION_RATIO of it
+// e.g. a small slice kept from a large input is copied, but splitting the input into lines shares it
+// coverage is counted from the start in the order substrings are taken, which fits split and tokenizers.
+// a range behind the furthest end taken so far adds nothing, so repeating a slice never reaches the ratio
+// the parent table is reset on every GC
+class StringViewRetentionTracker {
+public:
+    StringViewRetentionTracker();
+
+    bool shouldShareBuffer(String* parent, size_t start, size_t end);
+    void resetParents();
+
+    size_t createdCount() const
+    {
+        return m_createdCount;
+    }
+
+    size_t sharedBytes() const
+    {
+        return m_sharedBytes;
+    }
+
+    size_t copiedCount() const
+    {
+        return m_copiedCount;
+    }
+
+    size_t copiedBytes() const
+    {
+        return m_copiedBytes;
+    }
+
+private:
+    enum : size_t {
+        ParentCacheSize = 64,
+    };
+
+    // coverage of substrings taken from a recent parent
+    // parent address is not a reference. entries are cleared on GC before the address can be reused
+    struct ParentEntry {
+        size_t m_parentAddress;
+        size_t m_coveredEnd;
+        size_t m_coveredLength;
+    };
+
+    ParentEntry m_parents[ParentCacheSize];
+    size_t m_createdCount;
+    size_t m_sharedBytes;
+    size_t m_copiedCount;
+    size_t m_copiedBytes;
+};
 } // namespace Escargot
 
 #endif
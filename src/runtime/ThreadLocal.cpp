@@ -22,6 +22,8 @@
 #include "heap/Heap.h"
 #include "runtime/Global.h"
 #include "runtime/Platform.h"
+#include "runtime/StringView.h"
+#include "runtime/StaticStrings.h"
 #include "parser/ASTAllocator.h"
 #include "BumpPointerAllocator.h"
 #if defined(ENABLE_WASM)
@@ -51,6 +53,7 @@ MAY_THREAD_LOCAL WASMContext ThreadLocal::g_wasmContext;
 MAY_THREAD_LOCAL GCEventListenerSet* ThreadLocal::g_gcEventListenerSet;
 MAY_THREAD_LOCAL ASTAllocator* ThreadLocal::g_astAllocator;
 MAY_THREAD_LOCAL WTF::BumpPointerAllocator* ThreadLocal::g_bumpPointerAllocator;
+MAY_THREAD_LOCAL StringViewRetentionTracker* ThreadLocal::g_stringViewRetentionTracker;
 MAY_THREAD_LOCAL void* ThreadLocal::g_customData;
 
 GCEventListenerSet::EventListenerVector* GCEventListenerSet::ensureMarkStartListeners()
@@ -107,6 +110,8 @@ void GCEventListenerSet::reset()
 
 static void genericGCEventListener(GC_EventType evtType)
 {
+    Heap::recordGCEvent(evtType);
+
     GCEventListenerSet& list = ThreadLocal::gcEventListenerSet();
     Optional<GCEventListenerSet::EventListenerVector*> listeners;
 
@@ -121,6 +126,8 @@ static void genericGCEventListener(GC_EventType evtType)
         listeners = list.reclaimStartListeners();
         break;
     case GC_EVENT_RECLAIM_END:
+        // parent strings could be reclaimed and their addresses reused by new strings
+        ThreadLocal::stringViewRetentionTracker()->resetParents();
         listeners = list.reclaimEndListeners();
         break;
     default:
@@ -198,6 +205,10 @@ void ThreadLocal::initialize()
     g_wasmContext.lastGCCheckTime = 0;
 #endif
 
+    // g_stringViewRetentionTracker
+    // genericGCEventListener uses this
+    g_stringViewRetentionTracker = new StringViewRetentionTracker();
+
     // g_gcEventListenerSet
     g_gcEventListenerSet = new GCEventListenerSet();
     // in addition, register genericGCEventListener here too
@@ -223,6 +234,9 @@ void ThreadLocal::finalize()
     Global::platform()->deallocateThreadLocalCustomData();
     g_customData = nullptr;
 
+    // static strings image holds uncollectable memory
+    StaticStrings::finalizeImage();
+
     // full gc(Heap::finalize) should be invoked after g_customData deallocation
     // because g_customData might contain GC-object
     Heap::finalize();
@@ -256,6 +270,10 @@ void ThreadLocal::finalize()
     delete g_bumpPointerAllocator;
     g_bumpPointerAllocator = nullptr;
 
+    // g_stringViewRetentionTracker
+    delete g_stringViewRetentionTracker;
+    g_stringViewRetentionTracker = nullptr;
+
     inited = false;
 }
 
@@ -37,6 +37,7 @@ struct WASMContext {
 namespace Escargot {
 
 class ASTAllocator;
+class StringViewRetentionTracker;
 
 class GCEventListenerSet {
 public:
@@ -100,6 +101,7 @@ class ThreadLocal {
     static MAY_THREAD_LOCAL GCEventListenerSet* g_gcEventListenerSet;
     static MAY_THREAD_LOCAL ASTAllocator* g_astAllocator;
     static MAY_THREAD_LOCAL WTF::BumpPointerAllocator* g_bumpPointerAllocator;
+    static MAY_THREAD_LOCAL StringViewRetentionTracker* g_stringViewRetentionTracker;
     // custom data allocated by user through Platform::allocateThreadLocalCustomData
     static MAY_THREAD_LOCAL void* g_customData;
 
@@ -166,6 +168,12 @@ public:
         return g_bumpPointerAllocator;
     }
 
+    static StringViewRetentionTracker* stringViewRetentionTracker()
+    {
+        ASSERT(inited && !!g_stringViewRetentionTracker);
+        return g_stringViewRetentionTracker;
+    }
+
     static void* customData()
     {
         ASSERT(inited && !!g_customData);
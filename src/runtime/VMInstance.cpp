@@ -31,6 +31,9 @@
 #include "runtime/ReloadableString.h"
 #include "intl/Intl.h"
 #include "interpreter/ByteCode.h"
+#include "interpreter/GetObjectMegamorphicCache.h"
+#include "runtime/JSON.h"
+#include "runtime/SamplingProfiler.h"
 #if defined(ENABLE_TCO)
 #include "interpreter/ByteCodeInterpreter.h"
 #endif
@@ -183,6 +186,7 @@ void* VMInstance::operator new(size_t size)
         GC_set_bit(desc, GC_WORD_OFFSET(VMInstance, m_regexpOptionStringCache));
         GC_set_bit(desc, GC_WORD_OFFSET(VMInstance, m_cachedUTC));
         GC_set_bit(desc, GC_WORD_OFFSET(VMInstance, m_jobQueue));
+        GC_set_bit(desc, GC_WORD_OFFSET(VMInstance, m_samplingProfiler));
 #if defined(ENABLE_INTL)
         GC_set_bit(desc, GC_WORD_OFFSET(VMInstance, m_intlAvailableLocales));
         GC_set_bit(desc, GC_WORD_OFFSET(VMInstance, m_intlCollatorAvailableLocales));
@@ -210,16 +214,20 @@ void vmMarkStartCallback(void* data)
     }
 
     auto& currentCodeSizeTotal = self->compiledByteCodeSize();
-    if (currentCodeSizeTotal > self->maxCompiledByteCodeSize() || UNLIKELY(self->inIdleMode())) {
-        currentCodeSizeTotal = std::numeric_limits<size_t>::max();
+    // hotness matters only when the next eviction would release something
+    if (self->m_byteCodeEvictionPolicy != VMInstance::EvictAll
+        && currentCodeSizeTotal > std::min(self->m_byteCodeEvictionTargetSize, self->maxCompiledByteCodeSize())) {
+        self->updateByteCodeBlockHotness();
+    }
 
-        auto& v = self->compiledByteCodeBlocks();
-        for (size_t i = 0; i < v.size(); i++) {
-            // ByteCodeBlock of top CodeBlock should be remove by Script class
-            if (v[i]->m_codeBlock->parent()) {
-                v[i]->m_codeBlock->setByteCodeBlock(nullptr);
-            }
+    if (currentCodeSizeTotal > self->maxCompiledByteCodeSize() || UNLIKELY(self->inIdleMode())) {
+        if (UNLIKELY(self->inIdleMode()) || self->m_byteCodeEvictionPolicy == VMInstance::EvictAll) {
+            self->evictByteCodeBlocks(0);
+        } else {
+            self->evictByteCodeBlocks(std::min(self->m_byteCodeEvictionTargetSize, self->maxCompiledByteCodeSize()));
         }
+        // released ByteCodeBlocks which are still in use are restored in vmReclaimEndCallback
+        currentCodeSizeTotal = std::numeric_limits<size_t>::max();
     }
 #endif
 }
@@ -238,6 +246,14 @@ void vmReclaimEndCallback(void* data)
 #endif
 #endif
 
+    // structures cached in megamorphic cache and JSON.stringify shape cache could be reclaimed by this GC
+    if (self->m_getObjectMegamorphicCache) {
+        self->m_getObjectMegamorphicCache->clear();
+    }
+    if (self->m_jsonStringifyShapeCache) {
+        self->m_jsonStringifyShapeCache->clear();
+    }
+
     auto& currentCodeSizeTotal = self->compiledByteCodeSize();
 
     if (currentCodeSizeTotal == std::numeric_limits<size_t>::max()) {
@@ -248,13 +264,18 @@ void vmReclaimEndCallback(void* data)
             currentCodeSizeTotal = 0;
             auto& v = self->compiledByteCodeBlocks();
             for (size_t i = 0; i < v.size(); i++) {
-                if (v[i]->m_codeBlock->parent()) {
+                if (v[i]->m_codeBlock->parent() && !v[i]->m_codeBlock->byteCodeBlock()) {
                     v[i]->m_codeBlock->setByteCodeBlock(v[i]);
-                    ASSERT(v[i]->m_codeBlock->byteCodeBlock() == v[i]);
+                    v[i]->m_codeBlock->setByteCodeBlockEvicted(false);
+                    ASSERT(self->m_evictingByteCodeBlockCount);
+                    self->m_evictingByteCodeBlockCount--;
                 }
+                ASSERT(!v[i]->m_codeBlock->parent() || v[i]->m_codeBlock->byteCodeBlock() == v[i]);
 
                 currentCodeSizeTotal += v[i]->memoryAllocatedSize();
             }
+            self->m_evictedByteCodeBlockCount += self->m_evictingByteCodeBlockCount;
+            self->m_evictingByteCodeBlockCount = 0;
         }
     }
 
@@ -327,6 +348,10 @@ VMInstance::~VMInstance()
     ucal_close(m_calendar);
 #endif
 
+    delete m_getObjectMegamorphicCache;
+    delete m_jsonStringifyShapeCache;
+    stopProfiling();
+
 #if defined(ENABLE_CODE_CACHE)
     delete m_codeCache;
 #endif
@@ -340,6 +365,15 @@ VMInstance::VMInstance(const char* locale, const char* timezone, const char* bas
     , m_didSomePrototypeObjectDefineIndexedProperty(false)
     , m_compiledByteCodeSize(0)
     , m_maxCompiledByteCodeSize(SCRIPT_FUNCTION_OBJECT_BYTECODE_SIZE_MAX)
+    , m_byteCodeEvictionTargetSize(SCRIPT_FUNCTION_OBJECT_BYTECODE_EVICTION_TARGET_SIZE)
+    , m_byteCodeEvictionPolicy(EvictAll)
+    , m_byteCodeEpoch(0)
+    , m_evictingByteCodeBlockCount(0)
+    , m_evictedByteCodeBlockCount(0)
+    , m_regeneratedByteCodeBlockCount(0)
+    , m_getObjectMegamorphicCache(nullptr)
+    , m_jsonStringifyShapeCache(nullptr)
+    , m_samplingProfiler(nullptr)
 #if defined(ENABLE_COMPRESSIBLE_STRING)
     , m_lastCompressibleStringsTestTime(0)
     , m_compressibleStringsUncomressedBufferSize(0)
@@ -378,7 +412,7 @@ VMInstance::VMInstance(const char* locale, const char* timezone, const char* bas
         String::initEmptyString();
         ASSERT(!!String::emptyString && String::emptyString->isAtomicStringSource());
     }
-    m_staticStrings.initStaticStrings();
+    m_staticStrings.initStaticStringsFromImage();
 
     m_toStringRecursionPreventer = new ToStringRecursionPreventer();
 
@@ -722,9 +756,133 @@ Optional<ObjectStructure*> VMInstance::findRootedObjectStructure(ObjectStructure
     return nullptr;
 }
 
+void VMInstance::createGetObjectMegamorphicCache()
+{
+    ASSERT(!m_getObjectMegamorphicCache);
+    m_getObjectMegamorphicCache = new GetObjectMegamorphicCache();
+}
+
+void VMInstance::createJSONStringifyShapeCache()
+{
+    ASSERT(!m_jsonStringifyShapeCache);
+    m_jsonStringifyShapeCache = new JSONStringifyShapeCache();
+}
+
+void VMInstance::updateByteCodeBlockHotness()
+{
+    m_byteCodeEpoch++;
+    auto& v = compiledByteCodeBlocks();
+    for (size_t i = 0; i < v.size(); i++) {
+        ByteCodeBlock* block = v[i];
+        // shift usage history so that functions which were hot only in the past cool down
+        block->m_usageHistory >>= 1;
+        if (block->m_calledSinceLastGC) {
+            block->m_lastUsedEpoch = m_byteCodeEpoch;
+            block->m_usageHistory |= 1u << 31;
+            block->m_calledSinceLastGC = false;
+        }
+    }
+}
+
+// release ByteCodeBlocks from the coldest one until compiled bytecode size goes down to targetSize
+// every ByteCodeBlock is released if targetSize is zero
+void VMInstance::evictByteCodeBlocks(size_t targetSize)
+{
+    std::vector<ByteCodeBlock*> candidates;
+    auto& v = compiledByteCodeBlocks();
+    for (size_t i = 0; i < v.size(); i++) {
+        // ByteCodeBlock of top CodeBlock should be remove by Script class
+        if (v[i]->m_codeBlock->parent()) {
+            candidates.push_back(v[i]);
+        }
+    }
+
+    if (targetSize) {
+        if (m_byteCodeEvictionPolicy == EvictLeastFrequentlyUsed) {
+            std::sort(candidates.begin(), candidates.end(), [](ByteCodeBlock* a, ByteCodeBlock* b) {
+                if (a->m_usageHistory != b->m_usageHistory) {
+                    return a->m_usageHistory < b->m_usageHistory;
+                }
+                return a->m_lastUsedEpoch < b->m_lastUsedEpoch;
+            });
+        } else {
+            ASSERT(m_byteCodeEvictionPolicy == EvictLeastRecentlyUsed);
+            std::sort(candidates.begin(), candidates.end(), [](ByteCodeBlock* a, ByteCodeBlock* b) {
+                if (a->m_lastUsedEpoch != b->m_lastUsedEpoch) {
+                    return a->m_lastUsedEpoch < b->m_lastUsedEpoch;
+                }
+                return a->m_usageHistory < b->m_usageHistory;
+            });
+        }
+    }
+
+    size_t remainSize = m_compiledByteCodeSize;
+    for (size_t i = 0; i < candidates.size(); i++) {
+        if (targetSize && remainSize <= targetSize) {
+            break;
+        }
+        ByteCodeBlock* block = candidates[i];
+        block->m_codeBlock->setByteCodeBlock(nullptr);
+        block->m_codeBlock->setByteCodeBlockEvicted(true);
+        m_evictingByteCodeBlockCount++;
+        remainSize -= std::min(remainSize, block->memoryAllocatedSize());
+    }
+}
+
+size_t VMInstance::getObjectMegamorphicCacheHitCount()
+{
+    return m_getObjectMegamorphicCache ? m_getObjectMegamorphicCache->hitCount() : 0;
+}
+
+size_t VMInstance::getObjectMegamorphicCacheMissCount()
+{
+    return m_getObjectMegamorphicCache ? m_getObjectMegamorphicCache->missCount() : 0;
+}
+
+size_t VMInstance::regexpCacheSize()
+{
+    return m_regexpCache->size();
+}
+
+void VMInstance::startProfiling(uint32_t samplingIntervalInMicroseconds)
+{
+#if defined(ENABLE_SAMPLING_PROFILER)
+    if (isProfiling()) {
+        m_samplingProfiler->stop();
+    }
+    m_samplingProfiler = new SamplingProfiler(samplingIntervalInMicroseconds);
+    m_samplingProfiler->start();
+#else
+    // the interpreter has no safepoint to take samples
+    UNUSED_PARAMETER(samplingIntervalInMicroseconds);
+#endif
+}
+
+bool VMInstance::isProfiling()
+{
+    return m_samplingProfiler && m_samplingProfiler->isRunning();
+}
+
+SamplingProfiler* VMInstance::stopProfiling()
+{
+    if (!isProfiling()) {
+        return nullptr;
+    }
+    SamplingProfiler* profiler = m_samplingProfiler;
+    profiler->stop();
+    m_samplingProfiler = nullptr;
+    return profiler;
+}
+
 void VMInstance::clearCachesRelatedWithContext()
 {
     m_regexpCache->clear();
+    if (m_getObjectMegamorphicCache) {
+        m_getObjectMegamorphicCache->clear();
+    }
+    if (m_jsonStringifyShapeCache) {
+        m_jsonStringifyShapeCache->clear();
+    }
     globalSymbolRegistry().clear();
 #if defined(ENABLE_CODE_CACHE)
     // CodeCache should be cleared here because CodeCache holds a lock of cache directory
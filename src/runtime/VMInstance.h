@@ -42,6 +42,9 @@ class ReloadableString;
 #if defined(ENABLE_CODE_CACHE)
 class CodeCache;
 #endif
+class GetObjectMegamorphicCache;
+class JSONStringifyShapeCache;
+class SamplingProfiler;
 
 #define DEFINE_GLOBAL_SYMBOLS(F) \
     F(hasInstance)               \
@@ -211,6 +214,77 @@ public:
         m_maxCompiledByteCodeSize = s;
     }
 
+    // how ByteCodeBlocks are chosen to be released when compiled bytecode exceeds maxCompiledByteCodeSize
+    enum ByteCodeEvictionPolicy : uint8_t {
+        EvictAll,
+        EvictLeastRecentlyUsed,
+        EvictLeastFrequentlyUsed,
+    };
+
+    ByteCodeEvictionPolicy byteCodeEvictionPolicy()
+    {
+        return m_byteCodeEvictionPolicy;
+    }
+
+    void setByteCodeEvictionPolicy(ByteCodeEvictionPolicy policy)
+    {
+        m_byteCodeEvictionPolicy = policy;
+    }
+
+    // cold ByteCodeBlocks are released until compiled bytecode goes down to this size
+    size_t byteCodeEvictionTargetSize()
+    {
+        return m_byteCodeEvictionTargetSize;
+    }
+
+    void setByteCodeEvictionTargetSize(size_t s)
+    {
+        m_byteCodeEvictionTargetSize = s;
+    }
+
+    size_t evictedByteCodeBlockCount()
+    {
+        return m_evictedByteCodeBlockCount;
+    }
+
+    size_t& regeneratedByteCodeBlockCount()
+    {
+        return m_regeneratedByteCodeBlockCount;
+    }
+
+    GetObjectMegamorphicCache* getObjectMegamorphicCache()
+    {
+        if (UNLIKELY(!m_getObjectMegamorphicCache)) {
+            createGetObjectMegamorphicCache();
+        }
+        return m_getObjectMegamorphicCache;
+    }
+
+    size_t getObjectMegamorphicCacheHitCount();
+    size_t getObjectMegamorphicCacheMissCount();
+    size_t regexpCacheSize();
+
+    JSONStringifyShapeCache* jsonStringifyShapeCache()
+    {
+        if (UNLIKELY(!m_jsonStringifyShapeCache)) {
+            createJSONStringifyShapeCache();
+        }
+        return m_jsonStringifyShapeCache;
+    }
+
+    // null if profiling has never been started
+    SamplingProfiler* samplingProfiler()
+    {
+        return m_samplingProfiler;
+    }
+
+    // previous samples are discarded
+    // profiling does not start if ENABLE_SAMPLING_PROFILER is not defined
+    void startProfiling(uint32_t samplingIntervalInMicroseconds);
+    bool isProfiling();
+    // returns profiler which has collected samples
+    SamplingProfiler* stopProfiling();
+
 #if defined(ENABLE_COMPRESSIBLE_STRING)
     std::vector<CompressibleString*>& compressibleStrings()
     {
@@ -426,6 +500,26 @@ private:
     std::vector<ByteCodeBlock*> m_compiledByteCodeBlocks;
     size_t m_compiledByteCodeSize;
     size_t m_maxCompiledByteCodeSize;
+    size_t m_byteCodeEvictionTargetSize;
+    ByteCodeEvictionPolicy m_byteCodeEvictionPolicy;
+    // incremented on every GC. used as timestamp of ByteCodeBlock::m_lastUsedEpoch
+    uint32_t m_byteCodeEpoch;
+    // ByteCodeBlocks released by the current GC. some of them are restored if still in use
+    size_t m_evictingByteCodeBlockCount;
+    size_t m_evictedByteCodeBlockCount;
+    size_t m_regeneratedByteCodeBlockCount;
+    void updateByteCodeBlockHotness();
+    void evictByteCodeBlocks(size_t targetSize);
+
+    // allocated when the first GetObjectPreComputedCase site goes megamorphic
+    GetObjectMegamorphicCache* m_getObjectMegamorphicCache;
+    void createGetObjectMegamorphicCache();
+
+    // allocated when JSON.stringify first serializes an object
+    JSONStringifyShapeCache* m_jsonStringifyShapeCache;
+    void createJSONStringifyShapeCache();
+
+    SamplingProfiler* m_samplingProfiler;
 
 #if defined(ENABLE_COMPRESSIBLE_STRING)
     uint64_t m_lastCompressibleStringsTestTime;
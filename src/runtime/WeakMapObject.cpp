@@ -34,9 +34,9 @@ WeakMapObject::WeakMapObject(ExecutionState& state, Object* proto)
 {
     addFinalizer([](PointerValue* self, void* data) {
         auto wm = self->asWeakMapObject();
-        for (size_t i = 0; i < wm->m_storage.size(); i++) {
-            wm->m_storage[i]->key->removeFinalizer(WeakMapObject::finalizer, wm);
-        }
+        wm->m_storage.forEach([wm](WeakMapObjectDataItem* item) {
+            item->key->removeFinalizer(WeakMapObject::finalizer, wm);
+        });
         wm->m_storage.clear();
     },
                  nullptr);
@@ -76,13 +76,9 @@ void* WeakMapObject::WeakMapObjectDataItem::operator new(size_t size)
 bool WeakMapObject::deleteOperation(ExecutionState& state, PointerValue* key)
 {
     ASSERT(key->isObject() || key->isSymbol());
-    for (size_t i = 0; i < m_storage.size(); i++) {
-        auto existingKey = m_storage[i]->key;
-        if (existingKey == key) {
-            key->removeFinalizer(finalizer, this);
-            m_storage.erase(i);
-            return true;
-        }
+    if (m_storage.remove(key)) {
+        key->removeFinalizer(finalizer, this);
+        return true;
     }
     return false;
 }
@@ -90,11 +86,9 @@ bool WeakMapObject::deleteOperation(ExecutionState& state, PointerValue* key)
 Value WeakMapObject::get(ExecutionState& state, PointerValue* key)
 {
     ASSERT(key->isObject() || key->isSymbol());
-    for (size_t i = 0; i < m_storage.size(); i++) {
-        auto existingKey = m_storage[i]->key;
-        if (existingKey == key) {
-            return m_storage[i]->data;
-        }
+    auto item = m_storage.find(key);
+    if (item) {
+        return (*item)->data;
     }
     return Value();
 }
@@ -102,43 +96,31 @@ Value WeakMapObject::get(ExecutionState& state, PointerValue* key)
 bool WeakMapObject::has(ExecutionState& state, PointerValue* key)
 {
     ASSERT(key->isObject() || key->isSymbol());
-    for (size_t i = 0; i < m_storage.size(); i++) {
-        auto existingKey = m_storage[i]->key;
-        if (existingKey == key) {
-            return true;
-        }
-    }
-    return false;
+    return m_storage.find(key);
 }
 
 
 void WeakMapObject::set(ExecutionState& state, PointerValue* key, const Value& value)
 {
     ASSERT(key->isObject() || key->isSymbol());
-    for (size_t i = 0; i < m_storage.size(); i++) {
-        auto existingKey = m_storage[i]->key;
-        if (existingKey == key) {
-            m_storage[i]->data = value;
-            return;
-        }
+    auto item = m_storage.find(key);
+    if (item) {
+        (*item)->data = value;
+        return;
     }
 
     auto newData = new WeakMapObjectDataItem();
     newData->key = key;
     newData->data = value;
-    m_storage.pushBack(newData);
+    m_storage.add(newData);
 
     key->addFinalizer(WeakMapObject::finalizer, this);
 }
 
 void WeakMapObject::finalizer(PointerValue* self, void* data)
 {
+    // key is reclaimed by GC. purge its entry so that the table shrinks as keys die
     WeakMapObject* s = (WeakMapObject*)data;
-    for (size_t i = 0; i < s->m_storage.size(); i++) {
-        if (s->m_storage[i]->key == self) {
-            s->m_storage.erase(i);
-            break;
-        }
-    }
+    s->m_storage.remove(self);
 }
 } // namespace Escargot
@@ -21,6 +21,7 @@
 #define __EscargotWeakMapObject__
 
 #include "runtime/Object.h"
+#include "util/PointerHashTable.h"
 
 namespace Escargot {
 
@@ -34,7 +35,15 @@ public:
         void* operator new[](size_t size) = delete;
     };
 
-    typedef Vector<WeakMapObjectDataItem*, GCUtil::gc_malloc_allocator<WeakMapObjectDataItem*>> WeakMapObjectData;
+    struct WeakMapObjectDataItemKeyAccessor {
+        static const void* key(WeakMapObjectDataItem* item)
+        {
+            return item->key;
+        }
+    };
+
+    // items are reachable from the table but keys inside them are hidden from GC
+    typedef PointerHashTable<WeakMapObjectDataItem*, GCUtil::gc_malloc_allocator<WeakMapObjectDataItem*>, WeakMapObjectDataItemKeyAccessor> WeakMapObjectData;
 
     explicit WeakMapObject(ExecutionState& state);
     explicit WeakMapObject(ExecutionState& state, Object* proto);
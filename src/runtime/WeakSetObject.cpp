@@ -34,9 +34,9 @@ WeakSetObject::WeakSetObject(ExecutionState& state, Object* proto)
 {
     addFinalizer([](PointerValue* self, void* data) {
         auto ws = self->asWeakSetObject();
-        for (size_t i = 0; i < ws->m_storage.size(); i++) {
-            ws->m_storage[i]->removeFinalizer(WeakSetObject::finalizer, ws);
-        }
+        ws->m_storage.forEach([ws](PointerValue* key) {
+            key->removeFinalizer(WeakSetObject::finalizer, ws);
+        });
         ws->m_storage.clear();
     },
                  nullptr);
@@ -59,12 +59,9 @@ void* WeakSetObject::operator new(size_t size)
 bool WeakSetObject::deleteOperation(ExecutionState& state, PointerValue* key)
 {
     ASSERT(key->isObject() || key->isSymbol());
-    for (size_t i = 0; i < m_storage.size(); i++) {
-        if (m_storage[i] == key) {
-            key->removeFinalizer(finalizer, this);
-            m_storage.erase(i);
-            return true;
-        }
+    if (m_storage.remove(key)) {
+        key->removeFinalizer(finalizer, this);
+        return true;
     }
     return false;
 }
@@ -72,35 +69,24 @@ bool WeakSetObject::deleteOperation(ExecutionState& state, PointerValue* key)
 void WeakSetObject::add(ExecutionState& state, PointerValue* key)
 {
     ASSERT(key->isObject() || key->isSymbol());
-    for (size_t i = 0; i < m_storage.size(); i++) {
-        if (m_storage[i] == key) {
-            return;
-        }
+    if (m_storage.find(key)) {
+        return;
     }
 
     key->addFinalizer(WeakSetObject::finalizer, this);
-    m_storage.pushBack(key);
+    m_storage.add(key);
 }
 
 bool WeakSetObject::has(ExecutionState& state, PointerValue* key)
 {
     ASSERT(key->isObject() || key->isSymbol());
-    for (size_t i = 0; i < m_storage.size(); i++) {
-        if (m_storage[i] == key) {
-            return true;
-        }
-    }
-    return false;
+    return m_storage.find(key);
 }
 
 void WeakSetObject::finalizer(PointerValue* self, void* data)
 {
+    // key is reclaimed by GC. purge its entry so that the table shrinks as keys die
     WeakSetObject* s = (WeakSetObject*)data;
-    for (size_t i = 0; i < s->m_storage.size(); i++) {
-        if (s->m_storage[i] == self) {
-            s->m_storage.erase(i);
-            break;
-        }
-    }
+    s->m_storage.remove(self);
 }
 } // namespace Escargot
@@ -21,12 +21,21 @@
 #define __EscargotWeakSetObject__
 
 #include "runtime/Object.h"
+#include "util/PointerHashTable.h"
 
 namespace Escargot {
 
 class WeakSetObject : public DerivedObject {
 public:
-    typedef Vector<PointerValue*, GCUtil::gc_malloc_atomic_allocator<PointerValue*>> WeakSetObjectData;
+    struct WeakSetObjectDataKeyAccessor {
+        static const void* key(PointerValue* item)
+        {
+            return item;
+        }
+    };
+
+    // keys are stored in atomic memory so that GC cannot see them
+    typedef PointerHashTable<PointerValue*, GCUtil::gc_malloc_atomic_allocator<PointerValue*>, WeakSetObjectDataKeyAccessor> WeakSetObjectData;
 
     explicit WeakSetObject(ExecutionState& state);
     explicit WeakSetObject(ExecutionState& state, Object* proto);
@@ -1067,6 +1067,12 @@ int main(int argc, char* argv[])
     bool seenModule = false;
     std::string fileName;
     int exitCode = 0;
+    std::string cpuProfileFileName;
+    VMInstanceRef::ProfileFormat cpuProfileFormat = VMInstanceRef::ChromeCPUProfile;
+    unsigned cpuProfileInterval = 1000;
+    bool dumpOpcodeStats = false;
+    bool dumpGCPauses = false;
+    std::string heapSnapshotFileName;
 
     for (int i = 1; i < argc; i++) {
         if (strlen(argv[i]) >= 2 && argv[i][0] == '-') { // parse command line option
@@ -1111,6 +1117,53 @@ int main(int argc, char* argv[])
                     waitBeforeExit = true;
                     continue;
                 }
+                if (strstr(argv[i], "--cpu-profile=") == argv[i]) {
+                    if (!Globals::supportsSamplingProfiler()) {
+                        fprintf(stderr, "--cpu-profile needs ESCARGOT_SAMPLING_PROFILER build\n");
+                    }
+                    cpuProfileFileName = argv[i] + sizeof("--cpu-profile=") - 1;
+                    cpuProfileFormat = VMInstanceRef::ChromeCPUProfile;
+                    instance->startProfiling(cpuProfileInterval);
+                    continue;
+                }
+                if (strstr(argv[i], "--cpu-profile-folded=") == argv[i]) {
+                    if (!Globals::supportsSamplingProfiler()) {
+                        fprintf(stderr, "--cpu-profile-folded needs ESCARGOT_SAMPLING_PROFILER build\n");
+                    }
+                    cpuProfileFileName = argv[i] + sizeof("--cpu-profile-folded=") - 1;
+                    cpuProfileFormat = VMInstanceRef::FoldedStacks;
+                    instance->startProfiling(cpuProfileInterval);
+                    continue;
+                }
+                if (strcmp(argv[i], "--dump-opcode-stats") == 0) {
+                    if (!Globals::supportsOpcodeStats()) {
+                        fprintf(stderr, "--dump-opcode-stats needs ESCARGOT_OPCODE_STATS build\n");
+                    }
+                    dumpOpcodeStats = true;
+                    continue;
+                }
+                if (strstr(argv[i], "--gc-incremental=") == argv[i]) {
+                    size_t pauseTimeTarget = atoi(argv[i] + sizeof("--gc-incremental=") - 1);
+                    if (!Memory::setGCCollectionMode(Memory::INCREMENTAL, pauseTimeTarget)) {
+                        fprintf(stderr, "incremental GC is not supported by this build\n");
+                    }
+                    continue;
+                }
+                if (strcmp(argv[i], "--dump-gc-pauses") == 0) {
+                    dumpGCPauses = true;
+                    continue;
+                }
+                if (strstr(argv[i], "--heap-snapshot=") == argv[i]) {
+                    heapSnapshotFileName = argv[i] + sizeof("--heap-snapshot=") - 1;
+                    continue;
+                }
+                if (strstr(argv[i], "--cpu-profile-interval=") == argv[i]) {
+                    cpuProfileInterval = atoi(argv[i] + sizeof("--cpu-profile-interval=") - 1);
+                    if (instance->isProfiling()) {
+                        instance->startProfiling(cpuProfileInterval);
+                    }
+                    continue;
+                }
             } else { // `-option` case
                 if (strcmp(argv[i], "-e") == 0) {
                     runShell = false;
@@ -1207,6 +1260,43 @@ int main(int argc, char* argv[])
     }
 #endif
 
+    if (instance->isProfiling()) {
+        std::string profile = instance->stopProfiling(cpuProfileFormat);
+        FILE* fp = fopen(cpuProfileFileName.data(), "w");
+        if (fp) {
+            fwrite(profile.data(), 1, profile.length(), fp);
+            fclose(fp);
+        } else {
+            fprintf(stderr, "Cannot write cpu profile to %s\n", cpuProfileFileName.data());
+        }
+    }
+
+    if (dumpOpcodeStats && Globals::supportsOpcodeStats()) {
+        fprintf(stderr, "%s\n", Globals::dumpOpcodeStats().data());
+    }
+
+    if (dumpGCPauses) {
+        Memory::GCPauseHistogram pauses = Memory::gcPauseHistogram();
+        fprintf(stderr, "GC pauses: %zu total %.3fms max %.3fms\n", pauses.count, pauses.totalMicroseconds / 1000.0, pauses.maxMicroseconds / 1000.0);
+        for (size_t i = 0; i < Memory::GCPauseHistogramBucketCount; i++) {
+            if (i + 1 < Memory::GCPauseHistogramBucketCount) {
+                fprintf(stderr, "  < %zums: %zu\n", (size_t)1 << i, pauses.buckets[i]);
+            } else {
+                fprintf(stderr, "  >= %zums: %zu\n", (size_t)1 << (i - 1), pauses.buckets[i]);
+            }
+        }
+    }
+
+    if (heapSnapshotFileName.length()) {
+        FILE* fp = fopen(heapSnapshotFileName.data(), "w");
+        if (!fp || !Memory::writeHeapSnapshot(fileno(fp))) {
+            fprintf(stderr, "Cannot write heap snapshot to %s\n", heapSnapshotFileName.data());
+        }
+        if (fp) {
+            fclose(fp);
+        }
+    }
+
     context.release();
     instance.release();
 
@@ -0,0 +1,197 @@
+/*
+ * Copyright (c) 2024-present Samsung Electronics Co., Ltd
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+ *  USA
+ */
+
+#ifndef __EscargotPointerHashTable__
+#define __EscargotPointerHashTable__
+
+namespace Escargot {
+
+// Open addressing(linear probing) hash table keyed by pointer identity
+// T should be a pointer-sized type and null T means an empty slot
+// m_buffer is placed at first so that owner can mark the table like a Vector
+// (use gc_malloc_atomic_allocator to hide keys from GC)
+template <typename T, typename Allocator, typename KeyAccessor>
+class PointerHashTable {
+public:
+    enum : size_t { MinimumCapacity = 8 };
+
+    PointerHashTable()
+        : m_buffer(nullptr)
+        , m_capacity(0)
+        , m_size(0)
+        , m_hashShift(0)
+    {
+    }
+
+    ~PointerHashTable()
+    {
+        clear();
+    }
+
+    PointerHashTable(const PointerHashTable<T, Allocator, KeyAccessor>& other) = delete;
+    const PointerHashTable<T, Allocator, KeyAccessor>& operator=(const PointerHashTable<T, Allocator, KeyAccessor>& other) = delete;
+
+    size_t size() const
+    {
+        return m_size;
+    }
+
+    size_t capacity() const
+    {
+        return m_capacity;
+    }
+
+    T* find(const void* key) const
+    {
+        if (!m_size) {
+            return nullptr;
+        }
+        const size_t mask = m_capacity - 1;
+        for (size_t i = bucketIndex(key);; i = (i + 1) & mask) {
+            if (!m_buffer[i]) {
+                return nullptr;
+            }
+            if (KeyAccessor::key(m_buffer[i]) == key) {
+                return &m_buffer[i];
+            }
+        }
+    }
+
+    // caller should check there is no item with same key
+    void add(const T& item)
+    {
+        ASSERT(!!item);
+        ASSERT(!find(KeyAccessor::key(item)));
+        if ((m_size + 1) * 2 > m_capacity) {
+            rehash(m_capacity ? m_capacity * 2 : MinimumCapacity);
+        }
+        insertWithoutExpanding(item);
+        m_size++;
+    }
+
+    bool remove(const void* key)
+    {
+        T* slot = find(key);
+        if (!slot) {
+            return false;
+        }
+
+        // backward shift deletion keeps every probe sequence continuous without tombstones
+        const size_t mask = m_capacity - 1;
+        size_t hole = slot - m_buffer;
+        for (size_t i = (hole + 1) & mask; m_buffer[i]; i = (i + 1) & mask) {
+            size_t home = bucketIndex(KeyAccessor::key(m_buffer[i]));
+            // move the item to the hole if the hole lies in between home and current position
+            if (((i - home) & mask) >= ((i - hole) & mask)) {
+                m_buffer[hole] = m_buffer[i];
+                hole = i;
+            }
+        }
+        m_buffer[hole] = T();
+        m_size--;
+
+        if (m_size * 8 < m_capacity && m_capacity > MinimumCapacity) {
+            rehash(m_capacity / 2);
+        }
+        return true;
+    }
+
+    void clear()
+    {
+        if (m_buffer) {
+            Allocator().deallocate(m_buffer, m_capacity);
+        }
+        m_buffer = nullptr;
+        m_capacity = 0;
+        m_size = 0;
+        m_hashShift = 0;
+    }
+
+    template <typename Func>
+    void forEach(const Func& fn) const
+    {
+        for (size_t i = 0; i < m_capacity; i++) {
+            if (m_buffer[i]) {
+                fn(m_buffer[i]);
+            }
+        }
+    }
+
+private:
+    // Fibonacci hashing: multiply by 2^N / golden ratio and take the high bits of the product
+    // high bits depend on every bit of the key, so the always-zero low bits of GC pointers don't matter
+    size_t bucketIndex(const void* key) const
+    {
+        ASSERT(m_capacity);
+        size_t h = reinterpret_cast<size_t>(key);
+        if (sizeof(size_t) == 8) {
+            h *= static_cast<size_t>(0x9E3779B97F4A7C15ULL);
+        } else {
+            h *= static_cast<size_t>(0x9E3779B9U);
+        }
+        return h >> m_hashShift;
+    }
+
+    void insertWithoutExpanding(const T& item)
+    {
+        const size_t mask = m_capacity - 1;
+        size_t i = bucketIndex(KeyAccessor::key(item));
+        while (m_buffer[i]) {
+            i = (i + 1) & mask;
+        }
+        m_buffer[i] = item;
+    }
+
+    void rehash(size_t newCapacity)
+    {
+        ASSERT((newCapacity & (newCapacity - 1)) == 0);
+        ASSERT(m_size * 2 <= newCapacity);
+        T* oldBuffer = m_buffer;
+        size_t oldCapacity = m_capacity;
+
+        m_buffer = Allocator().allocate(newCapacity);
+        m_capacity = newCapacity;
+        m_hashShift = sizeof(size_t) * 8;
+        for (size_t c = newCapacity; c > 1; c >>= 1) {
+            m_hashShift--;
+        }
+        for (size_t i = 0; i < newCapacity; i++) {
+            m_buffer[i] = T();
+        }
+
+        for (size_t i = 0; i < oldCapacity; i++) {
+            if (oldBuffer[i]) {
+                insertWithoutExpanding(oldBuffer[i]);
+            }
+        }
+
+        if (oldBuffer) {
+            Allocator().deallocate(oldBuffer, oldCapacity);
+        }
+    }
+
+    T* m_buffer;
+    size_t m_capacity;
+    size_t m_size;
+    size_t m_hashShift; // word bits - log2(m_capacity)
+};
+
+} // namespace Escargot
+
+#endif
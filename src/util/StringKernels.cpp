@@ -0,0 +1,458 @@
+/*
+ * Copyright (c) 2024-present Samsung Electronics Co., Ltd
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+ *  USA
+ */
+
+#include "Escargot.h"
+#include "StringKernels.h"
+
+#if defined(CPU_X86_64) || (defined(CPU_X86) && defined(__SSE2__))
+#define ENABLE_STRING_KERNELS_SSE2
+#include <emmintrin.h>
+#if defined(COMPILER_GCC) || (defined(COMPILER_CLANG) && !defined(COMPILER_CLANG_CL))
+#define ENABLE_STRING_KERNELS_AVX2
+#include <immintrin.h>
+#endif
+#elif defined(CPU_ARM64) && !defined(COMPILER_MSVC)
+#define ENABLE_STRING_KERNELS_NEON
+#include <arm_neon.h>
+#endif
+
+#if defined(COMPILER_MSVC)
+#include <intrin.h>
+#endif
+
+namespace Escargot {
+
+#if defined(ENABLE_STRING_KERNELS_SSE2)
+static ALWAYS_INLINE unsigned countTrailingZeros(uint32_t v)
+{
+    ASSERT(v);
+#if defined(COMPILER_MSVC)
+    unsigned long index;
+    _BitScanForward(&index, v);
+    return index;
+#else
+    return __builtin_ctz(v);
+#endif
+}
+#endif
+
+#if defined(ENABLE_STRING_KERNELS_AVX2)
+static bool cpuSupportsAVX2()
+{
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("avx2");
+}
+
+// SSE2 kernels are used until this is initialized
+static const bool g_cpuSupportsAVX2 = cpuSupportsAVX2();
+#endif
+
+template <typename CharType, char16_t limit>
+static ALWAYS_INLINE size_t scalarLengthBelow(const CharType* src, size_t start, size_t length)
+{
+    size_t i = start;
+    for (; i < length; i++) {
+        if (src[i] >= limit) {
+            break;
+        }
+    }
+    return i;
+}
+
+size_t StringKernels::asciiLength(const LChar* src, size_t length)
+{
+    size_t i = 0;
+#if defined(ENABLE_STRING_KERNELS_SSE2)
+    // check 64 bytes at once for long ASCII text like UTF-8 source code
+    for (; i + 64 <= length; i += 64) {
+        __m128i a = _mm_loadu_si128((const __m128i*)(src + i));
+        __m128i b = _mm_loadu_si128((const __m128i*)(src + i + 16));
+        __m128i c = _mm_loadu_si128((const __m128i*)(src + i + 32));
+        __m128i d = _mm_loadu_si128((const __m128i*)(src + i + 48));
+        if (_mm_movemask_epi8(_mm_or_si128(_mm_or_si128(a, b), _mm_or_si128(c, d)))) {
+            break;
+        }
+    }
+    for (; i + 16 <= length; i += 16) {
+        uint32_t mask = _mm_movemask_epi8(_mm_loadu_si128((const __m128i*)(src + i)));
+        if (mask) {
+            return i + countTrailingZeros(mask);
+        }
+    }
+#elif defined(ENABLE_STRING_KERNELS_NEON)
+    for (; i + 16 <= length; i += 16) {
+        if (vmaxvq_u8(vld1q_u8(src + i)) >= 0x80) {
+            break;
+        }
+    }
+#endif
+    return scalarLengthBelow<LChar, 0x80>(src, i, length);
+}
+
+#if defined(ENABLE_STRING_KERNELS_SSE2)
+// index of the first 16-bit character which has a bit of mask
+static ALWAYS_INLINE size_t lengthWithoutBitsSSE2(const char16_t* src, size_t length, uint16_t bits, size_t& i)
+{
+    const __m128i mask = _mm_set1_epi16((short)bits);
+    const __m128i zero = _mm_setzero_si128();
+    for (; i + 8 <= length; i += 8) {
+        __m128i v = _mm_loadu_si128((const __m128i*)(src + i));
+        uint32_t found = ~_mm_movemask_epi8(_mm_cmpeq_epi16(_mm_and_si128(v, mask), zero)) & 0xFFFF;
+        if (found) {
+            return i + countTrailingZeros(found) / 2;
+        }
+    }
+    return SIZE_MAX;
+}
+#endif
+
+size_t StringKernels::asciiLength(const char16_t* src, size_t length)
+{
+    size_t i = 0;
+#if defined(ENABLE_STRING_KERNELS_SSE2)
+    size_t result = lengthWithoutBitsSSE2(src, length, 0xFF80, i);
+    if (result != SIZE_MAX) {
+        return result;
+    }
+#elif defined(ENABLE_STRING_KERNELS_NEON)
+    for (; i + 8 <= length; i += 8) {
+        if (vmaxvq_u16(vld1q_u16((const uint16_t*)(src + i))) >= 0x80) {
+            break;
+        }
+    }
+#endif
+    return scalarLengthBelow<char16_t, 0x80>(src, i, length);
+}
+
+size_t StringKernels::latin1Length(const char16_t* src, size_t length)
+{
+    size_t i = 0;
+#if defined(ENABLE_STRING_KERNELS_SSE2)
+    size_t result = lengthWithoutBitsSSE2(src, length, 0xFF00, i);
+    if (result != SIZE_MAX) {
+        return result;
+    }
+#elif defined(ENABLE_STRING_KERNELS_NEON)
+    for (; i + 8 <= length; i += 8) {
+        if (vmaxvq_u16(vld1q_u16((const uint16_t*)(src + i))) >= 0x100) {
+            break;
+        }
+    }
+#endif
+    return scalarLengthBelow<char16_t, 0x100>(src, i, length);
+}
+
+bool StringKernels::equals(const char16_t* s1, const LChar* s2, size_t length)
+{
+    size_t i = 0;
+#if defined(ENABLE_STRING_KERNELS_SSE2)
+    const __m128i zero = _mm_setzero_si128();
+    for (; i + 16 <= length; i += 16) {
+        __m128i narrowChars = _mm_loadu_si128((const __m128i*)(s2 + i));
+        __m128i low = _mm_cmpeq_epi16(_mm_unpacklo_epi8(narrowChars, zero), _mm_loadu_si128((const __m128i*)(s1 + i)));
+        __m128i high = _mm_cmpeq_epi16(_mm_unpackhi_epi8(narrowChars, zero), _mm_loadu_si128((const __m128i*)(s1 + i + 8)));
+        if (_mm_movemask_epi8(_mm_and_si128(low, high)) != 0xFFFF) {
+            return false;
+        }
+    }
+#elif defined(ENABLE_STRING_KERNELS_NEON)
+    for (; i + 16 <= length; i += 16) {
+        uint8x16_t narrowChars = vld1q_u8(s2 + i);
+        uint16x8_t low = vceqq_u16(vmovl_u8(vget_low_u8(narrowChars)), vld1q_u16((const uint16_t*)(s1 + i)));
+        uint16x8_t high = vceqq_u16(vmovl_u8(vget_high_u8(narrowChars)), vld1q_u16((const uint16_t*)(s1 + i + 8)));
+        if (vminvq_u16(vandq_u16(low, high)) != 0xFFFF) {
+            return false;
+        }
+    }
+#endif
+    for (; i < length; i++) {
+        if (s1[i] != s2[i]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void StringKernels::widen(const LChar* src, size_t length, char16_t* dst)
+{
+    size_t i = 0;
+#if defined(ENABLE_STRING_KERNELS_SSE2)
+    const __m128i zero = _mm_setzero_si128();
+    for (; i + 16 <= length; i += 16) {
+        __m128i v = _mm_loadu_si128((const __m128i*)(src + i));
+        _mm_storeu_si128((__m128i*)(dst + i), _mm_unpacklo_epi8(v, zero));
+        _mm_storeu_si128((__m128i*)(dst + i + 8), _mm_unpackhi_epi8(v, zero));
+    }
+#elif defined(ENABLE_STRING_KERNELS_NEON)
+    for (; i + 16 <= length; i += 16) {
+        uint8x16_t v = vld1q_u8(src + i);
+        vst1q_u16((uint16_t*)(dst + i), vmovl_u8(vget_low_u8(v)));
+        vst1q_u16((uint16_t*)(dst + i + 8), vmovl_u8(vget_high_u8(v)));
+    }
+#endif
+    for (; i < length; i++) {
+        dst[i] = src[i];
+    }
+}
+
+void StringKernels::narrow(const char16_t* src, size_t length, LChar* dst)
+{
+    size_t i = 0;
+#if defined(ENABLE_STRING_KERNELS_SSE2)
+    for (; i + 16 <= length; i += 16) {
+        // every character is below 256 so that saturation does not happen
+        __m128i low = _mm_loadu_si128((const __m128i*)(src + i));
+        __m128i high = _mm_loadu_si128((const __m128i*)(src + i + 8));
+        _mm_storeu_si128((__m128i*)(dst + i), _mm_packus_epi16(low, high));
+    }
+#elif defined(ENABLE_STRING_KERNELS_NEON)
+    for (; i + 16 <= length; i += 16) {
+        uint8x8_t low = vmovn_u16(vld1q_u16((const uint16_t*)(src + i)));
+        uint8x8_t high = vmovn_u16(vld1q_u16((const uint16_t*)(src + i + 8)));
+        vst1q_u8(dst + i, vcombine_u8(low, high));
+    }
+#endif
+    for (; i < length; i++) {
+        ASSERT(src[i] < 256);
+        dst[i] = src[i];
+    }
+}
+
+// Substring search filters candidate positions by comparing the first and the last character
+// of needle with a block of haystack at once, then compares the rest of needle on each candidate
+
+template <typename HaystackType, typename NeedleType>
+static ALWAYS_INLINE bool matchesAt(const HaystackType* haystack, const NeedleType* needle, size_t needleLength)
+{
+    // the first and the last characters are already compared
+    for (size_t k = 1; k + 1 < needleLength; k++) {
+        if (haystack[k] != needle[k]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+template <typename CharType>
+static ALWAYS_INLINE bool matchesAt(const CharType* haystack, const CharType* needle, size_t needleLength)
+{
+    return needleLength <= 2 || memcmp(haystack + 1, needle + 1, (needleLength - 2) * sizeof(CharType)) == 0;
+}
+
+template <typename HaystackType, typename NeedleType>
+static size_t findScalar(const HaystackType* haystack, size_t start, size_t haystackLength, const NeedleType* needle, size_t needleLength)
+{
+    const size_t lastOffset = needleLength - 1;
+    const NeedleType first = needle[0];
+    const NeedleType last = needle[lastOffset];
+    for (size_t i = start; i + lastOffset < haystackLength; i++) {
+        if (haystack[i] == first && haystack[i + lastOffset] == last && matchesAt(haystack + i, needle, needleLength)) {
+            return i;
+        }
+    }
+    return SIZE_MAX;
+}
+
+#if defined(ENABLE_STRING_KERNELS_SSE2)
+template <typename NeedleType>
+static size_t findSSE2(const LChar* haystack, size_t haystackLength, const NeedleType* needle, size_t needleLength)
+{
+    const size_t lastOffset = needleLength - 1;
+    const __m128i first = _mm_set1_epi8((char)needle[0]);
+    const __m128i last = _mm_set1_epi8((char)needle[lastOffset]);
+    size_t i = 0;
+    for (; i + lastOffset + 16 <= haystackLength; i += 16) {
+        __m128i blockFirst = _mm_loadu_si128((const __m128i*)(haystack + i));
+        __m128i blockLast = _mm_loadu_si128((const __m128i*)(haystack + i + lastOffset));
+        uint32_t mask = _mm_movemask_epi8(_mm_and_si128(_mm_cmpeq_epi8(blockFirst, first), _mm_cmpeq_epi8(blockLast, last)));
+        while (mask) {
+            size_t candidate = i + countTrailingZeros(mask);
+            if (matchesAt(haystack + candidate, needle, needleLength)) {
+                return candidate;
+            }
+            mask &= mask - 1;
+        }
+    }
+    return findScalar(haystack, i, haystackLength, needle, needleLength);
+}
+
+template <typename NeedleType>
+static size_t findSSE2(const char16_t* haystack, size_t haystackLength, const NeedleType* needle, size_t needleLength)
+{
+    const size_t lastOffset = needleLength - 1;
+    const __m128i first = _mm_set1_epi16((short)needle[0]);
+    const __m128i last = _mm_set1_epi16((short)needle[lastOffset]);
+    size_t i = 0;
+    for (; i + lastOffset + 8 <= haystackLength; i += 8) {
+        __m128i blockFirst = _mm_loadu_si128((const __m128i*)(haystack + i));
+        __m128i blockLast = _mm_loadu_si128((const __m128i*)(haystack + i + lastOffset));
+        // two bits per character
+        uint32_t mask = _mm_movemask_epi8(_mm_and_si128(_mm_cmpeq_epi16(blockFirst, first), _mm_cmpeq_epi16(blockLast, last))) & 0x5555;
+        while (mask) {
+            size_t candidate = i + countTrailingZeros(mask) / 2;
+            if (matchesAt(haystack + candidate, needle, needleLength)) {
+                return candidate;
+            }
+            mask &= mask - 1;
+        }
+    }
+    return findScalar(haystack, i, haystackLength, needle, needleLength);
+}
+#endif
+
+#if defined(ENABLE_STRING_KERNELS_AVX2)
+template <typename NeedleType>
+__attribute__((target("avx2"))) static size_t findAVX2(const LChar* haystack, size_t haystackLength, const NeedleType* needle, size_t needleLength)
+{
+    const size_t lastOffset = needleLength - 1;
+    const __m256i first = _mm256_set1_epi8((char)needle[0]);
+    const __m256i last = _mm256_set1_epi8((char)needle[lastOffset]);
+    size_t i = 0;
+    for (; i + lastOffset + 32 <= haystackLength; i += 32) {
+        __m256i blockFirst = _mm256_loadu_si256((const __m256i*)(haystack + i));
+        __m256i blockLast = _mm256_loadu_si256((const __m256i*)(haystack + i + lastOffset));
+        uint32_t mask = (uint32_t)_mm256_movemask_epi8(_mm256_and_si256(_mm256_cmpeq_epi8(blockFirst, first), _mm256_cmpeq_epi8(blockLast, last)));
+        while (mask) {
+            size_t candidate = i + countTrailingZeros(mask);
+            if (matchesAt(haystack + candidate, needle, needleLength)) {
+                return candidate;
+            }
+            mask &= mask - 1;
+        }
+    }
+    return findScalar(haystack, i, haystackLength, needle, needleLength);
+}
+
+template <typename NeedleType>
+__attribute__((target("avx2"))) static size_t findAVX2(const char16_t* haystack, size_t haystackLength, const NeedleType* needle, size_t needleLength)
+{
+    const size_t lastOffset = needleLength - 1;
+    const __m256i first = _mm256_set1_epi16((short)needle[0]);
+    const __m256i last = _mm256_set1_epi16((short)needle[lastOffset]);
+    size_t i = 0;
+    for (; i + lastOffset + 16 <= haystackLength; i += 16) {
+        __m256i blockFirst = _mm256_loadu_si256((const __m256i*)(haystack + i));
+        __m256i blockLast = _mm256_loadu_si256((const __m256i*)(haystack + i + lastOffset));
+        // two bits per character
+        uint32_t mask = (uint32_t)_mm256_movemask_epi8(_mm256_and_si256(_mm256_cmpeq_epi16(blockFirst, first), _mm256_cmpeq_epi16(blockLast, last))) & 0x55555555;
+        while (mask) {
+            size_t candidate = i + countTrailingZeros(mask) / 2;
+            if (matchesAt(haystack + candidate, needle, needleLength)) {
+                return candidate;
+            }
+            mask &= mask - 1;
+        }
+    }
+    return findScalar(haystack, i, haystackLength, needle, needleLength);
+}
+#endif
+
+#if defined(ENABLE_STRING_KERNELS_NEON)
+template <typename NeedleType>
+static size_t findNEON(const LChar* haystack, size_t haystackLength, const NeedleType* needle, size_t needleLength)
+{
+    const size_t lastOffset = needleLength - 1;
+    const uint8x16_t first = vdupq_n_u8((uint8_t)needle[0]);
+    const uint8x16_t last = vdupq_n_u8((uint8_t)needle[lastOffset]);
+    size_t i = 0;
+    for (; i + lastOffset + 16 <= haystackLength; i += 16) {
+        uint8x16_t eq = vandq_u8(vceqq_u8(vld1q_u8(haystack + i), first), vceqq_u8(vld1q_u8(haystack + i + lastOffset), last));
+        // four bits per character
+        uint64_t mask = vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(eq), 4)), 0);
+        while (mask) {
+            size_t lane = __builtin_ctzll(mask) / 4;
+            if (matchesAt(haystack + i + lane, needle, needleLength)) {
+                return i + lane;
+            }
+            mask &= ~(0xFULL << (lane * 4));
+        }
+    }
+    return findScalar(haystack, i, haystackLength, needle, needleLength);
+}
+
+template <typename NeedleType>
+static size_t findNEON(const char16_t* haystack, size_t haystackLength, const NeedleType* needle, size_t needleLength)
+{
+    const size_t lastOffset = needleLength - 1;
+    const uint16x8_t first = vdupq_n_u16((uint16_t)needle[0]);
+    const uint16x8_t last = vdupq_n_u16((uint16_t)needle[lastOffset]);
+    size_t i = 0;
+    for (; i + lastOffset + 8 <= haystackLength; i += 8) {
+        uint16x8_t eq = vandq_u16(vceqq_u16(vld1q_u16((const uint16_t*)(haystack + i)), first), vceqq_u16(vld1q_u16((const uint16_t*)(haystack + i + lastOffset)), last));
+        // eight bits per character
+        uint64_t mask = vget_lane_u64(vreinterpret_u64_u8(vmovn_u16(eq)), 0);
+        while (mask) {
+            size_t lane = __builtin_ctzll(mask) / 8;
+            if (matchesAt(haystack + i + lane, needle, needleLength)) {
+                return i + lane;
+            }
+            mask &= ~(0xFFULL << (lane * 8));
+        }
+    }
+    return findScalar(haystack, i, haystackLength, needle, needleLength);
+}
+#endif
+
+template <typename HaystackType, typename NeedleType>
+static ALWAYS_INLINE size_t findImpl(const HaystackType* haystack, size_t haystackLength, const NeedleType* needle, size_t needleLength)
+{
+    ASSERT(needleLength);
+    if (needleLength > haystackLength) {
+        return SIZE_MAX;
+    }
+    // 16-bit character of needle which is not Latin1 never matches with 8-bit haystack
+    if (sizeof(NeedleType) > sizeof(HaystackType) && (needle[0] > 0xFF || needle[needleLength - 1] > 0xFF)) {
+        return SIZE_MAX;
+    }
+
+#if defined(ENABLE_STRING_KERNELS_AVX2)
+    if (g_cpuSupportsAVX2) {
+        return findAVX2(haystack, haystackLength, needle, needleLength);
+    }
+#endif
+#if defined(ENABLE_STRING_KERNELS_SSE2)
+    return findSSE2(haystack, haystackLength, needle, needleLength);
+#elif defined(ENABLE_STRING_KERNELS_NEON)
+    return findNEON(haystack, haystackLength, needle, needleLength);
+#else
+    return findScalar(haystack, 0, haystackLength, needle, needleLength);
+#endif
+}
+
+size_t StringKernels::find(const LChar* haystack, size_t haystackLength, const LChar* needle, size_t needleLength)
+{
+    return findImpl(haystack, haystackLength, needle, needleLength);
+}
+
+size_t StringKernels::find(const LChar* haystack, size_t haystackLength, const char16_t* needle, size_t needleLength)
+{
+    return findImpl(haystack, haystackLength, needle, needleLength);
+}
+
+size_t StringKernels::find(const char16_t* haystack, size_t haystackLength, const LChar* needle, size_t needleLength)
+{
+    return findImpl(haystack, haystackLength, needle, needleLength);
+}
+
+size_t StringKernels::find(const char16_t* haystack, size_t haystackLength, const char16_t* needle, size_t needleLength)
+{
+    return findImpl(haystack, haystackLength, needle, needleLength);
+}
+
+} // namespace Escargot
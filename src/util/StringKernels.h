@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) 2024-present Samsung Electronics Co., Ltd
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+ *  USA
+ */
+
+#ifndef __EscargotStringKernels__
+#define __EscargotStringKernels__
+
+namespace Escargot {
+
+typedef unsigned char LChar;
+
+// Vectorized loops over raw character buffers
+// SSE2 on x86-64 (substring search uses AVX2 if the cpu supports it), NEON on AArch64
+// and scalar loops on other targets
+class StringKernels {
+public:
+    // number of leading ASCII (or Latin1) characters
+    static size_t asciiLength(const LChar* src, size_t length);
+    static size_t asciiLength(const char16_t* src, size_t length);
+    static size_t latin1Length(const char16_t* src, size_t length);
+
+    static bool isAllASCII(const LChar* src, size_t length)
+    {
+        return asciiLength(src, length) == length;
+    }
+
+    static bool isAllASCII(const char16_t* src, size_t length)
+    {
+        return asciiLength(src, length) == length;
+    }
+
+    static bool isAllLatin1(const char16_t* src, size_t length)
+    {
+        return latin1Length(src, length) == length;
+    }
+
+    static bool equals(const char16_t* s1, const LChar* s2, size_t length);
+
+    // dst should have room for length characters
+    static void widen(const LChar* src, size_t length, char16_t* dst);
+    // every character of src should be Latin1
+    static void narrow(const char16_t* src, size_t length, LChar* dst);
+
+    // returns the first index of needle in haystack or SIZE_MAX
+    // needle should not be empty
+    static size_t find(const LChar* haystack, size_t haystackLength, const LChar* needle, size_t needleLength);
+    static size_t find(const LChar* haystack, size_t haystackLength, const char16_t* needle, size_t needleLength);
+    static size_t find(const char16_t* haystack, size_t haystackLength, const LChar* needle, size_t needleLength);
+    static size_t find(const char16_t* haystack, size_t haystackLength, const char16_t* needle, size_t needleLength);
+};
+
+} // namespace Escargot
+
+#endif
@@ -920,14 +920,7 @@ DEFINE_ERROR_CTOR(WASMRuntime, wasmRuntime)
 
 void GlobalObject::initializeWebAssembly(ExecutionState& state)
 {
-    ObjectPropertyNativeGetterSetterData* nativeData = new ObjectPropertyNativeGetterSetterData(true, false, true,
-                                                                                                [](ExecutionState& state, Object* self, const Value& receiver, const EncodedValue& privateDataFromObjectPrivateArea) -> Value {
-                                                                                                    ASSERT(self->isGlobalObject());
-                                                                                                    return self->asGlobalObject()->wasm();
-                                                                                                },
-                                                                                                nullptr);
-
-    defineNativeDataAccessorProperty(state, ObjectPropertyName(state.context()->staticStrings().WebAssembly), nativeData, Value(Value::EmptyValue));
+    defineBuiltinPlaceholder<Object, &GlobalObject::wasm>(state, ObjectPropertyName(state.context()->staticStrings().WebAssembly));
 }
 
 void GlobalObject::installWebAssembly(ExecutionState& state)
@@ -1117,7 +1110,7 @@ void GlobalObject::installWebAssembly(ExecutionState& state)
     DEFINE_ERROR(wasmRuntime, WASMRuntime, Runtime)
 
 
-    redefineOwnProperty(state, ObjectPropertyName(strings->WebAssembly),
+    replaceBuiltinValue(state, ObjectPropertyName(strings->WebAssembly),
                         ObjectPropertyDescriptor(wasm, (ObjectPropertyDescriptor::PresentAttribute)(ObjectPropertyDescriptor::WritablePresent | ObjectPropertyDescriptor::ConfigurablePresent)));
 }
 } // namespace Escargot
@@ -18,6 +18,7 @@
  */
 
 #include "api/EscargotPublic.h"
+#include "util/StringKernels.h"
 
 using namespace Escargot;
 
@@ -25,6 +26,19 @@ using namespace Escargot;
 
 #include <vector>
 
+#if !defined(_WIN32)
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+#if defined(ENABLE_CODE_CACHE)
+#include "codecache/CodeCacheFileWriter.h"
+
+#include <dirent.h>
+#include <stdlib.h>
+#include <sys/stat.h>
+#endif
+
 static bool stringEndsWith(const std::string& str, const std::string& suffix)
 {
     return str.size() >= suffix.size() && 0 == str.compare(str.size() - suffix.size(), suffix.size(), suffix);
@@ -589,6 +603,322 @@ TEST(EvalScript, RuntimeError)
     EXPECT_TRUE(s.find("Uncaught 1") == 0);
 }
 
+TEST(EvalScript, CodeCacheData)
+{
+    auto source = StringRef::createFromASCII("function add(a, b) { return a + b; } (function() { return add(1, 2) + add('a', 'b'); })()");
+    auto srcName = StringRef::createFromASCII("cached.js");
+    ScriptParserRef* parser = g_context->scriptParser();
+
+    ScriptRef* script = parser->initializeScript(source, srcName).script.value();
+    std::string data = parser->createCodeCacheData(script);
+
+    auto executeScript = [](ScriptParserRef::InitializeScriptResult initResult) -> std::string {
+        EXPECT_TRUE(initResult.isSuccessful());
+        auto result = Evaluator::execute(g_context.get(), [](ExecutionStateRef* state, ScriptRef* script) -> ValueRef* {
+            return script->execute(state);
+        }, initResult.script.value());
+        return result.resultOrErrorToString(g_context.get())->toStdUTF8String();
+    };
+
+    // empty data when code cache is not supported, then the source code is just parsed
+    bool codeCacheSupported = g_instance->isCodeCacheEnabled();
+    EXPECT_EQ(data.empty(), !codeCacheSupported);
+    auto initResult = parser->initializeScript(source, srcName, data.data(), data.size());
+    EXPECT_EQ(initResult.loadedFromCodeCache, codeCacheSupported);
+    EXPECT_EQ(executeScript(initResult), "3ab");
+
+    // cache data of another source code is ignored
+    auto otherSource = StringRef::createFromASCII("function add(a, b) { return a * b; } (function() { return add(2, 3); })()");
+    initResult = parser->initializeScript(otherSource, srcName, data.data(), data.size());
+    EXPECT_FALSE(initResult.loadedFromCodeCache);
+    EXPECT_EQ(executeScript(initResult), "6");
+
+    // broken cache data too
+    initResult = parser->initializeScript(source, srcName, data.data(), data.size() / 2);
+    EXPECT_FALSE(initResult.loadedFromCodeCache);
+    EXPECT_EQ(executeScript(initResult), "3ab");
+}
+
+#if defined(ENABLE_CODE_CACHE)
+static std::string createCodeCacheTestDir()
+{
+    char dirPath[] = "/tmp/escargot-cctest-XXXXXX";
+    EXPECT_TRUE(mkdtemp(dirPath) != nullptr);
+    return dirPath;
+}
+
+static void removeCodeCacheTestDir(const std::string& dirPath)
+{
+    // cache files are placed in Escargot-cache directory under the base directory
+    std::string cacheDirPath = dirPath + "/Escargot-cache/";
+    DIR* dir = opendir(cacheDirPath.data());
+    if (dir) {
+        struct dirent* entry;
+        while ((entry = readdir(dir)) != nullptr) {
+            if (strcmp(entry->d_name, ".") && strcmp(entry->d_name, "..")) {
+                unlink((cacheDirPath + entry->d_name).data());
+            }
+        }
+        closedir(dir);
+        rmdir(cacheDirPath.data());
+    }
+    rmdir(dirPath.data());
+}
+
+static std::string executeCodeCacheTestScript(ContextRef* context, ScriptParserRef::InitializeScriptResult initResult)
+{
+    EXPECT_TRUE(initResult.isSuccessful());
+    auto result = Evaluator::execute(context, [](ExecutionStateRef* state, ScriptRef* script) -> ValueRef* {
+        return script->execute(state);
+    },
+                                     initResult.script.value());
+    return result.resultOrErrorToString(context)->toStdUTF8String();
+}
+
+static std::string readCodeCacheTestFile(const std::string& filePath)
+{
+    std::string content;
+    FILE* file = fopen(filePath.data(), "rb");
+    if (file) {
+        char buffer[256];
+        size_t count;
+        while ((count = fread(buffer, 1, sizeof(buffer), file)) > 0) {
+            content.append(buffer, count);
+        }
+        fclose(file);
+    }
+    return content;
+}
+
+TEST(CodeCacheFileWriter, WriteAndDropAfterFailure)
+{
+    std::string dirPath = createCodeCacheTestDir();
+    std::string cacheDirPath = dirPath + "/Escargot-cache/";
+    EXPECT_EQ(mkdir(cacheDirPath.data(), 0755), 0);
+    std::string dataPath = cacheDirPath + "data";
+    std::string listPath = cacheDirPath + "list";
+
+    {
+        CodeCacheFileWriter writer;
+        // a new file is written at once, later data is written at its offset
+        writer.writeCacheData(dataPath, 0, std::string("abcdef"));
+        writer.writeCacheData(dataPath, 6, std::string("ghi"));
+        writer.writeCacheList(listPath, std::string("list"));
+        EXPECT_TRUE(writer.waitForFile(dataPath));
+        EXPECT_EQ(readCodeCacheTestFile(dataPath), "abcdefghi");
+        EXPECT_TRUE(writer.flush());
+        EXPECT_EQ(readCodeCacheTestFile(listPath), "list");
+        EXPECT_FALSE(writer.hasFailed());
+
+        // once a task fails, every following task is dropped
+        writer.writeCacheData(cacheDirPath + "missing/data", 0, std::string("x"));
+        writer.writeCacheList(listPath, std::string("dropped"));
+        EXPECT_FALSE(writer.flush());
+        EXPECT_TRUE(writer.hasFailed());
+        writer.removeCacheFile(dataPath);
+        EXPECT_FALSE(writer.waitForFile(dataPath));
+        EXPECT_EQ(readCodeCacheTestFile(listPath), "list");
+        EXPECT_EQ(readCodeCacheTestFile(dataPath), "abcdefghi");
+    }
+
+    removeCodeCacheTestDir(dirPath);
+}
+
+TEST(VMInstance, CodeCacheFlush)
+{
+    std::string dirPath = createCodeCacheTestDir();
+    auto source = StringRef::createFromASCII("function square(v) { return v * v; } [3, 4].map(square).join()");
+    auto srcName = StringRef::createFromASCII("flush.js");
+
+    {
+        PersistentRefHolder<VMInstanceRef> instance = VMInstanceRef::create(nullptr, nullptr, dirPath.data());
+        PersistentRefHolder<ContextRef> context = createEscargotContext(instance.get());
+        instance->setCodeCacheMinSourceLength(0);
+
+        auto initResult = context->scriptParser()->initializeScript(source, srcName);
+        EXPECT_FALSE(initResult.loadedFromCodeCache);
+        EXPECT_EQ(executeCodeCacheTestScript(context.get(), initResult), "9,16");
+
+        // cache files are written by background writer and flush waits for them
+        instance->flushCodeCache();
+        EXPECT_EQ(access((dirPath + "/Escargot-cache/cache_list").data(), F_OK), 0);
+
+        // cache directory is unlocked here because VMInstance is destroyed later by GC
+        context.release();
+        instance->clearCachesRelatedWithContext();
+        instance.release();
+    }
+
+    // another VMInstance loads the cache from the files
+    {
+        PersistentRefHolder<VMInstanceRef> instance = VMInstanceRef::create(nullptr, nullptr, dirPath.data());
+        PersistentRefHolder<ContextRef> context = createEscargotContext(instance.get());
+        instance->setCodeCacheMinSourceLength(0);
+
+        auto initResult = context->scriptParser()->initializeScript(source, srcName);
+        EXPECT_TRUE(initResult.loadedFromCodeCache);
+        EXPECT_EQ(executeCodeCacheTestScript(context.get(), initResult), "9,16");
+
+        context.release();
+        instance->clearCachesRelatedWithContext();
+        instance.release();
+    }
+
+    // cache written by a build with another bytecode layout is rejected
+    // the list file starts with the version hash and then the bytecode layout hash
+    {
+        std::string listPath = dirPath + "/Escargot-cache/cache_list";
+        std::string list = readCodeCacheTestFile(listPath);
+        ASSERT_GT(list.length(), sizeof(uint64_t) * 2);
+        list[sizeof(uint64_t)] ^= 0xff;
+        FILE* fp = fopen(listPath.data(), "wb");
+        ASSERT_TRUE(fp != nullptr);
+        EXPECT_EQ(fwrite(list.data(), 1, list.length(), fp), list.length());
+        fclose(fp);
+
+        PersistentRefHolder<VMInstanceRef> instance = VMInstanceRef::create(nullptr, nullptr, dirPath.data());
+        PersistentRefHolder<ContextRef> context = createEscargotContext(instance.get());
+        instance->setCodeCacheMinSourceLength(0);
+
+        auto initResult = context->scriptParser()->initializeScript(source, srcName);
+        EXPECT_FALSE(initResult.loadedFromCodeCache);
+        EXPECT_EQ(executeCodeCacheTestScript(context.get(), initResult), "9,16");
+
+        context.release();
+        instance->clearCachesRelatedWithContext();
+        instance.release();
+    }
+
+    removeCodeCacheTestDir(dirPath);
+}
+
+TEST(VMInstance, CodeCacheFileMapping)
+{
+    std::string dirPath = createCodeCacheTestDir();
+    PersistentRefHolder<VMInstanceRef> instance = VMInstanceRef::create(nullptr, nullptr, dirPath.data());
+    PersistentRefHolder<ContextRef> context = createEscargotContext(instance.get());
+    instance->setCodeCacheMinSourceLength(0);
+
+    auto source = StringRef::createFromASCII("function mul(a, b) { return a * b; } var mapped = [1, 2, 3].map(function(v) { return mul(v, 'x'.length + 1); }); mapped.join()");
+    auto srcName = StringRef::createFromASCII("mapped.js");
+    ScriptParserRef* parser = context->scriptParser();
+
+    // the first run stores cache of global code and functions
+    auto initResult = parser->initializeScript(source, srcName);
+    EXPECT_FALSE(initResult.loadedFromCodeCache);
+    EXPECT_EQ(executeCodeCacheTestScript(context.get(), initResult), "2,4,6");
+    instance->flushCodeCache();
+
+    // cache data is read in place from the mapping of cache data file
+    initResult = parser->initializeScript(source, srcName);
+    EXPECT_TRUE(initResult.loadedFromCodeCache);
+    EXPECT_EQ(executeCodeCacheTestScript(context.get(), initResult), "2,4,6");
+
+    context.release();
+    instance->clearCachesRelatedWithContext();
+    instance.release();
+    removeCodeCacheTestDir(dirPath);
+}
+#endif
+
+TEST(EvalScript, SuperInstructions)
+{
+    // compare followed by JumpIfFalse, including jumps which land on the JumpIfFalse of a pair
+    auto s = evalScript(g_context.get(), StringRef::createFromASCII(R"(
+    function between(a, lo, hi) { var r = lo <= a && a < hi && a !== 5; return r; }
+    function nested(a, b) { return (a > b && b >= 0) ? (a === b || a > 10) : !(b < a && a <= 3); }
+    var out = [];
+    for (var i = -1; i < 12; i++) { out.push(+between(i, 0, 10) + '' + +nested(i, 3)); }
+    var j = 0, k = 0;
+    while (j < 5 && (k++ < 3 || j === 4)) { j++; }
+    out.push(j, k);
+    out.join();
+    )"),
+                        StringRef::createFromASCII("test.js"), false);
+    EXPECT_EQ(s, "01,11,11,11,11,10,00,10,10,10,10,00,01,3,4");
+
+    // increment or decrement followed by the back edge, with continue and if/else ending at the back edge
+    s = evalScript(g_context.get(), StringRef::createFromASCII(R"(
+    var out = [];
+    var sum = 0;
+    for (var i = 0; i < 10; i++) {
+        if (i % 3 === 0) { continue; }
+        if (i & 1) { sum++; } else { sum += 10; }
+    }
+    out.push(sum);
+    var n = 5, m = 0;
+    while (n) { if (n > 2) { m++; } else { m += 100; } n--; }
+    out.push(m);
+    var x = 2147483647;
+    for (var c = 0; c < 2; c++) { x++; }
+    out.push(x);
+    var big = 1n;
+    for (var c = 0; c < 2; c++) { big--; }
+    out.push(big);
+    out.join();
+    )"),
+                   StringRef::createFromASCII("test.js"), false);
+    EXPECT_EQ(s, "33,203,2147483649,-1");
+
+    // exceptions thrown from the first or the second half of a pair
+    s = evalScript(g_context.get(), StringRef::createFromASCII(R"(
+    'use strict';
+    var out = [];
+    var thrower = { valueOf() { throw 'compare'; } };
+    try { if (thrower < 1 && out) { out.push('no'); } } catch (e) { out.push(e); }
+    var counter = { valueOf() { throw 'increment'; } };
+    try { for (var i = 0; i < 3; counter++) { i++; } } catch (e) { out.push(e + i); }
+    var frozen = Object.freeze({ x: 1 });
+    function store(o) { o.x = null; return o.x; }
+    try { store(frozen); } catch (e) { out.push(e.constructor.name); }
+    var setter = { set x(v) { throw 'setter ' + v; } };
+    try { store(setter); } catch (e) { out.push(e); }
+    out.push(String(store({ x: 1 })));
+    out.join();
+    )"),
+                   StringRef::createFromASCII("test.js"), false);
+    EXPECT_EQ(s, "compare,increment1,TypeError,setter null,null");
+}
+
+TEST(EvalScript, QuickeningFallback)
+{
+    // each site is warmed up with int32 operands first so that it is quickened, then sees other kinds
+    auto s = evalScript(g_context.get(), StringRef::createFromASCII(R"(
+    function add(a, b) { return a + b; }
+    function sub(a, b) { return a - b; }
+    function mul(a, b) { return a * b; }
+    function less(a, b) { return a < b; }
+    function inc(a) { a++; return a; }
+    function dec(a) { a--; return a; }
+    for (var i = 0; i < 100; i++) { add(i, 1); sub(i, 1); mul(i, 2); less(i, 50); inc(i); dec(i); }
+    var out = [];
+    out.push(add(1.5, 1), add('a', 1), add(2147483647, 1), sub(-2147483648, 1), mul(65536, 65536), mul(-1, 0));
+    out.push(less('10', '9'), less(1.5, 2), inc(2147483647), dec(-2147483648), inc(1.5), inc('7'));
+    var log = [];
+    var obj = { valueOf() { log.push('v'); return 3; } };
+    out.push(add(obj, 1), sub(obj, 1), less(obj, 4), inc(obj), log.length);
+    out.push(add(1, 2), inc(1), 1 / mul(-1, 0));
+    out.join();
+    )"),
+                        StringRef::createFromASCII("test.js"), false);
+    EXPECT_EQ(s, "2.5,a1,2147483648,-2147483649,4294967296,0,true,true,2147483648,-2147483649,2.5,8,4,2,true,4,4,3,2,-Infinity");
+
+    // sites quickened for doubles fall back on int32 and other kinds
+    s = evalScript(g_context.get(), StringRef::createFromASCII(R"(
+    function add(a, b) { return a + b; }
+    function mul(a, b) { return a * b; }
+    for (var i = 0; i < 100; i++) { add(i + 0.5, 0.25); mul(i + 0.5, 1.5); }
+    var thrower = { valueOf() { throw 'thrown'; } };
+    var out = [add(1, 2), add(1n, 2n), mul('2', 3), mul(2n, 3n)];
+    try { add(thrower, 1.5); } catch (e) { out.push(e); }
+    try { add(1n, 1.5); } catch (e) { out.push(e.constructor.name); }
+    out.push(add(0.5, 0.25));
+    out.join();
+    )"),
+                   StringRef::createFromASCII("test.js"), false);
+    EXPECT_EQ(s, "3,3,6,6,thrown,TypeError,0.75");
+}
+
 TEST(Object, ConstructorName)
 {
     ObjectRef* testObj = eval(g_context.get(), StringRef::createFromASCII("function foo(){}; var ctorNameTest = new foo(); ctorNameTest;"))->asObject();
@@ -2606,6 +2936,814 @@ TEST(ReloadableString, Basic)
                        string, &d);
 }
 
+TEST(Globals, OpcodeStats)
+{
+    if (!Globals::supportsOpcodeStats()) {
+        EXPECT_EQ(Globals::dumpOpcodeStats(), std::string());
+        return;
+    }
+
+    Globals::resetOpcodeStats();
+    std::string stats = Globals::dumpOpcodeStats();
+    EXPECT_EQ(stats.find("{\"totalDispatchCount\":0,\"opcodes\":{},\"slowPaths\":{},\"inlineCaches\":{"), 0u);
+
+    evalScript(g_context.get(), StringRef::createFromASCII(R"(
+    var o = { a: 1 };
+    var key = 'a';
+    for (var i = 0; i < 10; i++) { o[key]; }
+    )"),
+               StringRef::createFromASCII("test.js"), false);
+    stats = Globals::dumpOpcodeStats();
+    EXPECT_EQ(stats.find("{\"totalDispatchCount\":"), 0u);
+    EXPECT_NE(stats.find("\"GetObject\":"), std::string::npos);
+    // slow path counters are keyed by call site
+    EXPECT_NE(stats.find("\"getObjectOpcodeSlowCase:"), std::string::npos);
+    EXPECT_NE(stats.find("\"GetGlobalVariable\":{\"hit\":"), std::string::npos);
+
+    Globals::resetOpcodeStats();
+    EXPECT_EQ(Globals::dumpOpcodeStats().find("{\"totalDispatchCount\":0,"), 0u);
+}
+
+TEST(VMInstance, MegamorphicCache)
+{
+    size_t hitCount = g_instance->megamorphicCacheHitCount();
+    size_t missCount = g_instance->megamorphicCacheMissCount();
+
+    auto s = evalScript(g_context.get(), StringRef::createFromASCII(R"(
+    function getX(o) { return o.x; }
+    var objs = [];
+    for (var i = 0; i < 64; i++) { var o = {}; o['p' + i] = i; o.x = i; objs.push(o); }
+    var sum = 0;
+    for (var r = 0; r < 10; r++) { for (var i = 0; i < 64; i++) { sum += getX(objs[i]); } }
+    sum;
+    )"),
+                        StringRef::createFromASCII("megamorphic.js"), false);
+    EXPECT_EQ(s, "20160");
+    EXPECT_GT(g_instance->megamorphicCacheHitCount(), hitCount);
+    EXPECT_GT(g_instance->megamorphicCacheMissCount(), missCount);
+}
+
+TEST(VMInstance, ByteCodeEviction)
+{
+    EXPECT_EQ(g_instance->byteCodeEvictionPolicy(), VMInstanceRef::EvictAll);
+    g_instance->setByteCodeEvictionPolicy(VMInstanceRef::EvictLeastRecentlyUsed);
+    size_t maxSize = g_instance->maxCompiledByteCodeSize();
+    size_t targetSize = g_instance->byteCodeEvictionTargetSize();
+    size_t evictedCount = g_instance->evictedByteCodeBlockCount();
+    size_t regeneratedCount = g_instance->regeneratedByteCodeBlockCount();
+
+    g_instance->setMaxCompiledByteCodeSize(1);
+    g_instance->setByteCodeEvictionTargetSize(1);
+    auto s = evalScript(g_context.get(), StringRef::createFromASCII(R"(
+    var evictionTargets = [];
+    for (var i = 0; i < 32; i++) { evictionTargets.push(new Function('a', 'return a + ' + i)); }
+    function callEvictionTargets() { var s = 0; for (var i = 0; i < 32; i++) { s += evictionTargets[i](1); } return s; }
+    callEvictionTargets();
+    )"),
+                        StringRef::createFromASCII("eviction.js"), false);
+    EXPECT_EQ(s, "528");
+    Memory::gc();
+    EXPECT_GT(g_instance->evictedByteCodeBlockCount(), evictedCount);
+
+    s = evalScript(g_context.get(), StringRef::createFromASCII("callEvictionTargets();"), StringRef::createFromASCII("eviction2.js"), false);
+    EXPECT_EQ(s, "528");
+    EXPECT_GT(g_instance->regeneratedByteCodeBlockCount(), regeneratedCount);
+
+    g_instance->setMaxCompiledByteCodeSize(maxSize);
+    g_instance->setByteCodeEvictionTargetSize(targetSize);
+    g_instance->setByteCodeEvictionPolicy(VMInstanceRef::EvictAll);
+}
+
+TEST(VMInstance, KeyedInlineCache)
+{
+    // string and symbol keys: monomorphic hits, a fifth key evicting the oldest entry, shape changes and non-atomic keys
+    auto s = evalScript(g_context.get(), StringRef::createFromASCII(R"(
+    var sym = Symbol('s');
+    function get(o, k) { return o[k]; }
+    function set(o, k, v) { o[k] = v; }
+    var o = { a: 1, b: 2, c: 3, d: 4, e: 5 };
+    o[sym] = 6;
+    var keys = ['a', 'b', 'c', 'd', 'e', sym, 'x'];
+    var out = [];
+    for (var n = 0; n < 3; n++) {
+        for (var i = 0; i < keys.length; i++) { out.push(get(o, keys[i])); }
+    }
+    for (var i = 0; i < 20; i++) { set(o, 'a', i); set(o, sym, i * 2); }
+    out.push(o.a, o[sym]);
+    var dynamicKey = ['ab', 'cd'].join('');
+    var p = { abcd: 'dyn' };
+    for (var i = 0; i < 5; i++) { out.push(get(p, dynamicKey)); }
+    Object.defineProperty(o, 'a', { writable: false });
+    set(o, 'a', 100);
+    out.push(get(o, 'a'));
+    delete o.b;
+    out.push(get(o, 'b'));
+    var proto = { inherited: 'p' };
+    var child = Object.create(proto);
+    for (var i = 0; i < 3; i++) { out.push(get(child, 'inherited')); }
+    out.join();
+    )"),
+                        StringRef::createFromASCII("test.js"), false);
+    EXPECT_EQ(s, "1,2,3,4,5,6,,1,2,3,4,5,6,,1,2,3,4,5,6,,19,38,dyn,dyn,dyn,dyn,dyn,19,,p,p,p");
+
+    // TypedArray elements: raw reads and writes, out of bounds, changing element kind and non-number values
+    s = evalScript(g_context.get(), StringRef::createFromASCII(R"(
+    function get(o, k) { return o[k]; }
+    function set(o, k, v) { o[k] = v; }
+    var out = [];
+    var i8 = new Int8Array(4);
+    for (var i = 0; i < 6; i++) { set(i8, i, 200 + i); }
+    for (var i = 0; i < 6; i++) { out.push(get(i8, i)); }
+    var f64 = new Float64Array(2);
+    set(f64, 0, 1.5); set(f64, 1, { valueOf() { return 2.5; } });
+    out.push(get(f64, 0), get(f64, 1), get(i8, 0));
+    var u8c = new Uint8ClampedArray(1);
+    set(u8c, 0, 300);
+    out.push(get(u8c, 0));
+    var big = new BigInt64Array(1);
+    set(big, 0, 5n);
+    out.push(get(big, 0));
+    out.join();
+    )"),
+                   StringRef::createFromASCII("test.js"), false);
+    EXPECT_EQ(s, "-56,-55,-54,-53,,,1.5,2.5,-56,255,5");
+
+    // detached and resized buffers must not be accessed through a cached element kind
+    s = evalScript(g_context.get(), StringRef::createFromASCII(R"(
+    function get(o, k) { return o[k]; }
+    function set(o, k, v) { o[k] = v; }
+    var out = [];
+    var buffer = new ArrayBuffer(8, { maxByteLength: 16 });
+    var u8 = new Uint8Array(buffer);
+    for (var i = 0; i < 8; i++) { set(u8, i, i); }
+    out.push(get(u8, 7));
+    buffer.resize(4);
+    set(u8, 6, 1);
+    out.push(u8.length, get(u8, 3), get(u8, 6));
+    buffer.resize(16);
+    set(u8, 15, 15);
+    out.push(u8.length, get(u8, 15), get(u8, 6));
+    var detached = new Uint8Array(4);
+    set(detached, 0, 9);
+    out.push(get(detached, 0));
+    detached.buffer.transfer();
+    set(detached, 0, 1);
+    out.push(get(detached, 0), detached.length);
+    out.join();
+    )"),
+                   StringRef::createFromASCII("test.js"), false);
+    EXPECT_EQ(s, "7,4,3,,16,15,0,9,,0");
+}
+
+template <typename CharType>
+static size_t scalarLengthBelow(const CharType* src, size_t length, unsigned limit)
+{
+    size_t i = 0;
+    while (i < length && src[i] < limit) {
+        i++;
+    }
+    return i;
+}
+
+template <typename HaystackType, typename NeedleType>
+static size_t scalarFind(const HaystackType* haystack, size_t haystackLength, const NeedleType* needle, size_t needleLength)
+{
+    for (size_t i = 0; i + needleLength <= haystackLength; i++) {
+        size_t j = 0;
+        while (j < needleLength && haystack[i + j] == needle[j]) {
+            j++;
+        }
+        if (j == needleLength) {
+            return i;
+        }
+    }
+    return SIZE_MAX;
+}
+
+TEST(StringKernels, CompareWithScalar)
+{
+    // lengths around the 16 and 32 byte vector widths at every alignment of the start
+    const size_t maxLength = 70;
+    const size_t maxOffset = 4;
+    std::vector<LChar> latin1(maxLength + maxOffset);
+    std::vector<char16_t> utf16(maxLength + maxOffset);
+    std::vector<char16_t> widened(maxLength + maxOffset);
+    std::vector<LChar> narrowed(maxLength + maxOffset);
+
+    for (size_t offset = 0; offset < maxOffset; offset++) {
+        for (size_t length = 0; length <= maxLength; length++) {
+            for (size_t i = 0; i < latin1.size(); i++) {
+                latin1[i] = 'a' + i % 3;
+                utf16[i] = 'a' + i % 3;
+            }
+            const LChar* l = latin1.data() + offset;
+            const char16_t* u = utf16.data() + offset;
+
+            EXPECT_EQ(StringKernels::asciiLength(l, length), length);
+            EXPECT_EQ(StringKernels::asciiLength(u, length), length);
+            EXPECT_TRUE(StringKernels::equals(u, l, length));
+
+            StringKernels::widen(l, length, widened.data());
+            StringKernels::narrow(u, length, narrowed.data());
+            for (size_t i = 0; i < length; i++) {
+                EXPECT_EQ(widened[i], u[i]);
+                EXPECT_EQ(narrowed[i], l[i]);
+            }
+
+            // a non-ASCII or non-Latin1 character at every position
+            for (size_t pos = 0; pos < length; pos++) {
+                latin1[offset + pos] = 0xE9;
+                utf16[offset + pos] = pos & 1 ? 0x3042 : 0xE9;
+                EXPECT_EQ(StringKernels::asciiLength(l, length), scalarLengthBelow(l, length, 0x80));
+                EXPECT_EQ(StringKernels::asciiLength(u, length), scalarLengthBelow(u, length, 0x80));
+                EXPECT_EQ(StringKernels::latin1Length(u, length), scalarLengthBelow(u, length, 0x100));
+                EXPECT_EQ(StringKernels::equals(u, l, length), !(pos & 1));
+                latin1[offset + pos] = 'a' + (offset + pos) % 3;
+                utf16[offset + pos] = 'a' + (offset + pos) % 3;
+            }
+
+            // needles at the start, across vector boundaries, at the end, missing, and longer than the haystack
+            const LChar needleLatin1[] = { 'c', 'a', 'b', 'z' };
+            const char16_t needleUTF16[] = { 'c', 'a', 'b', 'z' };
+            for (size_t needleLength = 1; needleLength <= 4; needleLength++) {
+                EXPECT_EQ(StringKernels::find(l, length, needleLatin1, needleLength), scalarFind(l, length, needleLatin1, needleLength));
+                EXPECT_EQ(StringKernels::find(l, length, needleUTF16, needleLength), scalarFind(l, length, needleUTF16, needleLength));
+                EXPECT_EQ(StringKernels::find(u, length, needleLatin1, needleLength), scalarFind(u, length, needleLatin1, needleLength));
+                EXPECT_EQ(StringKernels::find(u, length, needleUTF16, needleLength), scalarFind(u, length, needleUTF16, needleLength));
+            }
+            if (length) {
+                latin1[offset + length - 1] = 'z';
+                utf16[offset + length - 1] = 'z';
+                const LChar z = 'z';
+                const char16_t z16 = 'z';
+                EXPECT_EQ(StringKernels::find(l, length, &z, 1), length - 1);
+                EXPECT_EQ(StringKernels::find(u, length, &z16, 1), length - 1);
+                EXPECT_EQ(StringKernels::find(l, length, l, length), 0u);
+                EXPECT_EQ(StringKernels::find(u, length, u, length), 0u);
+            }
+            EXPECT_EQ(StringKernels::find(l, length, latin1.data(), length + 1), SIZE_MAX);
+            EXPECT_EQ(StringKernels::find(u, length, utf16.data(), length + 1), SIZE_MAX);
+        }
+    }
+}
+
+TEST(RopeString, SearchAcrossLeaves)
+{
+    // ropes grown by appending and prepending are rebalanced many times
+    // searching them walks leaves with RopeStringLeafCursor and must match the flat string
+    auto s = evalScript(g_context.get(), StringRef::createFromASCII(R"(
+    var parts = [];
+    for (var i = 0; i < 3000; i++) {
+        parts.push(i % 7 === 3 ? '\u3042b' + i : (i % 2 ? 'ab' : 'ba') + i);
+    }
+    var appended = '', prepended = '', mixed = '';
+    for (var i = 0; i < parts.length; i++) { appended += parts[i]; }
+    for (var i = parts.length - 1; i >= 0; i--) { prepended = parts[i] + prepended; }
+    for (var i = 0; i < parts.length; i += 2) { mixed = (mixed + parts[i]) + (parts[i + 1] || ''); }
+    var flat = parts.join('');
+
+    var seed = 7;
+    function random(n) { seed = (seed * 1103515245 + 12345) % 2147483648; return seed % n; }
+    var mismatches = 0;
+    var ropes = [appended, prepended, mixed];
+    for (var n = 0; n < 300; n++) {
+        var start = random(flat.length);
+        var len = 1 + random(40);
+        var from = random(flat.length);
+        var needle = flat.substring(start, start + len);
+        var missing = needle + '\u3044';
+        for (var r = 0; r < ropes.length; r++) {
+            var rope = ropes[r];
+            if (rope.indexOf(needle, from) !== flat.indexOf(needle, from)) { mismatches++; }
+            if (rope.indexOf(missing) !== flat.indexOf(missing)) { mismatches++; }
+            if (!rope.includes(needle) || !rope.startsWith(needle, start) || !rope.endsWith(needle, start + needle.length)) { mismatches++; }
+            if (rope.startsWith(needle, start + 1) !== flat.startsWith(needle, start + 1)) { mismatches++; }
+            if (rope.startsWith(flat, 1) || rope.indexOf(flat + 'x') !== -1) { mismatches++; }
+        }
+    }
+    mismatches + ',' + (appended === flat) + ',' + (prepended === flat) + ',' + (mixed === flat) + ',' + (appended.length === flat.length);
+    )"),
+                        StringRef::createFromASCII("test.js"), false);
+    EXPECT_EQ(s, "0,true,true,true,true");
+}
+
+TEST(Memory, StringViewStats)
+{
+    auto before = Memory::stringViewStats();
+    auto s = evalScript(g_context.get(), StringRef::createFromASCII(R"(
+    var shortSlice = 'y'.repeat(1024).substring(10, 74);
+    var keptSlice = (function() { var big = 'x'.repeat(1024 * 1024) + 'tail'; return big.substring(1024 * 1024 - 60, 1024 * 1024 + 4); })();
+    shortSlice.length + ',' + keptSlice.length;
+    )"),
+                        StringRef::createFromASCII("stringview.js"), false);
+    EXPECT_EQ(s, "64,64");
+    auto after = Memory::stringViewStats();
+    // the slice of the short string shares its buffer
+    EXPECT_GT(after.createdCount, before.createdCount);
+    EXPECT_GE(after.sharedBytes, before.sharedBytes + 64);
+    // keptSlice alone would retain the large string, so it is copied when created
+    EXPECT_GT(after.copiedCount, before.copiedCount);
+    EXPECT_GE(after.copiedBytes, before.copiedBytes + 64);
+
+    s = evalScript(g_context.get(), StringRef::createFromASCII("keptSlice === 'x'.repeat(60) + 'tail'"), StringRef::createFromASCII("stringview2.js"), false);
+    EXPECT_EQ(s, "true");
+
+    // taking the same slice again does not cover more of the parent
+    before = Memory::stringViewStats();
+    s = evalScript(g_context.get(), StringRef::createFromASCII(R"(
+    var sameSlices = (function() { var big = 'z'.repeat(1024 * 1024) + 'tail'; var r = []; for (var i = 0; i < 2048; i++) { r.push(big.slice(0, 100)); } return r; })();
+    sameSlices.length + ',' + (sameSlices[2047] === 'z'.repeat(100));
+    )"),
+                   StringRef::createFromASCII("stringview4.js"), false);
+    EXPECT_EQ(s, "2048,true");
+    after = Memory::stringViewStats();
+    EXPECT_GE(after.copiedCount - before.copiedCount, 2048u);
+
+    // splitting a large input copies only the first lines, until the lines cover enough of the input
+    before = Memory::stringViewStats();
+    s = evalScript(g_context.get(), StringRef::createFromASCII(R"(
+    var line = 'a,b,c,'.repeat(8) + 'line';
+    var input = (line + '\n').repeat(4096);
+    var lines = input.split('\n');
+    var slices = [];
+    for (var i = 0; i < 4096; i++) { slices.push(input.slice(i * 53, i * 53 + 52)); }
+    lines.length + ',' + (lines[4095] === line) + ',' + (slices[4095] === line) + ',' + (input.slice(5, 60) === input.substring(5, 60));
+    )"),
+                   StringRef::createFromASCII("stringview3.js"), false);
+    EXPECT_EQ(s, "4097,true,true,true");
+    after = Memory::stringViewStats();
+    EXPECT_GT(after.sharedBytes - before.sharedBytes, 2 * (after.copiedBytes - before.copiedBytes));
+}
+
+TEST(Memory, GCPauseHistogram)
+{
+    EXPECT_EQ(Memory::gcCollectionMode(), Memory::STOP_THE_WORLD);
+    Memory::resetGCPauseHistogram();
+
+    // the pause is recorded before RECLAIM_END listeners run
+    size_t countSeenByListener = 0;
+    auto listener = [](void* data) {
+        *(size_t*)data = Memory::gcPauseHistogram().count;
+    };
+    Memory::addGCEventListener(Memory::RECLAIM_END, listener, &countSeenByListener);
+    Memory::gc();
+    Memory::removeGCEventListener(Memory::RECLAIM_END, listener, &countSeenByListener);
+
+    auto pauses = Memory::gcPauseHistogram();
+    EXPECT_GE(pauses.count, 1u);
+    EXPECT_GE(countSeenByListener, 1u);
+    EXPECT_GE(pauses.totalMicroseconds, pauses.maxMicroseconds);
+    size_t bucketTotal = 0;
+    for (size_t i = 0; i < Memory::GCPauseHistogramBucketCount; i++) {
+        bucketTotal += pauses.buckets[i];
+    }
+    EXPECT_EQ(bucketTotal, pauses.count);
+}
+
+#if !defined(_WIN32)
+TEST(Memory, GCPauseHistogramIncremental)
+{
+    // the gc library cannot leave incremental mode once it is entered,
+    // so incremental mode is tested in a child process not to change the other tests
+    enum { ChildPassed = 0,
+           ChildFailed = 1,
+           ChildUnsupported = 77 };
+    fflush(stdout);
+    fflush(stderr);
+    pid_t pid = fork();
+    ASSERT_NE(pid, -1);
+    if (pid == 0) {
+        int result = ChildPassed;
+        if (!Memory::setGCCollectionMode(Memory::INCREMENTAL, 5)) {
+            // the gc library is built without dirty bit support
+            result = ChildUnsupported;
+        } else {
+            EXPECT_EQ(Memory::gcCollectionMode(), Memory::INCREMENTAL);
+            Memory::resetGCPauseHistogram();
+
+            // objects stored while marking is in progress must survive
+            auto s = evalScript(g_context.get(), StringRef::createFromASCII(R"(
+            var incrementalKept = [];
+            for (var i = 0; i < 200000; i++) { var o = { index: i, next: null }; if (i % 10 === 0) { o.next = { index: -i }; incrementalKept.push(o); } }
+            incrementalKept.length;
+            )"),
+                                StringRef::createFromASCII("incremental.js"), false);
+            EXPECT_EQ(s, "20000");
+            Memory::gc();
+            s = evalScript(g_context.get(), StringRef::createFromASCII("incrementalKept.every(function(o, i) { return o.index === i * 10 && o.next.index === -i * 10; })"),
+                           StringRef::createFromASCII("incremental.js"), false);
+            EXPECT_EQ(s, "true");
+
+            auto pauses = Memory::gcPauseHistogram();
+            EXPECT_GE(pauses.count, 1u);
+            EXPECT_GE(pauses.totalMicroseconds, pauses.maxMicroseconds);
+            size_t bucketTotal = 0;
+            for (size_t i = 0; i < Memory::GCPauseHistogramBucketCount; i++) {
+                bucketTotal += pauses.buckets[i];
+            }
+            EXPECT_EQ(bucketTotal, pauses.count);
+
+            // STOP_THE_WORLD only sets an unlimited time slice
+            EXPECT_TRUE(Memory::setGCCollectionMode(Memory::STOP_THE_WORLD));
+            EXPECT_EQ(Memory::gcCollectionMode(), Memory::INCREMENTAL);
+            Memory::gc();
+
+            if (::testing::Test::HasFailure()) {
+                result = ChildFailed;
+            }
+        }
+        // failures are printed by the child. skip destructors and atexit handlers shared with the parent
+        fflush(stdout);
+        fflush(stderr);
+        _exit(result);
+    }
+
+    int status = 0;
+    ASSERT_EQ(waitpid(pid, &status, 0), pid);
+    ASSERT_TRUE(WIFEXITED(status));
+    if (WEXITSTATUS(status) == ChildUnsupported) {
+        GTEST_SKIP() << "the gc library is built without dirty bit support";
+    }
+    EXPECT_EQ(WEXITSTATUS(status), ChildPassed);
+    EXPECT_EQ(Memory::gcCollectionMode(), Memory::STOP_THE_WORLD);
+}
+#endif
+
+TEST(Memory, HeapStats)
+{
+    eval(g_context.get(), StringRef::createFromASCII("var heapStatsArrays = []; for (var i = 0; i < 100; i++) { heapStatsArrays.push([i]); } /a+b/.test('aab');"));
+    Memory::gc();
+
+    auto stats = Memory::heapStats(true);
+    EXPECT_GT(stats.heapSize, 0u);
+    EXPECT_GE(stats.gcCount, 1u);
+    EXPECT_GE(stats.arrayObjects.count, 101u);
+    EXPECT_GT(stats.arrayObjects.bytes, 0u);
+
+    auto cheapStats = Memory::heapStats();
+    EXPECT_EQ(cheapStats.arrayObjects.count, 0u);
+    EXPECT_EQ(cheapStats.gcCount, stats.gcCount);
+
+    auto vmStats = g_instance->stats();
+    EXPECT_GE(vmStats.regexpCacheSize, 1u);
+    EXPECT_LE(vmStats.compressedStringCount, vmStats.compressibleStringCount);
+    EXPECT_LE(vmStats.unloadedStringCount, vmStats.reloadableStringCount);
+
+    eval(g_context.get(), StringRef::createFromASCII("heapStatsArrays = undefined;"));
+}
+
+TEST(Memory, HeapSnapshot)
+{
+    eval(g_context.get(), StringRef::createFromASCII("var heapSnapshotHolder = { heapSnapshotKey: 'heapSnapshotValue', items: [{}, {}] };"));
+
+    FILE* fp = tmpfile();
+    ASSERT_TRUE(fp != nullptr);
+    EXPECT_TRUE(Memory::writeHeapSnapshot(fileno(fp)));
+
+    std::string snapshot;
+    char buf[4096];
+    rewind(fp);
+    size_t length;
+    while ((length = fread(buf, 1, sizeof(buf), fp)) > 0) {
+        snapshot.append(buf, length);
+    }
+    fclose(fp);
+
+    EXPECT_EQ(snapshot.find("{\"snapshot\":{\"meta\":"), 0u);
+    EXPECT_NE(snapshot.find("\"edges\":["), std::string::npos);
+    EXPECT_NE(snapshot.find("\"heapSnapshotKey\""), std::string::npos);
+    EXPECT_NE(snapshot.find("\"heapSnapshotValue\""), std::string::npos);
+    EXPECT_NE(snapshot.find("\"Array\""), std::string::npos);
+    // g_instance and g_context are held by PersistentRefHolders
+    EXPECT_NE(snapshot.find("\"(Persistent handles)\""), std::string::npos);
+    EXPECT_NE(snapshot.find("\"(persistent handle)\""), std::string::npos);
+    EXPECT_NE(snapshot.find("\"(VM instances)\""), std::string::npos);
+    EXPECT_NE(snapshot.find("\"VMInstance\""), std::string::npos);
+    EXPECT_NE(snapshot.find("\"(Contexts)\""), std::string::npos);
+    EXPECT_NE(snapshot.find("\"Context\""), std::string::npos);
+    EXPECT_EQ(snapshot.substr(snapshot.length() - 3), "]}\n");
+
+    eval(g_context.get(), StringRef::createFromASCII("heapSnapshotHolder = undefined;"));
+}
+
+TEST(Context, LazyBuiltins)
+{
+    PersistentRefHolder<ContextRef> context = ContextRef::create(g_instance.get());
+
+    // builtins written or deleted before their first use keep the program's value
+    // even when another builtin installs them internally afterwards
+    auto s = evalScript(context.get(), StringRef::createFromASCII(R"(
+        Map = 1;
+        Object.defineProperty(this, 'Set', { value: 2, enumerable: true });
+        delete Iterator;
+        [].values();
+        new WeakMap();
+        var setDesc = Object.getOwnPropertyDescriptor(this, 'Set');
+        [Map, Set, setDesc.enumerable, typeof Iterator, typeof Promise, Object.getOwnPropertyDescriptor(this, 'Promise').writable].join();
+    )"),
+                        StringRef::createFromASCII("lazybuiltins.js"), false);
+    EXPECT_EQ(s, "1,2,true,undefined,function,true");
+
+    context.release();
+}
+
+TEST(VMInstance, StaticStringsImage)
+{
+    // later instances copy the static strings built by the first instance of this thread
+    for (int i = 0; i < 2; i++) {
+        PersistentRefHolder<VMInstanceRef> instance = VMInstanceRef::create();
+        PersistentRefHolder<ContextRef> context = ContextRef::create(instance.get());
+        auto s = evalScript(context.get(), StringRef::createFromASCII(R"(
+            var o = { length: 1, '7': 2, 'x': 3 };
+            [o['len' + 'gth'], o[3 + 4], o[String.fromCharCode(120)], typeof o.break, [1, 2].join()].join();
+        )"),
+                            StringRef::createFromASCII("staticstrings.js"), false);
+        EXPECT_EQ(s, "1,2,3,undefined,1,2");
+        context.release();
+        instance.release();
+    }
+}
+
+TEST(JSON, StringifyToCallback)
+{
+    ValueRef* value = eval(g_context.get(), StringRef::createFromASCII(R"(
+    var jsonSource = [];
+    for (var i = 0; i < 20000; i++) { jsonSource.push({ id: i, name: 'item' + i, tag: i % 7 ? 'plain' : '\u3042"q"' }); }
+    jsonSource;
+    )"));
+
+    struct Result {
+        std::string output;
+        size_t chunkCount;
+    } result = { std::string(), 0 };
+    auto r = Evaluator::execute(g_context.get(), [](ExecutionStateRef* state, ValueRef* value, Result* result) -> ValueRef* {
+        bool serialized = JSONRef::stringify(state, value, ValueRef::createUndefined(), ValueRef::createUndefined(), [](ExecutionStateRef* state, StringRef* chunk, void* data) {
+            Result* result = (Result*)data;
+            result->output += chunk->toStdUTF8String();
+            result->chunkCount++;
+        },
+                                            result);
+        EXPECT_TRUE(serialized);
+        EXPECT_FALSE(JSONRef::stringify(state, ValueRef::createUndefined(), ValueRef::createUndefined(), ValueRef::createUndefined(), [](ExecutionStateRef* state, StringRef* chunk, void* data) {
+        },
+                                        nullptr));
+        return JSONRef::stringify(state, value, ValueRef::createUndefined(), ValueRef::createUndefined());
+    },
+                                value, &result);
+    EXPECT_TRUE(r.isSuccessful());
+    EXPECT_GT(result.chunkCount, 1u);
+    EXPECT_EQ(result.output, r.result->asString()->toStdUTF8String());
+
+    auto s = evalScript(g_context.get(), StringRef::createFromASCII("JSON.stringify(jsonSource).length"), StringRef::createFromASCII("json.js"), false);
+    EXPECT_EQ(s, std::to_string(r.result->asString()->length()));
+}
+
+TEST(JSON, StringifyToCallbackNonBMP)
+{
+    // surrogate pairs cross the 64K segment boundary at every other position
+    ValueRef* value = eval(g_context.get(), StringRef::createFromASCII(R"(
+    var nonBMPText = ['\u{1F600}'.repeat(40000), 'a' + '\u{10400}'.repeat(40000)];
+    [nonBMPText, [nonBMPText[0], { toJSON() { throw new Error('thrown'); } }]];
+    )"));
+
+    struct Result {
+        std::string output;
+        size_t chunkCount;
+        bool splitPair;
+    } result = { std::string(), 0, false };
+    auto r = Evaluator::execute(g_context.get(), [](ExecutionStateRef* state, ValueRef* value, Result* result) -> ValueRef* {
+        ValueRef* serializable = value->asArrayObject()->get(state, ValueRef::create(0));
+        bool serialized = JSONRef::stringify(state, serializable, ValueRef::createUndefined(), ValueRef::createUndefined(), [](ExecutionStateRef* state, StringRef* chunk, void* data) {
+            Result* result = (Result*)data;
+            char16_t last = chunk->charAt(chunk->length() - 1);
+            result->splitPair = result->splitPair || (last >= 0xD800 && last <= 0xDBFF);
+            result->output += chunk->toStdUTF8String();
+            result->chunkCount++;
+        },
+                                            result);
+        EXPECT_TRUE(serialized);
+        return JSONRef::stringify(state, serializable, ValueRef::createUndefined(), ValueRef::createUndefined());
+    },
+                                value, &result);
+    EXPECT_TRUE(r.isSuccessful());
+    EXPECT_GT(result.chunkCount, 2u);
+    EXPECT_FALSE(result.splitPair);
+    EXPECT_EQ(result.output, r.result->asString()->toStdUTF8String());
+
+    // chunks produced before an exception stay delivered
+    result = { std::string(), 0, false };
+    r = Evaluator::execute(g_context.get(), [](ExecutionStateRef* state, ValueRef* value, Result* result) -> ValueRef* {
+        ValueRef* throwing = value->asArrayObject()->get(state, ValueRef::create(1));
+        JSONRef::stringify(state, throwing, ValueRef::createUndefined(), ValueRef::createUndefined(), [](ExecutionStateRef* state, StringRef* chunk, void* data) {
+            ((Result*)data)->chunkCount++;
+        },
+                           result);
+        return ValueRef::createUndefined();
+    },
+                           value, &result);
+    EXPECT_FALSE(r.isSuccessful());
+    EXPECT_GT(result.chunkCount, 0u);
+}
+
+TEST(JSON, ParseChunks)
+{
+    const char* source = u8"{\"name\": \"\u3042\u3044\\u3046\\n\", \"list\": [1, -2.5e3, true, false, null, {}, []], \"nested\": {\"key\": [\"\\\"quoted\\\"\", 12345678901234]}}";
+    auto parser = JSONParserRef::create();
+
+    struct Data {
+        JSONParserRef* parser;
+        const char* source;
+    } data = { parser.get(), source };
+    // chunks of 3 bytes split tokens and UTF-8 sequences
+    auto r = Evaluator::execute(g_context.get(), [](ExecutionStateRef* state, Data* data) -> ValueRef* {
+        size_t length = strlen(data->source);
+        for (size_t i = 0; i < length; i += 3) {
+            data->parser->parseChunk(state, data->source + i, std::min(length - i, (size_t)3));
+        }
+        ValueRef* result = data->parser->finish(state);
+        return JSONRef::stringify(state, result, ValueRef::createUndefined(), ValueRef::createUndefined());
+    },
+                                &data);
+    EXPECT_TRUE(r.isSuccessful());
+    EXPECT_EQ(r.result->asString()->toStdUTF8String(), u8"{\"name\":\"\u3042\u3044\u3046\\n\",\"list\":[1,-2500,true,false,null,{},[]],\"nested\":{\"key\":[\"\\\"quoted\\\"\",12345678901234]}}");
+
+    auto incomplete = Evaluator::execute(g_context.get(), [](ExecutionStateRef* state, JSONParserRef* parser) -> ValueRef* {
+        parser->parseChunk(state, "[1, 2", 5);
+        return parser->finish(state);
+    },
+                                         parser.get());
+    EXPECT_FALSE(incomplete.isSuccessful());
+    EXPECT_EQ(incomplete.resultOrErrorToString(g_context.get())->toStdUTF8String().find("SyntaxError"), 0u);
+}
+
+TEST(JSON, StringifyPlainObjects)
+{
+    auto s = evalScript(g_context.get(), StringRef::createFromASCII(R"(
+    var records = [{ a: 1, "q\"": 'x', s: Symbol() }, { a: 2, "q\"": [3, , 4], s: undefined }];
+    Object.defineProperty(records[1], 'hidden', { value: 5, enumerable: false });
+    var holder = { first: { toJSON() { delete holder.second; holder.third = 3; return 0; } }, second: 2, third: 0 };
+    var accessor = { get a() { return 1; }, b: 2 };
+    JSON.stringify(records) + JSON.stringify(holder) + JSON.stringify(accessor) + JSON.stringify({ 1: 1, b: 2, 0: 0 }, null, 1);
+    )"),
+                        StringRef::createFromASCII("test.js"), false);
+    EXPECT_EQ(s, "[{\"a\":1,\"q\\\"\":\"x\"},{\"a\":2,\"q\\\"\":[3,null,4]}]{\"first\":0,\"third\":3}{\"a\":1,\"b\":2}{\n \"0\": 0,\n \"1\": 1,\n \"b\": 2\n}");
+}
+
+TEST(JSON, ParseRecordsWithSameKeys)
+{
+    auto s = evalScript(g_context.get(), StringRef::createFromASCII(R"(
+    var records = JSON.parse('[{"a":1,"b":2},{"a":3,"b":4},{"a":5,"a":6},{"a":7,"a":8},{"b":9,"a":0}]');
+    records[0].c = 1;
+    delete records[1].a;
+    JSON.stringify(records) + Object.keys(records[4]).join();
+    )"),
+                        StringRef::createFromASCII("test.js"), false);
+    EXPECT_EQ(s, "[{\"a\":1,\"b\":2,\"c\":1},{\"b\":4},{\"a\":6},{\"a\":8},{\"b\":9,\"a\":0}]b,a");
+}
+
+TEST(Map, DeleteDuringIteration)
+{
+    // deleting most of the entries shrinks the table while forEach is on the first entry
+    auto s = evalScript(g_context.get(), StringRef::createFromASCII(R"(
+    var m = new Map();
+    for (var i = 0; i < 64; i++) { m.set(i, i); }
+    var out = [];
+    m.forEach(function(v, k) {
+        out.push(k);
+        if (k === 0) { for (var j = 1; j < 60; j++) { m.delete(j); } }
+    });
+    out.join() + '|' + m.size;
+    )"),
+                        StringRef::createFromASCII("test.js"), false);
+    EXPECT_EQ(s, "0,60,61,62,63|5");
+
+    s = evalScript(g_context.get(), StringRef::createFromASCII(R"(
+    var s = new Set([1, 2, 3, 4, 5, 6, 7, 8, 9, 10]);
+    var out = [];
+    for (var x of s) {
+        out.push(x);
+        s.delete(x);
+        if (x === 5) { s.add(11); }
+    }
+    out.join() + '|' + s.size;
+    )"),
+                   StringRef::createFromASCII("test.js"), false);
+    EXPECT_EQ(s, "1,2,3,4,5,6,7,8,9,10,11|0");
+}
+
+TEST(Map, ClearWhileIterating)
+{
+    auto s = evalScript(g_context.get(), StringRef::createFromASCII(R"(
+    var m = new Map([[1, 'a'], [2, 'b'], [3, 'c']]);
+    var it = m.keys();
+    var first = it.next().value;
+    m.clear();
+    m.set(5, 'e');
+    var afterClear = it.next().value;
+    var done = it.next().done;
+    var it2 = m.entries();
+    m.clear();
+    first + ',' + afterClear + ',' + done + ',' + it2.next().done + ',' + m.size;
+    )"),
+                        StringRef::createFromASCII("test.js"), false);
+    EXPECT_EQ(s, "1,5,true,true,0");
+}
+
+TEST(Set, AddWhileIteratingAfterRehash)
+{
+    // the set grows and compacts its tombstones while the iterator is live
+    auto s = evalScript(g_context.get(), StringRef::createFromASCII(R"(
+    var s = new Set([0]);
+    var out = [];
+    for (var x of s) {
+        out.push(x);
+        if (x < 40) { s.add(x + 1); }
+        if (x === 10) { for (var i = 0; i < 10; i++) { s.delete(i); } }
+    }
+    var expected = [];
+    for (var i = 0; i <= 40; i++) { expected.push(i); }
+    (out.join() === expected.join()) + '|' + s.size + '|' + s.has(9) + '|' + s.has(10);
+    )"),
+                        StringRef::createFromASCII("test.js"), false);
+    EXPECT_EQ(s, "true|31|false|true");
+}
+
+TEST(WeakMap, ManyKeys)
+{
+    // enough keys to grow the table several times, then remove most of them to shrink it
+    auto s = evalScript(g_context.get(), StringRef::createFromASCII(R"(
+    var keys = [];
+    var wm = new WeakMap();
+    var ws = new WeakSet();
+    for (var i = 0; i < 1000; i++) {
+        var k = i % 2 ? {} : function() {};
+        keys.push(k);
+        wm.set(k, i);
+        ws.add(k);
+    }
+    var ok = true;
+    for (var i = 0; i < 1000; i++) { ok = ok && wm.get(keys[i]) === i && ws.has(keys[i]); }
+    for (var i = 0; i < 990; i++) { ok = ok && wm.delete(keys[i]) && ws.delete(keys[i]); }
+    for (var i = 0; i < 1000; i++) { ok = ok && wm.has(keys[i]) === (i >= 990) && ws.has(keys[i]) === (i >= 990); }
+    wm.set(keys[995], 'x');
+    ok + ',' + wm.get(keys[995]) + ',' + wm.delete(keys[0]) + ',' + wm.has({}) + ',' + ws.has(keys[999]);
+    )"),
+                        StringRef::createFromASCII("test.js"), false);
+    EXPECT_EQ(s, "true,x,false,false,true");
+}
+
+TEST(VMInstance, SamplingProfiler)
+{
+    EXPECT_FALSE(g_instance->isProfiling());
+    EXPECT_EQ(g_instance->stopProfiling(), std::string());
+    if (!Globals::supportsSamplingProfiler()) {
+        g_instance->startProfiling();
+        EXPECT_FALSE(g_instance->isProfiling());
+        GTEST_SKIP();
+    }
+
+    // profiling starts inside of profiledLoop with an interval longer than the test
+    // so the only sample is the one forced at the first safepoint, the back edge of do-while
+    Evaluator::execute(g_context.get(), [](ExecutionStateRef* state) -> ValueRef* {
+        FunctionObjectRef::NativeFunctionInfo nativeFunctionInfo(AtomicStringRef::create(state->context(), "startProfiling"),
+                                                                 [](ExecutionStateRef* state, ValueRef* thisValue, size_t argc, ValueRef** argv, bool isConstructCall) -> ValueRef* {
+                                                                     g_instance->startProfiling(60 * 1000 * 1000);
+                                                                     return ValueRef::createUndefined();
+                                                                 },
+                                                                 0, true, false);
+        state->context()->globalObject()->defineDataProperty(state, StringRef::createFromASCII("startProfiling"), FunctionObjectRef::create(state, nativeFunctionInfo), true, true, true);
+        return ValueRef::createUndefined();
+    });
+
+    evalScript(g_context.get(), StringRef::createFromASCII(R"(
+    function profiledLoop() {
+        var s = 0, i = 0;
+        startProfiling();
+        do { s += i & 3; i++; } while (i < 1000);
+        return s;
+    }
+    profiledLoop();
+    )"),
+               StringRef::createFromASCII("profile.js"), false);
+    EXPECT_TRUE(g_instance->isProfiling());
+    std::string folded = g_instance->stopProfiling(VMInstanceRef::FoldedStacks);
+    EXPECT_FALSE(g_instance->isProfiling());
+    // a single stack ending at profiledLoop with a single sample
+    EXPECT_NE(folded.find("profiledLoop (profile.js:2:"), std::string::npos);
+    EXPECT_EQ(folded.find('\n'), folded.length() - 1);
+    EXPECT_EQ(folded.substr(folded.length() - 4), ") 1\n");
+
+    evalScript(g_context.get(), StringRef::createFromASCII("profiledLoop();"), StringRef::createFromASCII("profile2.js"), false);
+    std::string profile = g_instance->stopProfiling();
+    EXPECT_EQ(profile.find("{\"nodes\":[{\"id\":1,"), 0u);
+    EXPECT_NE(profile.find("\"functionName\":\"profiledLoop\""), std::string::npos);
+    EXPECT_NE(profile.find("\"positionTicks\":[{\"line\":5,\"ticks\":1}]"), std::string::npos);
+    // global code of profile2.js and profiledLoop of profile.js are in different scripts
+    EXPECT_NE(profile.find("\"scriptId\":\"1\",\"url\":\"profile2.js\""), std::string::npos);
+    EXPECT_NE(profile.find("\"scriptId\":\"2\",\"url\":\"profile.js\""), std::string::npos);
+    EXPECT_NE(profile.find("\"samples\":["), std::string::npos);
+}
+
 TEST(DisabledStackOverflow, Basic)
 {
     Evaluator::execute(g_context.get(), [](ExecutionStateRef* state) -> ValueRef* {
@@ -0,0 +1,41 @@
+/*
+ * Copyright (c) 2024-present Samsung Electronics Co., Ltd
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+ *  USA
+ */
+
+// measures how fast Contexts are created
+// newGlobal is defined by the shell of ESCARGOT_TEST build
+// usage: ./escargot tools/benchmark/context-creation.js
+// memory kept by each Context can be compared with the max RSS of runs with a different contextCount
+
+var contextCount = 100;
+var rounds = 5;
+var best = Infinity;
+
+for (var round = 0; round < rounds; round++) {
+    var contexts = [];
+    gc();
+    var start = Date.now();
+    for (var i = 0; i < contextCount; i++) {
+        contexts.push(newGlobal());
+    }
+    var elapsed = Date.now() - start;
+    best = Math.min(best, elapsed);
+    contexts = undefined;
+}
+
+print("Context creation: " + contextCount + " contexts, best of " + rounds + " rounds " + best + "ms, " + Math.round(contextCount * 1000 / Math.max(best, 1)) + " contexts/sec");